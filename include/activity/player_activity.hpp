@@ -125,6 +125,7 @@ private:
     void updateShuffleIcon();       // Update shuffle button icon based on state
     void updateRepeatIcon();        // Update repeat button icon based on state
     void onTrackEnded(const QueueItem* nextTrack);  // Called when track ends
+    void onGaplessAdvance();        // mpv already moved on to the new current track
     void updateQueueDisplay();      // Update UI with queue info
     void playNextEpisode();         // Auto-play next episode in season/show
 
@@ -190,6 +190,11 @@ struct AppSettings {
     // FPS, frame drops, and cache state in real time. Driven from the
     // Playback Tuning dialog; off by default.
     bool showMpvStats = false;
+
+    // Record per-phase main-loop timings and draw them as a bar graph in
+    // the bottom-left corner (brls::Application frame profiler). Traces
+    // can be exported to CSV from Settings. Developer toggle; off by default.
+    bool showFrameProfiler = false;
 };
 
 /**
@@ -268,6 +273,8 @@ public:
     static std::string getSubtitleSizeString(SubtitleSize size);
 
 private:
+    void finishSessionRestore();
+
     Application() = default;
     ~Application() = default;
     Application(const Application&) = delete;
@@ -171,6 +171,14 @@ public:
     // Get downloads directory path
     std::string getDownloadsPath() const;
 
+    // Fetch a server media part (the original file, ?download=1) to `path`,
+    // resuming a partial file already there. Bypasses the downloads list:
+    // nothing is queued, saved or reported. `keepGoing` is asked after every
+    // chunk; return false to stop. Blocking — call from a worker. Used by
+    // MusicPrefetch's read-ahead cache.
+    bool fetchPartToFile(const std::string& partPath, const std::string& path,
+                         int64_t expectedSize, const std::function<bool()>& keepGoing);
+
 private:
     DownloadsManager() = default;
     ~DownloadsManager() = default;
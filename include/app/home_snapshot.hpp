@@ -0,0 +1,57 @@
+/**
+ * VitaPlex - Home snapshot
+ * The last Home tab HomeTab rendered, kept on disk so a cold start can show
+ * it before the server has answered anything.
+ *
+ * Holds the Continue Watching and Recently Added rails with just the fields
+ * a MediaItemCell paints (plus the keys its actions need), written as one
+ * small binary file to <platform data dir>/home.snap after every complete
+ * refresh and flushed again on exit. Covers are the items' thumb paths, so
+ * they load through ImageLoader as usual once the server URL is set.
+ *
+ * A snapshot belongs to one server URL and Plex Home user; current() returns
+ * null for any other, so a switch never shows someone else's Continue
+ * Watching. Same immutable hand-off as LibraryIndex: store() swaps in a new
+ * one, readers keep whatever they were given.
+ */
+
+#pragma once
+
+#include "app/plex_client.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vitaplex {
+
+struct HomeSnapshot {
+    using Ptr = std::shared_ptr<const HomeSnapshot>;
+
+    std::string serverUrl;
+    std::string homeUserUuid;
+    int64_t savedAt = 0;   // epoch seconds
+    std::vector<MediaItem> continueWatching;
+    std::vector<MediaItem> recentMovies;
+    std::vector<MediaItem> recentShows;
+    std::vector<MediaItem> recentMusic;
+
+    // Any thread. The snapshot for the current server and Home user, read
+    // from disk on first use; null when there is none.
+    static Ptr current();
+
+    // UI thread. Replace the snapshot (serverUrl / homeUserUuid are filled
+    // in from the current session) and write it on a worker.
+    static void store(HomeSnapshot snapshot);
+
+    // Write the snapshot now if the last store() hasn't reached the disk
+    // yet. Called on shutdown.
+    static void flush();
+
+    // Forget the snapshot and delete the file. Called wherever
+    // LibraryIndex::clear() is.
+    static void clear();
+};
+
+} // namespace vitaplex
@@ -0,0 +1,114 @@
+/**
+ * VitaPlex - Local library index
+ * Persistent per-section copy of what the library grid shows, so opening a
+ * section no longer re-pages it from the server.
+ *
+ * Each index holds the grid fields plus the sort keys for every item in one
+ * section of one server, written to <platform data dir>/library/. Opening a
+ * section serves the grid, A-Z rail and count from it straight away; sync()
+ * then asks the server only for items added or updated since the newest
+ * timestamps already held (addedAt>> / updatedAt>> filters) and compares
+ * the merged count with the section's totalSize. A mismatch means items were
+ * deleted (or a delta was missed), which only a full re-list can resolve.
+ *
+ * Indexes are immutable once built: sync() returns a new one, so the UI can
+ * keep slicing the old one while a worker builds the next (same hand-off as
+ * PlexSession). Watch state is kept for LibraryQuery's Watch Status filter;
+ * it changes without touching updatedAt, so sync() also pulls a
+ * lastViewedAt>> delta. That catches anything played since, but an item
+ * marked unplayed elsewhere stays "played" until the next full re-list.
+ * viewOffset is left out altogether.
+ */
+
+#pragma once
+
+#include "app/plex_client.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vitaplex {
+
+// Grid fields + sort keys for one item. Kept separate from MediaItem (a few
+// hundred bytes of mostly-empty members) so a 15k-item section stays small.
+struct LibraryIndexEntry {
+    std::string ratingKey;
+    std::string key;
+    std::string title;
+    std::string titleSort;
+    std::string thumb;
+    std::string type;
+    std::string contentRating;
+    std::string subtype;
+    MediaType mediaType = MediaType::UNKNOWN;
+    int32_t year = 0;
+    int32_t duration = 0;
+    int32_t releaseDate = 0;      // originallyAvailableAt as YYYYMMDD, 0 = unknown
+    float rating = 0.0f;
+    float audienceRating = 0.0f;
+    int64_t addedAt = 0;
+    int64_t updatedAt = 0;
+    int64_t lastViewedAt = 0;
+    bool watched = false;
+    std::string videoResolution;
+    std::vector<std::string> genres;
+
+    static LibraryIndexEntry fromMediaItem(const MediaItem& item);
+    MediaItem toMediaItem() const;
+};
+
+class LibraryIndex {
+public:
+    using Ptr = std::shared_ptr<const LibraryIndex>;
+
+    // Worker thread. The persisted index for `sectionKey` on the current
+    // server, or null when there is none (never synced, other server, or an
+    // unreadable file). No network. `remember` keeps it as the one index
+    // held in memory; LibrarySearch loads every section and passes false so
+    // the section being browsed stays cached.
+    static Ptr load(const std::string& sectionKey, bool remember = true);
+
+    // Worker thread. Brings `base` (may be null) up to date with the server
+    // and persists the result. Returns `base` itself when nothing changed and
+    // null when the server could not be reached or the section is already
+    // syncing on another thread — callers keep serving whatever they already
+    // had. Can take minutes on a large section: run it on a dedicated thread
+    // (asyncRunDedicated), never on a pool worker.
+    static Ptr sync(const std::string& sectionKey, int metadataType, const Ptr& base);
+
+    // Plex metadata type listed for a section type ("movie" -> 1, "show" ->
+    // 2, "artist" -> 8), 0 for anything the index doesn't cover.
+    static int metadataTypeFor(const std::string& sectionType);
+
+    // Wipe every persisted index. Called from Settings "Clear cache", from
+    // logout and on a Plex Home user switch (indexes hold watch state).
+    // Safe to call when the directory doesn't exist.
+    static void clear();
+
+    const std::vector<LibraryIndexEntry>& entries() const { return m_entries; }
+    size_t size() const { return m_entries.size(); }
+    const std::string& sectionKey() const { return m_sectionKey; }
+    int64_t syncedAt() const { return m_syncedAt; }
+
+private:
+    static std::string indexDir();
+    static std::string pathFor(const std::string& serverId, const std::string& sectionKey);
+    static Ptr readFile(const std::string& path);
+    static void writeFile(const std::string& path, const LibraryIndex& index);
+
+    // Page through `/all` with `filter` appended, collecting every item.
+    // False on any failed page; *totalCount gets the first page's totalSize.
+    static bool fetchAll(const std::string& sectionKey, int metadataType,
+                         const std::string& filter, std::vector<LibraryIndexEntry>& out,
+                         int* totalCount);
+
+    std::string m_serverId;   // machineIdentifier the index was built from
+    std::string m_sectionKey;
+    int m_metadataType = 0;
+    int64_t m_syncedAt = 0;   // local clock, for logging / staleness only
+    std::vector<LibraryIndexEntry> m_entries;
+};
+
+} // namespace vitaplex
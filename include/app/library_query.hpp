@@ -0,0 +1,89 @@
+/**
+ * VitaPlex - Library query engine
+ * Sorts and filters a section's LibraryIndex in memory, so changing the sort
+ * or a filter chip re-orders the grid locally instead of re-listing the
+ * section from offset 0.
+ *
+ * Everything a query touches is precomputed once per index by build(): an
+ * ascending and a descending permutation per sort field (ties broken by
+ * ascending title rank in both, so every comparison during the build is an
+ * integer one after the title pass) and a bitmap per filter value (genre,
+ * year, decade, content rating, resolution, watch state). run() then ORs /
+ * ANDs a few bitmaps and walks one permutation — well under a millisecond
+ * for a 15k-item section, cheap enough for the UI thread. Fields the index doesn't carry (studio,
+ * country, languages, mood, ...) report !canFilter() and the caller goes to
+ * the server as before.
+ */
+
+#pragma once
+
+#include "app/library_index.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vitaplex {
+
+class LibraryQuery {
+public:
+    using Ptr = std::shared_ptr<const LibraryQuery>;
+
+    // One filter field's selection, as the library filter UI keeps it:
+    // (Plex filter key, display label) pairs matched OR (comma-joined on the
+    // server) or AND (repeated param).
+    struct Filter {
+        std::vector<std::pair<std::string, std::string>> values;
+        bool andMode = false;
+    };
+    using Filters = std::map<std::string, Filter>;   // keyed by Plex filter field
+
+    // Worker thread: a full sort per field. Null for a null index.
+    static Ptr build(LibraryIndex::Ptr index);
+
+    // Whether run() can answer a server sort param ("field:asc|desc") or a
+    // filter field without the server.
+    static bool canSort(const std::string& sortParam);
+    static bool canFilter(const std::string& field);
+    static bool canRun(const std::string& sortParam, const Filters& filters);
+
+    // Positions into index()->entries() matching every filter, in the order
+    // the server would return for `sortParam`. Callers check canRun() first;
+    // unknown sorts fall back to title order, unknown fields match nothing.
+    std::vector<uint32_t> run(const std::string& sortParam, const Filters& filters) const;
+
+    const LibraryIndex::Ptr& index() const { return m_index; }
+
+private:
+    using Bitmap = std::vector<uint64_t>;
+
+    // The bitmap for one selected value, or null when nothing has it.
+    const Bitmap* lookup(const std::string& field,
+                         const std::pair<std::string, std::string>& value) const;
+    void set(Bitmap& bitmap, uint32_t i) const;
+
+    LibraryIndex::Ptr m_index;
+    size_t m_words = 0;   // uint64 words per bitmap
+
+    // Permutation per sort field ("titleSort", "year", ...), ascending and
+    // descending. Equal keys keep ascending title order in both.
+    std::map<std::string, std::vector<uint32_t>> m_sorted;
+    std::map<std::string, std::vector<uint32_t>> m_sortedDesc;
+
+    // Genre and content rating match on the lower-cased display label (the
+    // filter keys are server ids the listing doesn't carry); year, decade
+    // and resolution match on the filter key itself.
+    std::unordered_map<std::string, Bitmap> m_genre;
+    std::unordered_map<std::string, Bitmap> m_contentRating;
+    std::unordered_map<std::string, Bitmap> m_resolution;
+    std::unordered_map<std::string, Bitmap> m_year;
+    std::unordered_map<std::string, Bitmap> m_decade;
+    Bitmap m_watched;
+    Bitmap m_unwatched;
+};
+
+} // namespace vitaplex
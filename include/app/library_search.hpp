@@ -0,0 +1,101 @@
+/**
+ * VitaPlex - Local search index
+ * Title search across every movie, TV and music library of the current
+ * server, answered from the LibraryIndex files instead of a /hubs/search
+ * round trip, so SearchTab can show ranked results on every keystroke.
+ *
+ * Titles are folded once at build time (ASCII lower-case, punctuation to
+ * spaces) and indexed two ways: a sorted token list for word-prefix lookups
+ * ("spi ho" -> "Spider-Man: No Way Home") and trigram postings for matches
+ * inside a word ("matrix" -> "Animatrix"). A query costs a binary search
+ * plus a scan of the candidates it finds — tens of microseconds on a 20k
+ * title server — so it runs on the UI thread.
+ *
+ * The section indexes only hold top-level items (movies, shows, artists);
+ * episodes, albums and tracks still come from the server search, which the
+ * caller merges in afterwards for anything contains() doesn't know.
+ *
+ * Snapshots are immutable, same hand-off as LibraryIndex: refresh() and
+ * update() build a new one on a worker and swap it in, current() hands out
+ * whatever was last published.
+ */
+
+#pragma once
+
+#include "app/library_index.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace vitaplex {
+
+class LibrarySearch {
+public:
+    using Ptr = std::shared_ptr<const LibrarySearch>;
+
+    // Any thread. The last published snapshot for the current server, or
+    // null before the first refresh() finishes.
+    static Ptr current();
+
+    // Any thread. Whether refresh() has work to do: nothing published for
+    // the current server yet, or the last refresh is older than the cache
+    // lifetime.
+    static bool needsRefresh();
+
+    // Dedicated thread (a first visit lists whole sections). Loads the index
+    // of every searchable section, syncing only the ones never synced, then
+    // publishes a fresh snapshot. A no-op unless needsRefresh(); concurrent
+    // calls collapse into one. Returns whether this call published.
+    static bool refresh();
+
+    // Worker thread. Swaps one section's freshly synced index into the
+    // published snapshot (LibrarySectionTab calls this after its own sync).
+    // A no-op until the first refresh() has published.
+    static void update(const LibraryIndex::Ptr& index);
+
+    // Drop the published snapshot and any build in flight. Called wherever
+    // LibraryIndex::clear() is.
+    static void clear();
+
+    // Ranked matches for `query`, best first, at most `limitPerType` of each
+    // media type. Empty for a query with nothing searchable in it.
+    std::vector<MediaItem> search(const std::string& query, size_t limitPerType) const;
+
+    // Whether `ratingKey` is in one of the indexed sections, matched or not.
+    bool contains(const std::string& ratingKey) const;
+
+    size_t size() const { return m_docs.size(); }
+
+private:
+    struct Doc {
+        const LibraryIndexEntry* entry;
+        uint32_t text;   // offset of the folded title in m_text
+        uint32_t len;
+    };
+    struct Token {
+        uint32_t text;   // offset into m_text
+        uint32_t len;
+        uint32_t doc;
+    };
+
+    static Ptr build(std::vector<LibraryIndex::Ptr> indexes, const std::string& serverId);
+    static void publish(std::vector<LibraryIndex::Ptr> indexes, const std::string& serverId,
+                        uint64_t generation);
+
+    std::string m_serverId;
+    std::vector<LibraryIndex::Ptr> m_indexes;   // keeps every Doc::entry alive
+    std::vector<Doc> m_docs;
+    std::string m_text;                         // folded titles, back to back
+    std::vector<Token> m_tokens;                // sorted by token text
+    // Trigram postings, CSR layout: the docs holding m_trigrams[i] are
+    // m_trigramDocs[m_trigramStart[i] .. m_trigramStart[i + 1]), ascending.
+    std::vector<uint32_t> m_trigrams;
+    std::vector<uint32_t> m_trigramStart;
+    std::vector<uint32_t> m_trigramDocs;
+    std::unordered_set<std::string> m_ratingKeys;
+};
+
+} // namespace vitaplex
@@ -0,0 +1,68 @@
+/**
+ * VitaPlex - Metadata cache
+ * Parsed /library/metadata results kept in memory, so going back and forth
+ * between a show, a season and an episode reads memory instead of
+ * repeating the same four requests per page.
+ *
+ * Process-wide and byte-bounded (platform::metadataCacheBytes(), LRU),
+ * keyed by ratingKey plus the kind of request. PlexClient consults it in
+ * fetchMediaDetails / fetchMediaDetailsBatch / fetchChildren / fetchExtras /
+ * fetchRelated, so the detail view, the player and downloads all share it
+ * without knowing it exists. Entries also age out after the caller's
+ * maxAgeSec, since watch state changes on other clients too.
+ *
+ * Invalidation is by version stamp: a fetch takes stamp() before its
+ * request and passes it to put(); invalidate() (called by PlexClient after
+ * every scrobble, timeline report and playlist edit) bumps the versions of
+ * the item and of every cached container listing it, so neither the stale
+ * entries nor a fetch that was already on the wire can bring the old state
+ * back. clear() is for logout / server or Home user switches.
+ */
+
+#pragma once
+
+#include "app/plex_client.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vitaplex {
+
+class MetadataCache {
+public:
+    enum class Kind : uint8_t {
+        DETAILS,    // fetchMediaDetails: one item
+        CHILDREN,   // fetchChildren
+        EXTRAS,     // fetchExtras
+        RELATED,    // fetchRelated
+    };
+
+    // Take before issuing the request whose result goes to put().
+    static uint64_t stamp();
+
+    // Any thread. True on a hit no older than maxAgeSec (<= 0: never hits).
+    static bool get(Kind kind, const std::string& ratingKey, int maxAgeSec,
+                    std::vector<MediaItem>& out);
+    static bool get(const std::string& ratingKey, int maxAgeSec, MediaItem& out);
+
+    // Store a result fetched after `stamp`. Dropped when the key was
+    // invalidated since, or when maxAgeSec <= 0 (cache off).
+    static void put(Kind kind, const std::string& ratingKey, uint64_t stamp,
+                    int maxAgeSec, const std::vector<MediaItem>& items);
+    static void put(const std::string& ratingKey, uint64_t stamp, int maxAgeSec,
+                    const MediaItem& item);
+
+    // The item changed on the server: drop it, its parents and every
+    // container listing it.
+    static void invalidate(const std::string& ratingKey);
+
+    // Drop everything.
+    static void clear();
+
+    static size_t entryCount();
+    static size_t totalBytes();
+};
+
+} // namespace vitaplex
@@ -18,6 +18,13 @@
  *
  * play/pause/seek always go straight to the MpvPlayer singleton, so they work in
  * either mode.
+ *
+ * Gapless advance (either mode): near the end of a track the controller
+ * resolves the URL of the track MusicQueue::playNext() would pick and appends
+ * it to mpv's playlist, so mpv opens it early and moves straight on. When mpv
+ * has moved, the queue is advanced to match and the foreground player just
+ * refreshes its labels. A queue edit or a shuffle / repeat change that picks a
+ * different next track drops the appended entry and resolves again.
  */
 
 #pragma once
@@ -26,6 +33,7 @@
 #include <functional>
 
 #include "app/music_queue.hpp"
+#include "utils/async.hpp"
 
 namespace vitaplex {
 
@@ -41,6 +49,7 @@ public:
         std::function<void(const QueueItem*)> onTrackEnded; // auto-advance handler
         std::function<void(bool)> onSetShuffle;             // server-aware shuffle + icon refresh
         std::function<void(RepeatMode)> onSetRepeat;        // set repeat + icon refresh
+        std::function<void()> onGaplessAdvance;             // mpv is already on the new current track
     };
 
     // Called by PlayerActivity on create (attach) and on destroy / background
@@ -65,6 +74,12 @@ public:
     // player's update timer). Ignores transient LOADING/BUFFERING.
     void syncSessionState();
 
+    // Gapless advance: pick up an advance mpv made on its own, keep the
+    // appended next track in line with the queue, and resolve + append it
+    // once the current track is near its end. Call once a second from the
+    // same timers as syncSessionState().
+    void updateGapless();
+
     // Transport entry points. These are also the targets of the OS media buttons
     // (wired through nowplaying::setHandler in install()).
     void togglePlayPause();
@@ -92,6 +107,7 @@ private:
     void registerOsHandler();       // (re)claim the nowplaying transport handler
     void handleTrackEnded(const QueueItem* nextTrack);
     bool loadCurrentHeadless();     // minimal URL resolve + mpv loadUrl (no UI)
+    void dropAppended();            // forget (and cancel) the prepared next track
     void startPolling();
     void stopPolling();
 
@@ -103,6 +119,23 @@ private:
     bool m_lastPublishedPlaying = false; // play flag of the most recent publish
     ForegroundHooks m_fg;
     brls::RepeatingTimer m_pollTimer;  // headless end-of-track watcher
+
+    // A next track resolved ahead of time. sessionId is its own transcode
+    // session (empty for a local file), kept out of PlexClient's current one
+    // until mpv actually moves onto it.
+    struct PreparedTrack {
+        std::string url;
+        std::string sessionId;
+    };
+
+    // Gapless state. m_appendedKey is the track sitting in mpv's playlist,
+    // m_resolveKey the one whose URL is being resolved.
+    std::string m_appendedKey;
+    std::string m_appendedSession;     // m_appendedKey's transcode session
+    std::string m_resolveKey;
+    std::string m_failedForKey;        // current track whose next failed to resolve
+    Task<PreparedTrack> m_resolveTask;
+    uint32_t m_seenAdvances = 0;       // MpvPlayer::getAdvanceCount() handled
 };
 
 } // namespace vitaplex
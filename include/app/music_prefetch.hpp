@@ -0,0 +1,87 @@
+/**
+ * VitaPlex - Music read-ahead cache
+ * The next few MusicQueue tracks, fetched to disk while the current one
+ * plays, so a flaky connection stalls playback at most once instead of at
+ * every track boundary.
+ *
+ * update() runs from the same once-a-second timers as the gapless check
+ * (headless poll and the foreground player). It takes the next
+ * kReadAheadTracks tracks in play order (MusicQueue::peekUpcoming, so
+ * shuffle and repeat are followed), and a dedicated worker fetches whichever
+ * are missing, one at a time, as original files through
+ * DownloadsManager::fetchPartToFile() — the same resumable writer the
+ * downloads use, without an entry in the downloads list. A queue edit, a
+ * shuffle change or a skip changes the set: a fetch that is no longer wanted
+ * stops and its partial file is deleted. Fetching also backs off while the
+ * current track is still opening (the partial is kept and resumed).
+ *
+ * Files live in <platform data dir>/music_cache as <ratingKey>.<ext>, within
+ * platform::musicPrefetchBytes(); the least recently played go first, never
+ * the playing track or one still wanted. The cache belongs to one server and
+ * is wiped when another is connected. Playback asks cachedPath() after the
+ * downloads and before resolving a stream.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vitaplex {
+
+class MusicPrefetch {
+public:
+    static MusicPrefetch& getInstance();
+
+    // UI thread, once a second while music is up. Re-reads the upcoming
+    // tracks, stops a fetch the queue no longer wants and starts the worker
+    // when something is missing.
+    void update();
+
+    // Any thread. Path of a fully cached track (counts as a use); false if
+    // it isn't cached for the connected server.
+    bool cachedPath(const std::string& ratingKey, std::string& path);
+
+    // Stop fetching and delete every cached track. Called wherever
+    // MetadataCache::clear() is.
+    void clear();
+
+private:
+    MusicPrefetch() = default;
+    MusicPrefetch(const MusicPrefetch&) = delete;
+    MusicPrefetch& operator=(const MusicPrefetch&) = delete;
+
+    struct Entry {
+        std::string path;
+        int64_t bytes = 0;
+        uint64_t lastUsed = 0;
+    };
+
+    void loadIndexLocked();
+    void wipeLocked();
+    bool pinnedLocked(const std::string& ratingKey) const;
+    bool makeRoomLocked(int64_t bytes);
+    void workerLoop();
+    void fetchTrack(const std::string& ratingKey);
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    int64_t m_totalBytes = 0;
+    uint64_t m_clock = 0;
+    bool m_indexLoaded = false;
+    std::string m_server;                       // server the files belong to
+    std::string m_current;                      // playing track: never evicted
+    std::vector<std::string> m_wanted;          // upcoming tracks, in play order
+    std::unordered_set<std::string> m_skipped;  // failed / not cacheable until m_wanted changes
+    std::string m_active;                       // being fetched
+    bool m_workerRunning = false;
+    std::atomic<bool> m_stopActive{false};      // m_active is no longer wanted
+    std::atomic<bool> m_holdOff{false};         // current track still opening
+};
+
+} // namespace vitaplex
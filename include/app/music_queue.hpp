@@ -64,6 +64,12 @@ public:
     bool playNext();                    // Play next track (respects repeat/shuffle)
     bool playPrevious();                // Play previous track
     bool hasNext() const;               // Check if there's a next track
+    // Queue index playNext() would move to, without moving; -1 at the end of
+    // the queue, and at the end of a shuffle with repeat-all (it reshuffles).
+    int peekNext() const;
+    // The next `count` queue indices in play order, as repeated playNext()
+    // calls would visit them (just the current track under repeat-one).
+    std::vector<int> peekUpcoming(int count) const;
     bool hasPrevious() const;           // Check if there's a previous track
 
     // Current state
@@ -91,6 +97,10 @@ public:
 
     // Notify that current track ended (called by player)
     void onTrackEnded();
+    // The queue half of onTrackEnded(): advance past the finished track
+    // (repeat/shuffle apply) without firing the callback, for when the player
+    // already moved on by itself. The new current track, or nullptr at the end.
+    const QueueItem* advanceAfterTrackEnded();
 
     // Queue changed callback (for UI updates)
     using QueueChangedCallback = std::function<void()>;
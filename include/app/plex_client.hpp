@@ -9,6 +9,8 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <atomic>
 #include <cstdint>
 
 namespace vitaplex {
@@ -46,11 +48,19 @@ struct MediaItem {
     float audienceRating = 0.0f;   // Plex audienceRating (RT popcorn / audience score, 0-10)
     std::string contentRating;
     std::string studio;
-    std::vector<std::string> genres;  // populated by fetchMediaDetails (detail view only)
+    std::vector<std::string> genres;  // fetchMediaDetails + library listings (LibraryQuery filters); cleared by trimForGrid
     bool watched = false;
     std::string librarySectionKey;  // numeric library section id (detail view; for "more by this person")
     std::string character;          // poster role badge text ("as Luke Skywalker" / "Director"); set for person-results only
 
+    // Sort keys, parsed from library listings (fetchLibraryContent) only.
+    // LibraryIndex persists them so a section can be re-sorted offline.
+    std::string titleSort;              // empty when Plex sorts by title as-is
+    std::string originallyAvailableAt;  // "YYYY-MM-DD"
+    int64_t addedAt = 0;                // epoch seconds (server clock)
+    int64_t updatedAt = 0;
+    int64_t lastViewedAt = 0;
+
     // For episodes
     std::string grandparentTitle;
     std::string parentTitle;
@@ -74,6 +84,7 @@ struct MediaItem {
     std::string streamUrl;
     std::string videoCodec;
     std::string audioCodec;
+    std::string videoResolution;   // Plex resolution bucket: "4k", "1080", "720", "sd", ...
     int videoWidth = 0;
     int videoHeight = 0;
 
@@ -125,6 +136,9 @@ struct MediaItem {
         // Cast/crew only used by the detail view
         cast.clear();
         cast.shrink_to_fit();
+        // Genre tags only feed the detail view and LibraryIndex
+        genres.clear();
+        genres.shrink_to_fit();
     }
 };
 
@@ -232,6 +246,30 @@ struct LiveTVChannel {
     std::vector<ChannelProgram> programs;  // All programs in EPG window, sorted by start time
 };
 
+// Live TV configuration discovered from GET /livetv/dvrs for the connected
+// server. Built whole by one probe and published as part of PlexSession.
+struct LiveTVConfig {
+    bool available = false;
+    std::string dvrId;                           // DVR ID (key), e.g. "28"
+    std::vector<std::string> deviceIds;          // "device://tv.plex.grabbers.hdhomerun/..."
+    std::string lineupUri;                       // "lineup://tv.plex.providers.epg.onconnect/..."
+    std::vector<ChannelMapping> channelMappings; // Channel mappings from DVR response
+    std::string epgProviderKey;                  // EPG provider key for grid queries
+};
+
+// Immutable snapshot of everything a request needs to reach the current
+// server: where it is, how to authorise, which server it is and its Live TV
+// setup. PlexClient swaps in a new snapshot whenever any of it changes;
+// requests take one at their start and use it throughout, so any number of
+// fetches can run on worker threads while a login / server switch happens.
+struct PlexSession {
+    std::string serverUrl;
+    std::string authToken;
+    PlexServer server;   // name / machineIdentifier / address of the connected server
+    LiveTVConfig liveTV;
+};
+using PlexSessionPtr = std::shared_ptr<const PlexSession>;
+
 // Genre/Category item with key for filtering
 struct GenreItem {
     std::string title;      // Display name
@@ -239,6 +277,14 @@ struct GenreItem {
     std::string fastKey;    // Fast filter URL path
 };
 
+// One A-Z bucket of a section listing (/library/sections/{key}/firstCharacter):
+// the bucket's title ("#", "A", ...) and how many items it holds. Returned
+// in the listing's title order, so running sums are each bucket's offset.
+struct FirstCharacter {
+    std::string title;
+    int size = 0;
+};
+
 // Playlist info (from Plex API)
 struct Playlist {
     std::string ratingKey;      // Playlist ID
@@ -329,6 +375,29 @@ public:
     bool fetchSectionRecentlyAdded(const std::string& sectionKey, std::vector<MediaItem>& items);
     bool fetchChildren(const std::string& ratingKey, std::vector<MediaItem>& items);
     bool fetchMediaDetails(const std::string& ratingKey, MediaItem& item);
+    // fetchMediaDetails served only from MetadataCache: never touches the
+    // network, so it is safe on the UI thread. False on a miss (`item` is
+    // then left as it was).
+    bool cachedMediaDetails(const std::string& ratingKey, MediaItem& item);
+    // fetchMediaDetails for many items at once: comma-separated
+    // /library/metadata/{k1,k2,...} requests of up to 25 keys, chunks fetched
+    // in parallel (up to platform::maxConcurrentNetworkRequests()). `items`
+    // follows the order of `ratingKeys`; keys the server didn't return are
+    // left out. False only when no chunk came back. Blocking — call from a
+    // worker; honours the caller's HttpCancelScope.
+    bool fetchMediaDetailsBatch(const std::vector<std::string>& ratingKeys,
+                                std::vector<MediaItem>& items);
+    // Every leaf (episode / track) under a show, season, artist or album in
+    // one paged /library/metadata/{id}/allLeaves walk instead of a
+    // fetchChildren per level. Leaves come with their Media/Part, so
+    // partPath / partSize are set as by fetchMediaDetails, and `watched`
+    // from viewCount. `onPage` gets each page on the calling thread as soon
+    // as it is parsed (the first one is small, so a player can start on it);
+    // return false to stop early. False when a request failed — pages
+    // before it were already delivered. Blocking — call from a worker.
+    bool fetchAllLeaves(const std::string& ratingKey,
+                        const std::function<bool(std::vector<MediaItem>&)>& onPage);
+    bool fetchAllLeaves(const std::string& ratingKey, std::vector<MediaItem>& items);
 
     // Music artist hubs (albums grouped by type: Albums, Singles, EPs, etc.)
     bool fetchArtistHubs(const std::string& ratingKey, std::vector<Hub>& hubs);
@@ -374,6 +443,10 @@ public:
     // studio, country, …) as title/key pairs. Each key feeds the matching
     // ?{field}={key} query. fetchGenreItems is just this with field="genre".
     bool fetchFilterValues(const std::string& sectionKey, const std::string& field, std::vector<GenreItem>& values);
+    // A-Z bucket sizes for a section, narrowed by the same filter fragment
+    // fetchLibraryContent takes (one request, whatever the section size).
+    bool fetchFirstCharacters(const std::string& sectionKey, std::vector<FirstCharacter>& buckets,
+                              int metadataType = 0, const std::string& extraParams = "");
     bool fetchByGenre(const std::string& sectionKey, const std::string& genre, std::vector<MediaItem>& items, int metadataType = 0);
     bool fetchByGenreKey(const std::string& sectionKey, const std::string& genreKey, std::vector<MediaItem>& items, int metadataType = 0);
 
@@ -391,12 +464,17 @@ public:
     bool movePlaylistItem(const std::string& playlistId, const std::string& playlistItemId, const std::string& afterItemId);
 
     // Get machine identifier for playlist URIs
-    const std::string& getMachineIdentifier() const { return m_currentServer.machineIdentifier; }
+    std::string getMachineIdentifier() const { return session()->server.machineIdentifier; }
 
     // Playback
     bool getPlaybackUrl(const std::string& ratingKey, std::string& url);
-    bool getTranscodeUrl(const std::string& ratingKey, std::string& url, int offsetMs = 0);
+    // With sessionIdOut the new transcode session is returned there instead
+    // of replacing the current one (gapless pre-resolve); adopt it once it plays.
+    bool getTranscodeUrl(const std::string& ratingKey, std::string& url, int offsetMs = 0,
+                         std::string* sessionIdOut = nullptr);
     void stopTranscode();  // Stop the current transcode session
+    void adoptTranscodeSession(const std::string& sessionId);  // make it the current one
+    void stopTranscodeSession(const std::string& sessionId);   // stop one that never became current
     bool updatePlayProgress(const std::string& ratingKey, int timeMs);
     bool reportTimeline(const std::string& ratingKey, const std::string& key,
                         const std::string& state, int timeMs, int durationMs,
@@ -500,7 +578,7 @@ public:
     bool tuneLiveTVChannel(const std::string& channelKey, std::string& streamUrl,
                            std::string& liveSessionUuid,
                            const std::string& programMetadataKey = "");
-    bool hasLiveTV() const { return m_hasLiveTV; }
+    bool hasLiveTV() const { return session()->liveTV.available; }
     // Blocking availability probe for worker threads: runs the (cached)
     // /livetv/dvrs check if it hasn't happened yet and returns the result.
     // Connect no longer probes eagerly, so callers that need a definitive
@@ -513,7 +591,7 @@ public:
     // the tune response; the resulting start.m3u8 URL is played like any other
     // transcoded video.
     bool buildLiveSessionStreamUrl(const std::string& liveSessionId, std::string& url);
-    std::string getEpgProviderKey() const { return m_epgProviderKey; }
+    std::string getEpgProviderKey() const { return session()->liveTV.epgProviderKey; }
 
     // Thumbnail URL
     std::string getThumbnailUrl(const std::string& thumb, int width = 300, int height = 450);
@@ -524,11 +602,16 @@ public:
     // Handle 401/unauthorized - clears auth state and triggers login redirect
     void handleUnauthorized();
 
+    // Current session snapshot. Never null; safe from any thread. Hold on to
+    // it for the duration of a multi-request operation instead of calling
+    // the getters below repeatedly.
+    PlexSessionPtr session() const;
+
     // Configuration
-    void setAuthToken(const std::string& token) { m_authToken = token; }
-    const std::string& getAuthToken() const { return m_authToken; }
-    void setServerUrl(const std::string& url) { m_serverUrl = url; }
-    const std::string& getServerUrl() const { return m_serverUrl; }
+    void setAuthToken(const std::string& token);
+    std::string getAuthToken() const { return session()->authToken; }
+    void setServerUrl(const std::string& url);
+    std::string getServerUrl() const { return session()->serverUrl; }
 
     // Public JSON helpers (used by play queue parsing helper)
     std::string extractJsonValuePublic(const std::string& json, const std::string& key) { return extractJsonValue(json, key); }
@@ -542,7 +625,15 @@ private:
     ~PlexClient() = default;
 
     std::string buildApiUrl(const std::string& endpoint);
+    static std::string buildApiUrl(const PlexSession& session, const std::string& endpoint);
+
+    // Copy the current session, apply `edit` to the copy and publish it.
+    // Writers are serialised; readers keep whichever snapshot they took.
+    void updateSession(const std::function<void(PlexSession&)>& edit);
+    bool fetchServersWithToken(const std::string& token, std::vector<PlexServer>& servers);
     MediaType parseMediaType(const std::string& typeStr);
+    // Fill `item` from one metadata object (or a response holding one).
+    void parseMediaDetails(const std::string& json, MediaItem& item);
     std::string extractJsonValue(const std::string& json, const std::string& key);
     int extractJsonInt(const std::string& json, const std::string& key);
     float extractJsonFloat(const std::string& json, const std::string& key);
@@ -557,28 +648,26 @@ private:
     int extractXmlAttr(const std::string& xml, const std::string& attr);
     std::string extractXmlAttrStr(const std::string& xml, const std::string& attr);
     void checkLiveTVAvailability();
+    // Current session, probing /livetv/dvrs first if it hasn't been yet.
+    PlexSessionPtr liveTVSession();
 
     // Returns true if status code is an auth error (401)
     bool isAuthError(int statusCode) const { return statusCode == 401; }
 
     // Track whether we already triggered reauth to avoid loops
-    bool m_reauthTriggered = false;
-
-    std::string m_authToken;
-    std::string m_serverUrl;
-    std::string m_lastSessionId;  // Last transcode session ID for stop/restart
-    // Live-TV bookkeeping for the rolling subscription keep-alive. Both are
-    // pulled out of the tune response and consumed by reportLiveTimeline so
-    // the /:/timeline ping uses the same ratingKey the server's parser is
-    // expecting (a stock ratingKey=0 makes it 404 and the keep-alive fails).
+    std::atomic<bool> m_reauthTriggered{false};
+
+    mutable std::mutex m_sessionMutex;   // guards the m_session pointer only
+    std::mutex m_sessionWriteMutex;      // serialises updateSession()
+    PlexSessionPtr m_session = std::make_shared<const PlexSession>();
+
+    // Per-playback bookkeeping, not part of the session: the last transcode
+    // session ID for stop/restart, and the live-TV ratingKey pulled out of
+    // the tune response for the rolling subscription keep-alive (a stock
+    // ratingKey=0 makes the /:/timeline ping 404 and the keep-alive fails).
+    std::mutex m_playbackMutex;
+    std::string m_lastSessionId;
     std::string m_lastLiveRatingKey;
-    PlexServer m_currentServer;
-    bool m_hasLiveTV = false;
-    std::string m_dvrId;  // DVR ID (key) from GET /livetv/dvrs
-    std::vector<std::string> m_deviceIds;  // Device UUIDs from DVR (e.g., "device://tv.plex.grabbers.hdhomerun/...")
-    std::string m_lineupUri;  // Lineup URI from DVR (e.g., "lineup://tv.plex.providers.epg.onconnect/...")
-    std::vector<ChannelMapping> m_channelMappings;  // Channel mappings from DVR response
-    std::string m_epgProviderKey;  // EPG provider key for grid queries (extracted from lineup URI)
 };
 
 } // namespace vitaplex
@@ -311,6 +311,43 @@ void launchThread(std::function<void()> task,
  */
 std::size_t maxConcurrentNetworkRequests();
 
+/**
+ * Byte budget for the in-memory metadata cache (app/metadata_cache.hpp):
+ * parsed detail / children / extras / related results kept so navigating
+ * back to a title doesn't refetch it. A cached episode with cast is a few
+ * KB, so even Vita's 2 MB holds several hundred titles; roomier platforms
+ * keep more.
+ */
+std::size_t metadataCacheBytes();
+
+/**
+ * Disk budget for the music read-ahead cache (app/music_prefetch.hpp): the
+ * next few queue tracks fetched while the current one plays. Original files
+ * run 5-40 MB a track, so Vita's memory card gets a smaller share.
+ */
+int64_t musicPrefetchBytes();
+
+/**
+ * Shape of the persistent worker pool behind asyncRun / asyncTask /
+ * asyncRunLargeStack (utils/task_pool.hpp). Workers are started lazily
+ * through launchThread(), so each one carries the same stack + TLS setup
+ * a per-task thread used to, and then lives for the rest of the process.
+ *
+ *   maxWorkers            cap on 512 KB-stack workers. The work is almost
+ *                         all blocking HTTP, so this tracks the network
+ *                         concurrency the platform sustains, not its cores.
+ *   maxLargeStackWorkers  cap on 1 MB-stack workers (asyncRunLargeStack).
+ *   workStealing          per-worker queues with idle workers stealing
+ *                         from busy ones; false = one shared FIFO, which
+ *                         is cheaper for a small fixed pool.
+ */
+struct WorkerPoolConfig {
+    std::size_t maxWorkers;
+    std::size_t maxLargeStackWorkers;
+    bool        workStealing;
+};
+WorkerPoolConfig workerPoolConfig();
+
 /**
  * Whether the platform exits the process via an SDK-specific call instead
  * of a normal `return` from main(). True on PSV (sceKernelExitProcess).
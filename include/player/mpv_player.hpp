@@ -9,8 +9,11 @@
 #include <vector>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <cstdint>
 
 #include "app/application.hpp"
+#include "utils/mpsc_queue.hpp"
 
 #if defined(__vita__)
 #include <mpv/client.h>
@@ -67,6 +70,12 @@ struct MpvPlaybackInfo {
 
 /**
  * MPV-based video player with GXM rendering support on Vita
+ *
+ * mpv's events are read on a dedicated event thread. State transitions go to
+ * the UI thread through a lock-free queue; high-rate properties (position,
+ * duration, cache, seeking, volume) are coalesced into atomics and copied
+ * into the playback info once per update(). Everything except getPosition()
+ * / getDuration() is UI-thread only.
  */
 class MpvPlayer {
 public:
@@ -80,6 +89,17 @@ public:
     // Playback control
     bool loadUrl(const std::string& url, const std::string& title = "");
     bool loadFile(const std::string& path);
+
+    // Gapless hand-off (audio only): queue `url` in mpv's playlist to start
+    // the moment the current file ends, opened ahead of time (prefetch-
+    // playlist). Holds one entry; appending again replaces it. The end of
+    // the current file then isn't reported as ENDED — getAdvanceCount()
+    // goes up instead. loadUrl() and stop() drop the entry.
+    bool appendUrl(const std::string& url, const std::string& title = "");
+    void clearAppended();
+    bool hasAppended() const { return !m_appendedUrl.empty(); }
+    // Bumped each time playback moved on to an appended entry by itself.
+    uint32_t getAdvanceCount() const { return m_advanceCount; }
     void play();
     void pause();
     void togglePause();
@@ -139,7 +159,8 @@ public:
     bool hasEnded() const { return m_state == MpvPlayerState::ENDED; }
     bool hasError() const { return m_state == MpvPlayerState::ERROR; }
 
-    // Info
+    // Info. Position/duration are the latest values mpv reported and are safe
+    // from any thread; getPlaybackInfo() is the snapshot taken by update().
     double getPosition() const;
     double getDuration() const;
     double getPercentPosition() const;
@@ -194,12 +215,57 @@ private:
     MpvPlayer(const MpvPlayer&) = delete;
     MpvPlayer& operator=(const MpvPlayer&) = delete;
 
+    // A state-changing mpv event, reduced to what the UI thread needs.
+    struct PlayerEvent {
+        enum class Kind : uint8_t {
+            NONE,
+            SHUTDOWN,
+            START_FILE,
+            FILE_LOADED,
+            PLAYBACK_RESTART,   // flag: paused
+            END_FILE,           // reason, error
+            IDLE,
+            LOAD_FAILED,        // error
+            PAUSE,              // flag: paused
+            PAUSED_FOR_CACHE,   // flag: buffering
+            EOF_REACHED,
+            APPEND_FAILED,      // error
+        };
+        Kind kind = Kind::NONE;
+        bool flag = false;
+        int reason = 0;
+        int error = 0;
+    };
+
+    // Latest values of the high-rate observed properties. Written by whichever
+    // thread reads mpv's events, read by anyone; never queued.
+    struct LiveProperties {
+        std::atomic<double> position{0.0};
+        std::atomic<double> duration{0.0};
+        std::atomic<double> cacheUsed{0.0};
+        std::atomic<int> volume{100};
+        std::atomic<bool> seeking{false};
+        std::atomic<bool> buffering{false};
+
+        void reset() {
+            position.store(0.0);
+            duration.store(0.0);
+            cacheUsed.store(0.0);
+            seeking.store(false);
+            buffering.store(false);
+        }
+    };
+
     bool initRenderContext();
     void cleanupRenderContext();
+    void startEventThread();
+    void stopEventThread();
+    void eventThreadLoop(mpv_handle* mpv);
     void eventMainLoop();
+    bool translateEvent(mpv_event* event, PlayerEvent& out);
+    bool translatePropertyChange(mpv_event_property* prop, uint64_t id, PlayerEvent& out);
+    void applyEvent(const PlayerEvent& event);
     void updatePlaybackInfo();
-    void handleEvent(mpv_event* event);
-    void handlePropertyChange(mpv_event_property* prop, uint64_t id);
     void setState(MpvPlayerState newState);
 
     mpv_handle* m_mpv = nullptr;
@@ -208,11 +274,24 @@ private:
     MpvPlaybackInfo m_playbackInfo;
     std::string m_errorMessage;
     std::string m_currentUrl;
+    std::string m_appendedUrl;      // entry queued by appendUrl(), if any
+    std::string m_appendedTitle;
+    bool m_advancing = false;       // END_FILE seen, appended entry starts next
+    uint32_t m_advanceCount = 0;
     bool m_subtitlesVisible = true;
     std::atomic<bool> m_stopping{false};        // Shutdown in progress (accessed from mpv thread)
     bool m_commandPending = false;  // Async command pending
     bool m_audioOnly = false;       // Audio-only mode (no video decoding)
 
+    // mpv event thread -> UI thread. 64 covers a file change's burst of
+    // events; a full ring just makes the event thread wait for the next frame.
+    MpscQueue<PlayerEvent, 64> m_events;
+    LiveProperties m_live;
+    bool m_eventThread = false;           // false: update() polls mpv itself
+    std::mutex m_eventThreadMutex;
+    std::condition_variable m_eventThreadExit;
+    bool m_eventThreadRunning = false;    // guarded by m_eventThreadMutex
+
     // Static callback for render updates (called from MPV thread)
     static void onRenderUpdate(void* ctx);
 
@@ -2,22 +2,50 @@
  * VitaPlex - Async utilities
  * Simple async task execution with UI thread callbacks.
  *
- * Every helper here routes through platform::launchThread() rather than
- * std::thread().detach() directly. The Switch's newlib std::thread shim
- * doesn't always register the thread's stack region with the kernel or
- * initialize TLS — a detached thread launched that way crashes with an
- * Atmosphère Instruction Abort (PC at a page boundary, TLS dump zeroed)
- * the first time it indirect-calls through a std::function or vtable.
- * platform::launchThread() routes through pthread_create with explicit
- * attrs on Switch/PSV/PS4 (kernel-managed stack + TLS) and stays on
- * std::thread on Desktop/Android/iOS where bare detach is fine.
+ * Every thread behind these helpers is started by platform::launchThread()
+ * rather than std::thread().detach() directly. The Switch's newlib
+ * std::thread shim doesn't always register the thread's stack region with
+ * the kernel or initialize TLS — a detached thread launched that way
+ * crashes with an Atmosphère Instruction Abort (PC at a page boundary, TLS
+ * dump zeroed) the first time it indirect-calls through a std::function or
+ * vtable. platform::launchThread() routes through pthread_create with
+ * explicit attrs on Switch/PSV/PS4 (kernel-managed stack + TLS) and stays
+ * on std::thread on Desktop/Android/iOS where bare detach is fine.
+ *
+ * asyncTask / asyncRun / asyncRunLargeStack no longer start a thread per
+ * call: they queue onto the persistent TaskPool (utils/task_pool.hpp),
+ * whose workers were themselves started through launchThread(), so the
+ * guarantees above hold for every task. Tasks that never finish (polling
+ * loops, long-lived workers) must use asyncRunDedicated() instead, or
+ * they'd pin a pool worker for good.
+ *
+ * Task<T> (below) is the structured form for screens that fan out several
+ * fetches: results chain with then(), join with whenAll()/whenAny(), land
+ * on the UI thread with onUI(), and a TaskScope owned by the view cancels
+ * everything it started — including the curl transfers in flight — when
+ * the view goes away.
+ *
+ * UI-thread callbacks go through brls::Application::post() rather than
+ * brls::sync(): they run under the per-frame task budget (so a burst of
+ * completions spreads over several frames) and mark the frame dirty, so
+ * results show up under redraw-on-demand even when the callback only
+ * swaps data a view paints from.
  */
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <borealis.hpp>
 #include "platform/platform.hpp"
+#include "utils/http_client.hpp"
+#include "utils/task_pool.hpp"
 
 namespace vitaplex {
 
@@ -29,9 +57,9 @@ namespace vitaplex {
  */
 template<typename T>
 inline void asyncTask(std::function<T()> task, std::function<void(T)> callback) {
-    platform::launchThread([task, callback]() {
+    TaskPool::submit([task, callback]() {
         T result = task();
-        brls::sync([callback, result]() {
+        brls::Application::post([callback, result]() {
             callback(result);
         });
     });
@@ -44,9 +72,9 @@ inline void asyncTask(std::function<T()> task, std::function<void(T)> callback)
  * @param callback Called on UI thread when task completes
  */
 inline void asyncTask(std::function<void()> task, std::function<void()> callback) {
-    platform::launchThread([task, callback]() {
+    TaskPool::submit([task, callback]() {
         task();
-        brls::sync([callback]() {
+        brls::Application::post([callback]() {
             callback();
         });
     });
@@ -58,21 +86,311 @@ inline void asyncTask(std::function<void()> task, std::function<void()> callback
  * @param task The task to run in background
  */
 inline void asyncRun(std::function<void()> task) {
-    platform::launchThread(std::move(task));
+    TaskPool::submit(std::move(task));
 }
 
 /**
  * Execute a task asynchronously with a larger stack size.
- * Use for heavy work like downloads that have deep call stacks.
+ * Use for heavy work with deep call stacks (curl, HLS, big parsers).
+ *
+ * @param task The task to run in background
+ * @param stackSize Stack the task needs, in bytes (default 1 MB). Picks the
+ *                  smallest pool stack class that fits; anything bigger
+ *                  than the large class gets a dedicated thread. Only
+ *                  Switch/PSV/PS4 honor stack sizes at all.
+ */
+inline void asyncRunLargeStack(std::function<void()> task,
+                               std::size_t stackSize = 1024 * 1024) {
+    if (stackSize <= TaskPool::stackBytes(StackClass::STANDARD))
+        TaskPool::submit(std::move(task), StackClass::STANDARD);
+    else if (stackSize <= TaskPool::stackBytes(StackClass::LARGE))
+        TaskPool::submit(std::move(task), StackClass::LARGE);
+    else
+        platform::launchThread(std::move(task), stackSize);
+}
+
+/**
+ * Run a long-lived task on its own thread instead of the pool: worker
+ * loops, polling loops, sessions — anything that returns only when its
+ * owner tells it to.
  *
  * @param task The task to run in background
  * @param stackSize Stack size in bytes (default 512KB). Honored on
  *                  Switch/PSV/PS4; ignored on Desktop/Android/iOS where
  *                  std::thread already gets a generous default.
  */
-inline void asyncRunLargeStack(std::function<void()> task,
-                               std::size_t stackSize = 512 * 1024) {
+inline void asyncRunDedicated(std::function<void()> task,
+                              std::size_t stackSize = 512 * 1024) {
     platform::launchThread(std::move(task), stackSize);
 }
 
+// ─── Structured tasks ───────────────────────────────────────────────────
+
+namespace detail {
+
+// Cancellation tree. Cancelling a node cancels every node linked under it;
+// a node linked under an already-cancelled parent is cancelled on the spot.
+struct CancelNode {
+    std::atomic<bool> cancelled{false};
+    std::mutex mutex;
+    std::vector<std::weak_ptr<CancelNode>> children;
+
+    void cancel() {
+        if (cancelled.exchange(true)) return;
+        std::vector<std::weak_ptr<CancelNode>> kids;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            kids.swap(children);
+        }
+        for (auto& weak : kids)
+            if (auto child = weak.lock()) child->cancel();
+    }
+
+    void link(const std::shared_ptr<CancelNode>& child) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!cancelled.load()) {
+                // Drop finished tasks so a long-lived scope doesn't grow.
+                children.erase(std::remove_if(children.begin(), children.end(),
+                    [](const std::weak_ptr<CancelNode>& w) { return w.expired(); }),
+                    children.end());
+                children.push_back(child);
+                return;
+            }
+        }
+        child->cancel();
+    }
+
+    // The node's flag in the form HttpRequest / HttpCancelScope take; keeps
+    // the node alive for as long as a request holds it.
+    static HttpCancelFlag flagOf(const std::shared_ptr<CancelNode>& node) {
+        return HttpCancelFlag(node, &node->cancelled);
+    }
+};
+
+template <typename T>
+struct TaskState {
+    std::shared_ptr<CancelNode> cancel = std::make_shared<CancelNode>();
+    std::mutex mutex;
+    bool done = false;
+    bool ok = false;   // completed, and not cancelled
+    T value{};
+    std::vector<std::function<void()>> continuations;
+
+    void complete(bool success, T result) {
+        std::vector<std::function<void()>> conts;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (done) return;
+            done = true;
+            ok = success && !cancel->cancelled.load();
+            if (ok) value = std::move(result);
+            conts.swap(continuations);
+        }
+        for (auto& c : conts) c();
+    }
+
+    // Run `fn` once the task has completed (right away if it already has),
+    // on whichever thread completes it.
+    void onDone(std::function<void()> fn) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!done) {
+                continuations.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+};
+
+// Run `fn` on the pool under the state's cancel flag. A task cancelled
+// while still queued never starts.
+template <typename T, typename F>
+void runOnPool(std::shared_ptr<TaskState<T>> state, F fn) {
+    TaskPool::submit([state, fn]() mutable {
+        if (state->cancel->cancelled.load()) {
+            state->complete(false, T{});
+            return;
+        }
+        HttpCancelScope scope(CancelNode::flagOf(state->cancel));
+        state->complete(true, fn());
+    });
+}
+
+} // namespace detail
+
+class TaskScope;
+
+/**
+ * Handle to a background result of type T (default-constructible and
+ * copyable — the fetch results used across the app all are). Copies share
+ * the same task. Continuations registered after completion run at once.
+ *
+ * A cancelled task completes without a value: then() continuations are
+ * skipped (and cancelled in turn), onUI() callbacks never run, and any HTTP
+ * request issued from its body aborts mid-transfer.
+ */
+template <typename T>
+class Task {
+public:
+    using Value = T;
+
+    // Start `fn` on the worker pool.
+    template <typename F>
+    static Task run(F fn) {
+        Task task;
+        detail::runOnPool(task.m_state, std::move(fn));
+        return task;
+    }
+
+    // Chain `fn(const T&)` on the pool once this task has its value. The new
+    // task shares this one's cancellation: cancelling either stops the chain.
+    template <typename F>
+    auto then(F fn) const -> Task<std::decay_t<decltype(fn(std::declval<const T&>()))>> {
+        using U = std::decay_t<decltype(fn(std::declval<const T&>()))>;
+        Task<U> next;
+        next.m_state->cancel = m_state->cancel;
+        auto self = m_state;
+        auto out  = next.m_state;
+        m_state->onDone([self, out, fn]() {
+            if (!self->ok) {
+                out->complete(false, U{});
+                return;
+            }
+            detail::runOnPool(out, [self, fn]() { return fn(self->value); });
+        });
+        return next;
+    }
+
+    // Hand the value to `fn` on the UI thread (via Application::post) if the
+    // task completed and nothing has cancelled it by the time it's delivered.
+    // Cancelling from the UI thread therefore guarantees `fn` won't run —
+    // no separate alive flag needed.
+    const Task& onUI(std::function<void(const T&)> fn,
+                     brls::Application::TaskPriority priority =
+                         brls::Application::TaskPriority::NORMAL) const {
+        auto self = m_state;
+        m_state->onDone([self, fn, priority]() {
+            if (!self->ok) return;
+            brls::Application::post([self, fn]() {
+                if (self->cancel->cancelled.load()) return;
+                fn(self->value);
+            }, priority);
+        });
+        return *this;
+    }
+
+    void cancel() const { m_state->cancel->cancel(); }
+    bool isCancelled() const { return m_state->cancel->cancelled.load(); }
+
+private:
+    template <typename> friend class Task;
+    template <typename U>
+    friend Task<std::vector<U>> whenAll(TaskScope&, const std::vector<Task<U>>&);
+    template <typename U> friend Task<U> whenAny(TaskScope&, const std::vector<Task<U>>&);
+    friend class TaskScope;
+
+    std::shared_ptr<detail::TaskState<T>> m_state = std::make_shared<detail::TaskState<T>>();
+};
+
+/**
+ * Owner of a view's tasks. Everything started through run() is cancelled
+ * by cancelAll() or when the scope is destroyed — put one in the view as a
+ * member and its pending onUI() callbacks can't outlive it. UI thread only.
+ */
+class TaskScope {
+public:
+    TaskScope() = default;
+    ~TaskScope() { cancelAll(); }
+    TaskScope(const TaskScope&) = delete;
+    TaskScope& operator=(const TaskScope&) = delete;
+
+    template <typename F>
+    auto run(F fn) -> Task<std::decay_t<decltype(fn())>> {
+        using T = std::decay_t<decltype(fn())>;
+        Task<T> task;
+        m_root->link(task.m_state->cancel);
+        detail::runOnPool(task.m_state, std::move(fn));
+        return task;
+    }
+
+    // Cancel everything started so far; tasks started afterwards run normally.
+    void cancelAll() {
+        m_root->cancel();
+        m_root = std::make_shared<detail::CancelNode>();
+    }
+
+private:
+    template <typename U>
+    friend Task<std::vector<U>> whenAll(TaskScope&, const std::vector<Task<U>>&);
+    template <typename U> friend Task<U> whenAny(TaskScope&, const std::vector<Task<U>>&);
+
+    std::shared_ptr<detail::CancelNode> m_root = std::make_shared<detail::CancelNode>();
+};
+
+/**
+ * Completes with every task's value, in input order, once all have. If any
+ * input is cancelled the result is too; cancelling the result cancels all
+ * inputs still running. The result belongs to `scope` like a task started
+ * with scope.run(): cancelAll() reaches it, and its onUI() callbacks.
+ */
+template <typename T>
+Task<std::vector<T>> whenAll(TaskScope& scope, const std::vector<Task<T>>& tasks) {
+    Task<std::vector<T>> all;
+    auto out = all.m_state;
+    scope.m_root->link(out->cancel);
+    if (tasks.empty()) {
+        out->complete(true, {});
+        return all;
+    }
+    for (const auto& t : tasks) out->cancel->link(t.m_state->cancel);
+
+    auto remaining = std::make_shared<std::atomic<size_t>>(tasks.size());
+    std::vector<std::shared_ptr<detail::TaskState<T>>> states;
+    for (const auto& t : tasks) states.push_back(t.m_state);
+    for (const auto& state : states) {
+        state->onDone([out, states, remaining]() {
+            if (remaining->fetch_sub(1) != 1) return;
+            std::vector<T> values;
+            values.reserve(states.size());
+            bool ok = true;
+            for (const auto& s : states) {
+                ok = ok && s->ok;
+                values.push_back(s->value);
+            }
+            out->complete(ok, std::move(values));
+        });
+    }
+    return all;
+}
+
+/**
+ * Completes with the first input to finish successfully (cancelled inputs
+ * don't count); cancelled only if every input is. The others keep running
+ * — cancel them explicitly if their results are no longer wanted. Owned by
+ * `scope`, as whenAll().
+ */
+template <typename T>
+Task<T> whenAny(TaskScope& scope, const std::vector<Task<T>>& tasks) {
+    Task<T> any;
+    auto out = any.m_state;
+    scope.m_root->link(out->cancel);
+    if (tasks.empty()) {
+        out->complete(false, T{});
+        return any;
+    }
+    for (const auto& t : tasks) out->cancel->link(t.m_state->cancel);
+
+    auto remaining = std::make_shared<std::atomic<size_t>>(tasks.size());
+    for (const auto& t : tasks) {
+        auto state = t.m_state;
+        state->onDone([out, state, remaining]() {
+            if (state->ok) out->complete(true, state->value);  // first wins
+            if (remaining->fetch_sub(1) == 1) out->complete(false, T{});
+        });
+    }
+    return any;
+}
+
 } // namespace vitaplex
@@ -7,7 +7,9 @@
 
 #include <string>
 #include <map>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <cstdint>
 
 namespace vitaplex {
@@ -27,6 +29,28 @@ struct HttpResponse {
     bool success = false;
 };
 
+// Cancellation flag for in-flight requests: once it reads true, a transfer
+// using it aborts at curl's next progress tick and request() returns an
+// unsuccessful response with error "cancelled".
+using HttpCancelFlag = std::shared_ptr<std::atomic<bool>>;
+
+// Makes `flag` the ambient cancellation for every request() issued on this
+// thread while the scope lives — how a cancelled background task reaches the
+// HttpClient calls buried inside PlexClient without threading a flag through
+// every fetch signature. Scopes nest; the innermost wins.
+class HttpCancelScope {
+public:
+    explicit HttpCancelScope(HttpCancelFlag flag);
+    ~HttpCancelScope();
+    HttpCancelScope(const HttpCancelScope&) = delete;
+    HttpCancelScope& operator=(const HttpCancelScope&) = delete;
+
+    static HttpCancelFlag current();
+
+private:
+    HttpCancelFlag m_previous;
+};
+
 // HTTP request configuration
 struct HttpRequest {
     std::string url;
@@ -45,6 +69,10 @@ struct HttpRequest {
     // immediately but the server holds the chunked stream open for the life
     // of the recording, so a normal read blocks until the request times out).
     bool stopAtJsonClose = false;
+
+    // Abort the transfer when this flips true. Unset = the thread's
+    // HttpCancelScope, if any.
+    HttpCancelFlag cancel;
 };
 
 /**
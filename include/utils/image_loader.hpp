@@ -13,6 +13,7 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace vitaplex {
 
@@ -41,6 +42,12 @@ public:
     static void loadCoverAsync(const std::string& url, CoverCallback callback,
                                std::shared_ptr<std::atomic<bool>> alive);
 
+    // Worker thread, blocking. Fetch `url` into the cache without decoding
+    // it, so a later loadAsync / loadCoverAsync for the same URL is a cache
+    // hit. No-op if it is already cached or loading is paused. Honours the
+    // calling thread's HttpCancelScope.
+    static void prefetch(const std::string& url);
+
     // Load image synchronously from a local file path into a brls::Image.
     // Returns true on success.
     static bool loadFromFile(const std::string& path, brls::Image* target);
@@ -74,6 +81,9 @@ private:
     static std::atomic<uint64_t> s_generation;
     static std::atomic<bool> s_paused;
 
+    // Insert (or promote) `url`, evicting the least recently used entries.
+    static void storeInCache(const std::string& url, const std::vector<uint8_t>& data);
+
     // Max cached images. Platform-driven: ~20 on Vita (tight RAM),
     // ~60 on Switch/Android, ~120 on desktop/PS4.
     static size_t getMaxCacheSize();
@@ -0,0 +1,99 @@
+/**
+ * VitaPlex - Bounded lock-free MPSC queue
+ * Hand-off between threads that produce events (mpv's event thread, network
+ * workers) and the one thread that consumes them, usually the UI thread.
+ *
+ * Fixed ring of Capacity cells, each stamped with a sequence number
+ * (Vyukov's bounded queue). Producers claim a slot with one CAS on the tail
+ * and publish it with a release store; the consumer never writes anything a
+ * producer spins on except the cell it just emptied. Neither side takes a
+ * lock or allocates, so a frame draining the queue never waits on the
+ * decoder and the decoder never waits on a slow frame — when the ring is
+ * full tryPush() fails and the producer decides whether to back off or drop.
+ *
+ * Only carry discrete events here. Values that change every few ms
+ * (playback position, cache fill) should be coalesced into atomics by the
+ * producer and read once per frame instead of being queued.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace vitaplex {
+
+template <typename T, std::size_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "MpscQueue capacity must be a power of two");
+
+public:
+    MpscQueue() {
+        for (std::size_t i = 0; i < Capacity; i++)
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Any thread. False when the ring is full; `value` is left untouched.
+    bool tryPush(T& value) {
+        std::size_t pos = m_tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & kMask];
+            const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;  // consumer hasn't freed this cell yet
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);  // lost the race
+            }
+        }
+        cell->value = std::move(value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(T&& value) { return tryPush(value); }
+
+    // Consumer thread only.
+    bool tryPop(T& out) {
+        Cell& cell = m_cells[m_head & kMask];
+        const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(m_head + 1) < 0) return false;
+        out = std::move(cell.value);
+        cell.seq.store(m_head + Capacity, std::memory_order_release);
+        m_head++;
+        return true;
+    }
+
+    // Consumer thread only. Drops everything currently queued.
+    void clear() {
+        T discard;
+        while (tryPop(discard)) {}
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    struct Cell {
+        std::atomic<std::size_t> seq{0};
+        T value{};
+    };
+
+    // Producers hammer the tail, the consumer owns the head; keep them on
+    // separate cache lines.
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    alignas(64) std::size_t m_head = 0;
+    std::array<Cell, Capacity> m_cells;
+};
+
+} // namespace vitaplex
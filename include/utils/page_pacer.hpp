@@ -0,0 +1,47 @@
+/**
+ * Adaptive page sizing for paged grids.
+ *
+ * The platform's ImageConstraints::libraryPageSize is a fixed figure picked
+ * for the device's RAM; it knows nothing about the link. PagePacer keeps a
+ * running per-item cost of the two halves of a page load — the fetch on the
+ * worker (request + JSON parse) and the cell build on the UI thread — and
+ * sizes the next page so it arrives within kTargetFetchUsec and appends
+ * within kBuildBudgetUsec, clamped to [half, twice] the platform size so a
+ * fast link can't grow pages past what the device can hold.
+ *
+ * A high-latency link makes small pages look expensive per item, so pages
+ * grow there; a slow link makes every item expensive, so they shrink and
+ * the first rows land sooner. The same estimates tell RecyclingGrid how far
+ * ahead of the viewport it has to ask for the next page (setPrefetchLead)
+ * for it to be there before the user scrolls into it.
+ *
+ * Process-wide and UI-thread only: the link is shared by every section, so
+ * what one grid learned carries over to the next one opened. Workers time
+ * their fetch and hand the figure to the UI callback that records it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vitaplex {
+
+class PagePacer {
+public:
+    // A page of `items` took `usec` to fetch and parse on a worker.
+    static void recordFetch(size_t items, int64_t usec);
+    // A page of `items` took `usec` to turn into cells on the UI thread.
+    static void recordBuild(size_t items, int64_t usec);
+
+    // Items to request next: a multiple of `columns` between half and twice
+    // `baseSize` (the platform page size). `baseSize` until anything has been
+    // measured.
+    static size_t pageSize(size_t baseSize, size_t columns);
+
+    // Expected time for a page of `items` to arrive / to be appended.
+    static int64_t fetchUsec(size_t items);
+    static int64_t buildUsec(size_t items);
+};
+
+} // namespace vitaplex
@@ -0,0 +1,44 @@
+/**
+ * VitaPlex - Background task pool
+ * Persistent worker threads behind asyncRun / asyncTask /
+ * asyncRunLargeStack, replacing one pthread_create per task.
+ *
+ * Workers are started lazily through platform::launchThread(), so every
+ * worker gets exactly the stack + TLS setup a per-task thread used to (see
+ * the Switch note in utils/async.hpp) — the pool only changes how many
+ * times that setup is paid for. Sizing and queue shape come from
+ * platform::workerPoolConfig(): per-worker queues with stealing on
+ * multi-core targets, one shared FIFO for Vita's small fixed pool.
+ *
+ * Pool workers are shared, so tasks must finish. Anything that loops for
+ * the life of a screen or the app (download worker, polling loops,
+ * websocket sessions) belongs on its own thread via asyncRunDedicated().
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace vitaplex {
+
+// Stack a pooled task needs. Each class is a separate set of workers.
+enum class StackClass {
+    STANDARD,   // 512 KB — what launchThread() gives a plain task
+    LARGE,      // 1 MB — deep curl / HLS / parser call chains
+};
+
+class TaskPool {
+public:
+    static std::size_t stackBytes(StackClass cls);
+
+    // Queue `task` on a worker of the given stack class. Never blocks on
+    // the task; safe to call from any thread, including a pool worker.
+    static void submit(std::function<void()> task,
+                       StackClass cls = StackClass::STANDARD);
+
+    // Tasks queued but not yet started, across both classes.
+    static std::size_t pendingCount();
+};
+
+} // namespace vitaplex
@@ -0,0 +1,36 @@
+/**
+ * VitaPlex - Detail prefetcher
+ * Warms MetadataCache and ImageLoader for the cell the user is resting on,
+ * so the MediaDetailView it opens usually has its full details and poster
+ * on the first frame instead of a beat later.
+ *
+ * A cell that keeps focus for kDwellMs starts one background task: the
+ * fetchMediaDetails that loadDetails() would make, then the detail poster
+ * at the size the page asks for. Moving focus cancels the dwell timer, and
+ * the next cell to gain focus cancels the task (its HTTP request aborts
+ * mid-transfer); opening the item leaves it running. Scrolling through a row
+ * therefore fetches nothing; resting on one cell after another is limited
+ * by a small token bucket, and nothing starts while the worker pool has
+ * real work queued or images are paused for playback.
+ *
+ * Only items that open a detail page (movies, shows, seasons, artists,
+ * albums) are prefetched. UI thread only.
+ */
+
+#pragma once
+
+#include "app/plex_client.hpp"
+
+namespace vitaplex {
+
+class DetailPrefetcher {
+public:
+    // A cell showing `item` gained focus: arm the dwell timer for it.
+    static void onFocus(const MediaItem& item);
+
+    // Focus left the cell: drop the timer. A prefetch already in flight
+    // keeps going (the cell may have been opened); the next onFocus cancels it.
+    static void onBlur();
+};
+
+} // namespace vitaplex
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <vector>
 #include "app/plex_client.hpp"
+#include "utils/async.hpp"
 #include "view/recycling_grid.hpp"
 #include "view/horizontal_scroll_row.hpp"
 
@@ -32,6 +33,20 @@ public:
 private:
     void loadContent();
     void loadRecentChannels();          // Live TV "Recent Channels" rail
+
+    // Recently Added: one /recentlyAdded fetch per visible section, at most
+    // platform::maxConcurrentNetworkRequests() in flight, started in section
+    // order. A rail is populated as soon as every section of its type has
+    // answered, so Movies doesn't wait on a slow music library.
+    struct SectionFetch {
+        LibrarySection section;
+        bool done = false;
+        std::vector<MediaItem> items;
+    };
+    void loadRecentlyAdded();
+    void startSectionFetches();
+    void onSectionFetched(size_t index, const std::vector<MediaItem>& items);
+    void populateRecentRail(const std::string& sectionType);
     void onItemSelected(const MediaItem& item);
 
     // Section header: gold accent rect + title. Returns the row Box.
@@ -40,6 +55,16 @@ private:
     // Helper to create a media row with horizontal scrolling
     HorizontalScrollRow* createMediaRow();
     void populateRow(HorizontalScrollRow* row, const std::vector<MediaItem>& items, bool directPlay = false);
+    // Show `items` in `row` unless it already shows the same thing; `shown`
+    // is the row's backing vector. Used for both the snapshot and fresh data,
+    // so a refresh that changes nothing leaves the cells (and focus) alone.
+    void updateRow(HorizontalScrollRow* row, std::vector<MediaItem>& shown,
+                   const std::vector<MediaItem>& items, bool directPlay = false);
+    // Paint the last saved Home (app/home_snapshot.hpp) while loadContent()
+    // fetches the real one.
+    void showSnapshot();
+    // One rail got fresh data; once all four have, store a new snapshot.
+    void markRailFresh(unsigned rail);
     void populateChannelRow();          // build channel cells into m_recentChannelsRow
     void tuneChannel(const LiveTVChannel& channel);  // same tune path as the Live TV tab
 
@@ -72,6 +97,20 @@ private:
     std::vector<LiveTVChannel> m_recentChannels;
     bool m_loaded = false;
 
+    // Rails refreshed by the current loadContent(), one bit each.
+    enum : unsigned {
+        kRailContinue = 1, kRailMovies = 2, kRailShows = 4, kRailMusic = 8,
+        kRailsAll = 15,
+    };
+    unsigned m_freshRails = 0;
+
+    std::vector<SectionFetch> m_sectionFetches;
+    size_t m_nextSectionFetch = 0;
+    size_t m_sectionFetchesInFlight = 0;
+    // Continue Watching and the Recently Added fan-out. Cancelled when the
+    // tab disappears, which also aborts the transfers still running.
+    TaskScope m_tasks;
+
     // Alive flag for crash prevention on quick tab switching
     std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
     // ImageLoader needs an atomic flag; recycled per-build of the channel row so
@@ -0,0 +1,84 @@
+/**
+ * VitaPlex - Lazy Tab
+ * Deferred construction for sidebar tabs, plus the small per-tab state
+ * snapshots that let a torn-down tab come back where the user left it.
+ */
+
+#pragma once
+
+#include <borealis.hpp>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace vitaplex {
+
+// Placeholder handed to TabFrame in place of the real tab. TabFrame calls a
+// tab's creator on every sidebar focus change and frees the previous tab, so
+// scrolling the sidebar from Home to Settings used to construct (and start
+// network loads for) every tab in between. LazyTab only runs the creator
+// once the sidebar has rested on its item for DWELL_MS, or immediately when
+// focus moves into the content area — whichever comes first.
+class LazyTab : public brls::Box {
+public:
+    using Creator = std::function<brls::View*()>;
+
+    static constexpr long DWELL_MS = 250;
+
+    explicit LazyTab(Creator creator);
+    ~LazyTab() override;
+
+    brls::View* getDefaultFocus() override;
+
+private:
+    void materialize();
+
+    Creator m_creator;
+    brls::View* m_content = nullptr;
+    std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
+};
+
+// Small state snapshots for tabs whose view trees are gone (TabFrame frees a
+// tab as soon as another one is picked). A tab saves one in willDisappear(),
+// while its tree is still laid out (LibrarySectionTab, LiveTVTab), and takes
+// it back on construction. Snapshots are the idle policy: a tab not
+// visited for STALE_AFTER_SEC starts fresh, and only the CAPACITY most
+// recently left tabs are remembered at all. UI thread only.
+template <typename State>
+class TabStateCache {
+public:
+    static constexpr time_t STALE_AFTER_SEC = 10 * 60;
+    static constexpr size_t CAPACITY = 8;
+
+    void put(const std::string& key, State state) {
+        m_entries[key] = Entry{std::move(state), time(nullptr)};
+        while (m_entries.size() > CAPACITY) {
+            auto oldest = m_entries.begin();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+                if (it->second.savedAt < oldest->second.savedAt) oldest = it;
+            m_entries.erase(oldest);
+        }
+    }
+
+    // Moves the snapshot for `key` into `out`. False if there is none or it
+    // has gone stale (stale entries are dropped either way).
+    bool take(const std::string& key, State& out) {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) return false;
+        const bool fresh = time(nullptr) - it->second.savedAt <= STALE_AFTER_SEC;
+        if (fresh) out = std::move(it->second.state);
+        m_entries.erase(it);
+        return fresh;
+    }
+
+private:
+    struct Entry {
+        State state;
+        time_t savedAt = 0;
+    };
+    std::map<std::string, Entry> m_entries;
+};
+
+} // namespace vitaplex
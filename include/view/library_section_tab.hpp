@@ -13,7 +13,9 @@
 #include <string>
 #include <utility>
 #include "app/plex_client.hpp"
+#include "app/library_query.hpp"
 #include "view/recycling_grid.hpp"
+#include "view/lazy_tab.hpp"
 
 namespace vitaplex {
 
@@ -83,14 +85,19 @@ private:
     void showMultiSelect(const std::string& field, const std::string& fieldLabel,
                          const std::vector<GenreItem>& values);    // multi-value + AND/OR
     void applyFilters();
+    void updateFilterChrome();   // Filters chip styling, badge, applied chips
     void rebuildAppliedFilterChips();
     int  activeFilterCount() const;
 
     // A-Z jump rail (right edge): build it, jump the grid to the first title in
     // a letter bucket, and refresh its visibility (sort-dependent) + highlight.
+    // Off the local index a jump is a scan of the local order; off the
+    // server it looks the letter up in m_azOffsets (one /firstCharacter
+    // request per listing, loadAzOffsets) and opens a window there.
     void buildAzRail();
     void jumpToLetter(char letter);
     void refreshAzRail();
+    void loadAzOffsets();
     void updateCountLabel();   // "312 titles" beside the page title
 
     // Check if this tab is still valid (not destroyed)
@@ -108,6 +115,13 @@ private:
     brls::Box* m_azRail = nullptr;
     std::vector<brls::Label*> m_azLetters;
     char m_currentAzLetter = 0;
+    // Listing offset of each rail letter's first title, parallel to
+    // m_azLetters, for the buildListParams() in m_azOffsetsParams (empty
+    // until fetched). m_pendingAzLetter is a jump waiting on the fetch.
+    std::vector<size_t> m_azOffsets;
+    std::string m_azOffsetsParams;
+    bool m_azOffsetsLoading = false;
+    char m_pendingAzLetter = 0;
 
     // View mode selector buttons. (No "All" chip — the grid shows all items by
     // default and the Filters menu narrows it; Back returns from a sub-mode.)
@@ -138,15 +152,22 @@ private:
     // field. Each holds one or more selected (value,label) pairs plus the match
     // mode — false = OR (comma-joined: genre=1,2), true = AND (repeated param:
     // genre=1&genre=2). Watch Status ("unwatched") stays single-value. Empty
-    // map = no filters.
-    struct ActiveFilter {
-        std::vector<std::pair<std::string, std::string>> values;  // (key, label)
-        bool andMode = false;
-    };
+    // map = no filters. Same shape LibraryQuery runs on.
+    using ActiveFilter = LibraryQuery::Filter;
     std::map<std::string, ActiveFilter> m_activeFilters;
     // Per-field cache of fetched filter values, so reopening a picker is instant.
     std::map<std::string, std::vector<GenreItem>> m_filterValueCache;
 
+    // What survives the tab being freed: its filters and the first visible
+    // grid item, keyed by section. m_restoreTopItem holds the position until
+    // the first page lands.
+    struct TabSnapshot {
+        std::map<std::string, ActiveFilter> filters;
+        size_t topItem = 0;
+    };
+    static TabStateCache<TabSnapshot> s_snapshots;
+    size_t m_restoreTopItem = 0;
+
     // Main content grid
     RecyclingGrid* m_contentGrid = nullptr;
 
@@ -154,13 +175,42 @@ private:
     brls::ScrollingFrame* m_trackListScroll = nullptr;
     brls::Box* m_trackListBox = nullptr;
 
-    // Pagination for infinite scroll
+    // Pagination for infinite scroll. m_items is a window onto the listing,
+    // items [m_windowStart, m_pageOffset): it starts at 0 unless an A-Z jump
+    // or a restored position opened it further in, and the hole above is
+    // filled a page at a time as the user scrolls up (loadPreviousPage).
     void loadNextPage();
+    void loadPreviousPage();
+    void openWindowAt(size_t pos);   // show listing item `pos`: one page, one request
+    size_t windowStartFor(size_t pos) const;
+    void showServerWindow(const std::vector<MediaItem>& items, size_t start, int total,
+                          size_t topItem);
+    void prependWindow(const std::vector<MediaItem>& items, size_t start);
+    size_t m_windowStart = 0;
     size_t m_pageOffset = 0;
     int m_totalItemCount = 0;
     // Page size comes from the platform layer now so desktop builds can
-    // request hundreds per page while Vita stays at ~60.
+    // request hundreds per page while Vita stays at ~60. Appended pages are
+    // that size adapted by PagePacer (utils/page_pacer.hpp).
     static size_t libraryPageSize();
+    size_t nextPageSize() const;
+    void updatePrefetchLead();
+
+    // Local library index (app/library_index.hpp) and its query engine. While
+    // m_servingLocal is set, the ALL_ITEMS grid, A-Z rail and count come from
+    // m_query's index in m_localOrder's order and pages are sliced out of it
+    // instead of being fetched. Used whenever LibraryQuery can answer the
+    // current sort + filters; anything else goes to the server.
+    bool canServeLocally() const;
+    void showLocalIndex(LibraryQuery::Ptr query, std::vector<uint32_t> order, size_t topItem);
+    void showLocalWindow(size_t topItem);
+    void appendLocalItems(size_t end);
+    // Delta-sync the index on a dedicated thread and hand the result to the UI.
+    void syncLocalIndex(const std::string& key, int metadataType, LibraryIndex::Ptr base,
+                        std::weak_ptr<bool> aliveWeak);
+    LibraryQuery::Ptr m_query;
+    std::vector<uint32_t> m_localOrder;
+    bool m_servingLocal = false;
 
     // Data
     std::vector<MediaItem> m_items;
@@ -8,6 +8,7 @@
 #include <borealis.hpp>
 #include <memory>
 #include "app/plex_client.hpp"
+#include "view/lazy_tab.hpp"
 
 namespace vitaplex {
 
@@ -65,19 +66,24 @@ private:
     void loadGuide();
     void loadRecordings();
     void buildEPGGrid();
-    // Build ONE fully-detached guide row for `channel` (channel column +
-    // lazy RowLogo entry + HScrollingFrame of program cells + all the
-    // m_epgCells / m_epgRowRanges / m_rowProgramScrolls bookkeeping) and
-    // attach it to `intoBox` last. Shared by buildEPGGrid's synchronous
-    // first screenful and the progressive chunks that append the rest.
-    void appendGuideRow(const LiveTVChannel& channel, brls::Box* intoBox);
-    // Progressive guide build: queue a brls::sync chunk that appends up
-    // to kRowsPerChunk rows starting at `nextRow` into the live guide
-    // box, then chains the next chunk so frames render in between. `gen`
-    // must still match m_gridBuildGen when the chunk runs (and the tab
-    // must still be alive) or the chunk bails — a reload rebuilt the
-    // grid. `buildStartUs` anchors the completion log's total wall time.
-    void scheduleGuideRowChunk(size_t nextRow, int gen, int64_t buildStartUs);
+
+    // Guide virtualization (see m_guideSlots). updateGuideWindow() runs at
+    // the top of draw(): it rebinds row slots to the channels in (or near)
+    // the vertical viewport, and every bound row's cells to the programs
+    // in (or near) the shared horizontal window, creating pooled views
+    // only when the pool is short.
+    void updateGuideWindow();
+    size_t createGuideSlot();                       // empty row shell, detached
+    void bindGuideRow(size_t slot, int channel);    // caller detaches/attaches
+    void bindGuideRowCells(size_t slot);            // cells for the bound window
+    void bindTimeHeader();                          // header slots for the window
+    void attachGuideRow(size_t slot);
+    void detachGuideRow(size_t slot);
+    void ensureRowModel(int channel);
+    float guideTrackWidth();                        // visible program-area width
+    brls::View* firstVisibleGuideFocus();           // DOWN-from-hero target
+    void onGuideCellClicked(size_t slot, int model);
+    void onGuideCellFocused(size_t slot, int model);
     // Attach a freshly built (orphan) guide content box to the scroll frame,
     // parking focus safely first — see buildEPGGrid for why rows are built
     // detached (per-addView relayout froze the UI for seconds otherwise).
@@ -131,20 +137,6 @@ private:
     bool          m_heroProgramValid = false;
     std::shared_ptr<std::atomic<bool>> m_heroThumbAlive;  // ImageLoader cancel handle
 
-    // Lazily-loaded channel logos: buildEPGGrid only records url+targets;
-    // draw() requests a row's logo the first time that row is actually
-    // visible. Queueing all ~32 fetches during the build made them part of
-    // the tab-open stall and left them racing the EPG fetch for workers.
-    struct RowLogo {
-        brls::Box*   row = nullptr;
-        brls::Image* img = nullptr;
-        std::string  url;
-        bool requested = false;
-    };
-    std::vector<RowLogo> m_rowLogos;
-    std::shared_ptr<std::atomic<bool>> m_logoAlive;  // generation guard for
-                                                     // in-flight logo loads
-
     // EPG Guide section
     brls::Label* m_guideLabel = nullptr;
     brls::Box* m_guideContainer = nullptr;      // Contains time header + grid
@@ -153,48 +145,74 @@ private:
     brls::ScrollingFrame* m_guideScrollV = nullptr;  // Vertical scroll inside the guide block
     brls::Box* m_guideBox = nullptr;            // Contains channel rows; scrolls inside m_guideScrollV
     brls::Box* m_currentTimeLine = nullptr;     // Absolute-positioned cyan rule over the program area
-    // Per-row HScrollingFrame for the program cells. The channel column
-    // sits *outside* this scroll on the left so it stays put when the
-    // programs scroll horizontally. draw() reads the focused row's
-    // offset and applies it to every other row + the time header so
-    // they all move together.
-    std::vector<brls::HScrollingFrame*> m_rowProgramScrolls;
-    // Content box of each row's HScrollingFrame, parallel to
-    // m_rowProgramScrolls. The cross-row scroll sync moves these directly
-    // via setTranslationX (a plain float store — exactly how borealis
-    // applies scroll offsets internally) instead of setContentOffsetX,
-    // which invalidates and re-runs Yoga layout over the whole ~1500-view
-    // grid — per row, per frame, while the anchor row's scroll animates.
-    std::vector<brls::Box*> m_rowProgramBoxes;
-
-    // Batch text rendering for the EPG cells. The patched nanovg lets
-    // us flush every visible cell's title (and separately, every
-    // subtitle) as a single render call instead of one per Label —
-    // ~100 cells per build x ~2 labels each = ~200 draw calls otherwise.
-    // Cells themselves are intentionally label-less; draw() walks this
-    // vector after the standard Box::draw to paint the text on top.
-    struct EpgCellInfo {
-        brls::Box* cell = nullptr;     // owns the rect / focus (background is
-                                       // painted batched in draw(), not by the Box)
-        brls::HScrollingFrame* scroll = nullptr;  // viewport the cell lives in
-        brls::Box* row = nullptr;      // owning channel row — culled rows let the
-                                       // batch pass skip their cells outright
+
+    // Guide cells as plain data, built per channel the first time its row
+    // is bound. Cells are label-less boxes: draw() paints every visible
+    // cell's background, title and subtitle in a few batched NanoVG calls
+    // (patched nvgTextBatchBegin/End) straight from these models.
+    struct GuideCellModel {
+        enum class Kind { PROGRAM, LEGACY, EMPTY };
+        Kind kind = Kind::PROGRAM;     // LEGACY: currentProgram-only channel,
+                                       // EMPTY: "No guide data" placeholder
+        float x = 0;                   // left edge within the program track
+        float w = 0;
         bool onNow = false;            // currently airing (fill + accent border)
-        std::string title;
+        std::string title;             // truncated to the cell width
         std::string subtitle;          // start-end + " · on now" if currently airing
+        GuideProgram program;          // hero / click payload
     };
-    std::vector<EpgCellInfo> m_epgCells;
+    struct GuideRowModel {
+        bool built = false;
+        std::vector<GuideCellModel> cells;   // sorted by x
+    };
+    std::vector<GuideRowModel> m_rowModels;  // parallel to m_channels
 
-    // Cells grouped by channel row ([begin,end) into m_epgCells, which is
-    // built strictly row-by-row). The batch text pass iterates these so a
-    // culled row skips all its cells in one visibility check instead of
-    // touching every cell struct in the grid every frame.
-    struct EpgRowRange {
+    // Virtualized guide rows. Only channels inside the vertical viewport
+    // (plus a small margin) have views: a pool of row slots, each
+    // absolutely positioned at channel * rowHeight inside a fixed-height
+    // m_guideBox, is rebound as the guide scrolls. Each row's program
+    // track is likewise a fixed-width box whose pooled cell views are
+    // bound only to programs inside the shared horizontal window. Open
+    // time and view count no longer grow with the channel count.
+    struct GuideRowSlot {
         brls::Box* row = nullptr;
-        size_t begin = 0;
-        size_t end = 0;
+        brls::Box* channelCol = nullptr;
+        brls::Image* logo = nullptr;
+        brls::Label* chNumLabel = nullptr;
+        // The channel column sits *outside* this scroll on the left so it
+        // stays put when the programs scroll horizontally. draw() reads the
+        // focused row's offset and mirrors it onto every other row and the
+        // time header by translating their content boxes directly
+        // (setTranslationX — a plain float store, exactly how borealis
+        // applies scroll offsets internally) instead of setContentOffsetX,
+        // which invalidates and re-runs Yoga layout over the whole guide.
+        brls::HScrollingFrame* scroll = nullptr;
+        brls::Box* programs = nullptr;
+        std::vector<brls::Box*> cells;       // pooled cells; GONE when unbound
+        int channel = -1;                    // index into m_channels, -1 = free
+        bool attached = false;               // in m_guideBox (getParent() lies
+                                             // after removeView)
+        // Logos load lazily: draw() requests a row's logo the first time it
+        // survives the cull. Rotated on every rebind so a slow fetch for
+        // the previous channel can't land on the recycled Image.
+        bool logoRequested = false;
+        std::shared_ptr<std::atomic<bool>> logoAlive;
+    };
+    std::vector<GuideRowSlot> m_guideSlots;
+    int   m_windowFirstRow = -1;     // channel range bound last update
+    int   m_windowLastRow  = -1;
+    float m_boundWindowX   = -1;     // horizontal offset cells were bound around
+    brls::View* m_boundFocus = nullptr;  // focus the focused row was bound for
+
+    // Pooled time-header slots, bound to 30-minute slot indices inside the
+    // horizontal window like the program cells.
+    struct TimeSlotView {
+        brls::Box* box = nullptr;
+        brls::Box* rule = nullptr;
+        brls::Label* label = nullptr;
+        int index = -1;
     };
-    std::vector<EpgRowRange> m_epgRowRanges;
+    std::vector<TimeSlotView> m_timeSlots;
 
     // Per-frame cost accounting (logged on Vita every few hundred frames
     // so a hardware log pinpoints where guide frame time goes).
@@ -235,11 +253,14 @@ private:
     bool    m_heroUpdatePending     = false;
     int64_t m_lastHoverUs           = 0;   // CPU time of the last hover event
 
-    // Progressive guide build generation — buildEPGGrid() bumps this and
-    // captures the new value into every row chunk it schedules; a pending
-    // chunk whose generation no longer matches (a reload rebuilt the
-    // grid) bails out instead of appending stale rows into the new guide.
-    int m_gridBuildGen = 0;
+    // Guide position carried across the tab being freed: the topmost
+    // channel row on screen. m_restoreTopChannel holds it until the first
+    // buildEPGGrid() (-1 = nothing to restore).
+    struct TabSnapshot {
+        int topChannel = 0;
+    };
+    static TabStateCache<TabSnapshot> s_snapshots;
+    int m_restoreTopChannel = -1;
 
     // Alive flag for crash prevention on quick tab switching
     std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
@@ -12,6 +12,7 @@
 #include <vector>
 #include <functional>
 #include "app/plex_client.hpp"
+#include "utils/async.hpp"
 
 namespace vitaplex {
 
@@ -43,10 +44,16 @@ public:
 
     static brls::View* create();
 
+    // The poster URL loadDetails() requests for `item` (square for music),
+    // so a prefetch lands on the same ImageLoader cache entry. Empty when
+    // the item has no thumb.
+    static std::string posterUrl(const MediaItem& item);
+
 private:
     void loadDetails();
     void loadChildren();
     void loadMusicCategories();
+    void loadArtistReleases(const std::string& sectionKey);   // the rails, once the section is known
     void loadTrackList();              // Load tracks in vertical list (like Suwayomi chapters)
     void loadExtras();                 // Load extras (trailers, featurettes, etc.)
     void loadRecommendations();        // Load related / recommended titles (movies + shows)
@@ -262,6 +269,11 @@ public:
 
     // Shared alive flag to prevent async callbacks from accessing destroyed view
     std::shared_ptr<std::atomic<bool>> m_alive;
+
+    // Detail / children / extras / related / stream fetches. Destroyed with
+    // the view, which cancels whatever is still in flight (HTTP included)
+    // and drops their pending UI callbacks.
+    TaskScope m_tasks;
 };
 
 } // namespace vitaplex
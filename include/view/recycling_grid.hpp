@@ -9,6 +9,7 @@
 #include <borealis.hpp>
 #include "app/plex_client.hpp"
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -28,17 +29,39 @@ public:
     void setOnItemSelected(std::function<void(const MediaItem&)> callback);
     void setOnItemStartAction(std::function<void(const MediaItem&)> callback);
 
-    // Called automatically when user scrolls to the bottom.
+    // Called when the user scrolls towards the bottom: as soon as the rows
+    // left below the viewport would run out within the prefetch lead at the
+    // current scroll speed, or at the latest on DOWN from the last row.
     // Owner should fetch the next page and call appendItems().
     void setOnLoadMore(std::function<void()> callback);
+    // How long the owner expects the next page to take to arrive and be
+    // appended. Scrolled at the measured speed, that much time's worth of
+    // rows (plus one screen, at most two pages) is asked for ahead.
+    void setPrefetchLead(int64_t usec) { m_prefetchLeadUsec = usec; }
 
     // Tell the grid whether more items are available on the server
     void setHasMore(bool hasMore);
 
+    // The item list may start partway into the owner's listing (an A-Z jump
+    // opens a window at its letter). UP from the top row then asks for the
+    // rows above; the owner fetches them and calls prependItems(). Prepends
+    // should be whole rows (a multiple of columns()) so nothing below
+    // reflows; anything else rebuilds the grid.
+    void setOnLoadPrevious(std::function<void()> callback);
+    void setHasLess(bool hasLess);
+    void prependItems(const std::vector<MediaItem>& newItems);
+    int columns() const { return m_columns; }
+
     // Jump the scroll so the row holding item `index` sits at the top of the
     // viewport (clamped to the scrollable range). Backs the A-Z jump rail.
     void scrollToItemIndex(size_t index, bool animated = true);
     size_t itemCount() const { return m_items.size(); }
+    // Index of the first item in the topmost row still on screen.
+    size_t firstVisibleItemIndex();
+    // One-shot: the next time focus enters the grid it lands on this item
+    // instead of the first cell (restoring a tab's scroll position).
+    void setDefaultFocusIndex(size_t index) { m_defaultFocusIndex = index; }
+    brls::View* getDefaultFocus() override;
 
     // Opt-in: where focus goes when RIGHT is pressed at the grid's right edge
     // (e.g. the A-Z jump rail). Default null = standard navigation; only used
@@ -59,15 +82,31 @@ public:
 
 private:
     void rebuildGrid();
-    void onItemClicked(int index);
-    void addCellForItem(brls::Box*& currentRow, int& itemsInRow, size_t index);
+    void onItemClicked(long long serial);
+    // Build rows for m_items[begin, end) into a new, still-parentless page
+    // box. Caller attaches it to m_contentBox with a single addView().
+    brls::Box* buildPage(size_t begin, size_t end);
+    brls::Box* createRow();
+    void addCellToRow(brls::Box* row, size_t index);
+    // Track the downward scroll speed and call onLoadMore early when the
+    // rows below the viewport won't outlast the prefetch lead.
+    void prefetchIfNeeded();
 
     std::vector<MediaItem> m_items;
+    // Cells capture a serial (m_serialBase + their index at creation) so a
+    // prepend, which shifts every index, doesn't need to re-wire them.
+    long long m_serialBase = 0;
     std::function<void(const MediaItem&)> m_onItemSelected;
     std::function<void(const MediaItem&)> m_onItemStartAction;
     std::function<void()> m_onLoadMore;
+    std::function<void()> m_onLoadPrevious;
 
     brls::Box* m_contentBox = nullptr;
+    // One COLUMN box per setDataSource()/appendItems() batch. Each addView()
+    // into an attached box triggers a full-tree Yoga relayout, so rows are
+    // built inside a detached page and the page is attached once — an
+    // append costs one relayout plus the new rows, not one per cell.
+    std::vector<brls::Box*> m_pages;
     // Row containers in display order, populated alongside the cells.
     // Lets draw() flip whole rows to INVISIBLE in one call when they
     // scroll off-screen, instead of paying the per-view frame() cost.
@@ -82,10 +121,24 @@ private:
 
     bool m_hasMore = false;
     bool m_loading = false;  // Prevents duplicate fetch requests
+    bool m_hasLess = false;
+    bool m_loadingPrevious = false;
+
+    // Early-load state for prefetchIfNeeded(). Speed is a smoothed downward
+    // px/s; the last sample is reset whenever the offset jumps for reasons
+    // other than scrolling (new data source, prepend).
+    int64_t m_prefetchLeadUsec = 500000;
+    size_t m_lastPageItems = 0;   // last appendItems() batch; 0 since setDataSource()
+    float m_scrollSpeed = 0.0f;
+    float m_lastOffsetY = 0.0f;
+    int64_t m_lastSampleUsec = 0;
 
     // Opt-in RIGHT-edge focus escape (e.g. the A-Z jump rail). See setter.
     brls::View* m_rightFocusEscape = nullptr;
 
+    // Pending default-focus item, or SIZE_MAX when none. See setter.
+    size_t m_defaultFocusIndex = SIZE_MAX;
+
     // Lifetime guard for the orientation-change listener — the listener
     // is global and lives forever, but the grid can be destroyed while
     // the user navigates away. The listener checks this flag before
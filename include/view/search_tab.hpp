@@ -10,8 +10,10 @@
 #include <memory>
 #include <atomic>
 #include <string>
+#include <utility>
 #include <vector>
 #include "app/plex_client.hpp"
+#include "utils/async.hpp"
 
 namespace vitaplex {
 
@@ -32,7 +34,17 @@ private:
     void clearQuery();
     void updateField();
 
+    // Local index results first (synchronous), then the server's for
+    // anything the index doesn't hold.
     void performSearch();
+    bool addResult(const MediaItem& item);   // into its type's row; false if dropped
+
+    // Server search: debounced, aborted when the query changes, memoized
+    // per query (lower-cased) with prefix reuse.
+    void startServerSearch();                // fired by m_serverSearchTimer
+    const std::vector<MediaItem>* cachedServerResults(const std::string& key, bool* exact);
+    void rememberServerResults(const std::string& key, std::vector<MediaItem> items);
+    std::vector<std::string> resultKeys() const;   // what the rows show, to skip no-op rebuilds
     void rebuildResults();
     void addSection(const std::string& title, const std::vector<MediaItem>& items);
     brls::Box* makeCard(const MediaItem& item);
@@ -46,6 +58,10 @@ private:
     brls::ScrollingFrame* m_resultsScroll = nullptr;
     brls::Box*            m_resultsContent = nullptr;
 
+    static constexpr size_t kLocalResultsPerType = 100;   // matches /hubs/search's limit
+    static constexpr int kServerSearchDebounceMs = 300;
+    static constexpr size_t kServerCacheEntries = 8;
+
     std::string m_query;
     std::vector<MediaItem> m_movies;
     std::vector<MediaItem> m_episodes;
@@ -54,9 +70,12 @@ private:
     std::vector<MediaItem> m_albums;
     std::vector<MediaItem> m_tracks;
 
-    // Alive flag + generation counter for crash prevention / stale results.
+    brls::Timer m_serverSearchTimer;
+    TaskScope m_serverSearch;   // the /hubs/search in flight
+    std::vector<std::pair<std::string, std::vector<MediaItem>>> m_serverCache;   // least recently used first
+
+    // Alive flag for crash prevention.
     std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
-    int m_loadGeneration = 0;
     // ImageLoader needs an atomic flag; recycled per result rebuild.
     std::shared_ptr<std::atomic<bool>> m_imgAlive;
 
@@ -59,6 +59,7 @@
 #endif
 
 #include <chrono>
+#include <fstream>
 #include <set>
 #include <thread>
 
@@ -149,7 +150,26 @@ void Application::createWindow(std::string windowTitle)
             return;
 
         if (eventType == facebook::yoga::Event::NodeLayout)
-            view->onLayout(); });
+        {
+            view->onLayout();
+            // VitaPlex: a relayout means something visible changed. Views
+            // that toggle visibility from draw() (grid culling) would
+            // otherwise keep every frame dirty, so ignore passes that
+            // happen inside frame() itself.
+            if (!Application::inFrame)
+                Application::markDirty();
+        }
+        else if (eventType == facebook::yoga::Event::LayoutPassStart)
+        {
+            if (Application::frameProfilerEnabled)
+                Application::layoutPassStart = getCPUTimeUsec();
+        }
+        else if (eventType == facebook::yoga::Event::LayoutPassEnd)
+        {
+            if (Application::frameProfilerEnabled && Application::layoutPassStart > 0)
+                Application::addFramePhaseTime(FramePhase::LAYOUT, getCPUTimeUsec() - Application::layoutPassStart);
+            Application::layoutPassStart = 0;
+        } });
 
     // Load fonts and setup fallbacks
     Application::platform->getFontLoader()->loadFonts();
@@ -200,6 +220,14 @@ bool Application::internalMainLoop()
     Application::frameStartTime = getCPUTimeUsec();
     Application::setActiveEvent(false);
 
+    if (Application::frameProfilerEnabled)
+    {
+        Application::currentFrameProfile       = FrameProfile();
+        Application::currentFrameProfile.start = Application::frameStartTime;
+        Application::profileMark               = Application::frameStartTime;
+        Application::profileNestedAtMark       = 0;
+    }
+
     // Main loop callback
     if (!Application::platform->mainLoopIteration() || Application::quitRequested)
     {
@@ -220,16 +248,21 @@ bool Application::internalMainLoop()
             Application::getAudioPlayer()->play(Sound::SOUND_CLICK_ERROR);
     }
 
+    Application::profileLap(FramePhase::INPUT);
+
     // Animations
 #ifndef SIMPLE_HIGHLIGHT
     updateHighlightAnimation();
 #endif
     Ticking::updateTickings();
+    Application::profileLap(FramePhase::ANIMATION);
 
     // Render. On mobile, skip drawing while backgrounded (no GL surface) and for
     // a few warm-up frames after returning, so we never upload textures against a
     // dead/just-recreated context. The logic above/below (timers, input, sync
     // tasks) still runs every iteration, so background music keeps working.
+    // With redraw-on-demand on, clean iterations skip the draw as well.
+    const bool drawFrame = Application::consumeFrameDirty();
 #if defined(ANDROID) || defined(IOS)
     {
         static bool s_focusHooked = false;
@@ -239,7 +272,10 @@ bool Application::internalMainLoop()
             Application::getWindowFocusChangedEvent()->subscribe([](bool focused) {
                 g_appForeground = focused;
                 if (focused)
+                {
                     g_resumeWarmupFrames = 4;  // let SDL rebuild the surface
+                    Application::markDirty();
+                }
             });
         }
 
@@ -247,19 +283,22 @@ bool Application::internalMainLoop()
         {
             if (g_resumeWarmupFrames > 0)
                 g_resumeWarmupFrames--;
-            else
+            else if (drawFrame)
                 Application::frame();
         }
     }
 #else
-    Application::frame();
+    if (drawFrame)
+        Application::frame();
 #endif
 
     // Run sync functions
     Threading::performSyncTasks();
+    Application::runPostedTasks();
 
     // Trigger RunLoop subscribers
     runLoopEvent.fire();
+    Application::profileLap(FramePhase::SYNC);
 
     // Free views deletion pool.
     // A view deletion might inserts other views to deletionPool
@@ -278,6 +317,19 @@ bool Application::internalMainLoop()
     }
     Application::deletionPool = undeletedViews;
 
+    if (Application::frameProfilerEnabled)
+    {
+        FrameProfile& p = Application::currentFrameProfile;
+        p.total         = getCPUTimeUsec() - Application::frameStartTime;
+        p.drawn         = drawFrame;
+        if (Application::frameProfiles.size() != FRAME_PROFILE_CAPACITY)
+            Application::frameProfiles.resize(FRAME_PROFILE_CAPACITY);
+        Application::frameProfiles[Application::frameProfileHead] = p;
+        Application::frameProfileHead = (Application::frameProfileHead + 1) % FRAME_PROFILE_CAPACITY;
+        if (Application::frameProfileCount < FRAME_PROFILE_CAPACITY)
+            Application::frameProfileCount++;
+    }
+
     if (Application::limitedFrameTime > 0)
     {
         Time deltaTime = getCPUTimeUsec() - frameStartTime;
@@ -287,10 +339,287 @@ bool Application::internalMainLoop()
             std::this_thread::sleep_for(std::chrono::microseconds(interval));
         }
     }
+    else if (!drawFrame)
+    {
+        // No vsync'd swap paced this iteration. Poll input at roughly the
+        // display rate instead of spinning, so a button press is picked
+        // up exactly as soon as it would have been while drawing.
+        Time deltaTime = getCPUTimeUsec() - frameStartTime;
+        Time interval  = Application::idlePollTime - deltaTime;
+        if (interval > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(interval));
+        }
+    }
 
     return true;
 }
 
+void Application::setRedrawOnDemand(bool enable)
+{
+    Application::redrawOnDemand = enable;
+    Application::markDirty();
+}
+
+bool Application::isRedrawOnDemand()
+{
+    return Application::redrawOnDemand;
+}
+
+void Application::markDirty()
+{
+    Application::frameDirty.store(true, std::memory_order_relaxed);
+}
+
+void Application::post(std::function<void()> task, TaskPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(Application::postedTasksMutex);
+        Application::postedTasks[(size_t)priority].push_back(std::move(task));
+    }
+    Application::markDirty();
+}
+
+void Application::setTaskBudget(Time us)
+{
+    Application::taskBudget = us;
+}
+
+size_t Application::getPendingTaskCount()
+{
+    std::lock_guard<std::mutex> lock(Application::postedTasksMutex);
+    size_t count = 0;
+    for (auto& queue : Application::postedTasks)
+        count += queue.size();
+    return count;
+}
+
+void Application::runPostedTasks()
+{
+    Time start = getCPUTimeUsec();
+    bool ran   = false;
+
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(Application::postedTasksMutex);
+            for (auto& queue : Application::postedTasks)
+            {
+                if (!queue.empty())
+                {
+                    task = std::move(queue.front());
+                    queue.pop_front();
+                    break;
+                }
+            }
+        }
+        if (!task)
+            break;
+
+        task();
+        ran = true;
+
+        if (getCPUTimeUsec() - start >= Application::taskBudget)
+            break;
+    }
+
+    // Tasks swap in data views paint from; leftovers keep the loop drawing
+    // so they get their turn next iteration.
+    if (ran)
+        Application::markDirty();
+}
+
+void Application::setFrameProfiler(bool enable)
+{
+    if (enable && !Application::frameProfilerEnabled)
+    {
+        Application::frameProfiles.assign(FRAME_PROFILE_CAPACITY, FrameProfile());
+        Application::frameProfileHead  = 0;
+        Application::frameProfileCount = 0;
+    }
+    else if (!enable)
+    {
+        std::vector<FrameProfile>().swap(Application::frameProfiles);
+        Application::frameProfileHead  = 0;
+        Application::frameProfileCount = 0;
+    }
+    Application::frameProfilerEnabled = enable;
+    Application::markDirty();
+}
+
+bool Application::isFrameProfilerEnabled()
+{
+    return Application::frameProfilerEnabled;
+}
+
+void Application::setFrameProfilerOverlay(bool show)
+{
+    Application::frameProfilerOverlay = show;
+    Application::markDirty();
+}
+
+void Application::addFramePhaseTime(FramePhase phase, Time us)
+{
+    if (!Application::frameProfilerEnabled || us <= 0)
+        return;
+    Application::currentFrameProfile.phase[(size_t)phase] += us;
+}
+
+void Application::profileLap(FramePhase phase)
+{
+    if (!Application::frameProfilerEnabled)
+        return;
+
+    // Layout passes and mpv renders are credited to their own phases as
+    // they happen; take them back out of the phase that contained them.
+    FrameProfile& p = Application::currentFrameProfile;
+    Time now        = getCPUTimeUsec();
+    Time nested     = p.phase[(size_t)FramePhase::LAYOUT] + p.phase[(size_t)FramePhase::MPV];
+    Time spent      = (now - Application::profileMark) - (nested - Application::profileNestedAtMark);
+    if (spent > 0)
+        p.phase[(size_t)phase] += spent;
+    Application::profileMark         = now;
+    Application::profileNestedAtMark = nested;
+}
+
+std::vector<Application::FrameProfile> Application::getFrameProfiles()
+{
+    std::vector<FrameProfile> out;
+    if (Application::frameProfiles.empty())
+        return out;
+    out.reserve(Application::frameProfileCount);
+    size_t first = (Application::frameProfileHead + FRAME_PROFILE_CAPACITY - Application::frameProfileCount) % FRAME_PROFILE_CAPACITY;
+    for (size_t i = 0; i < Application::frameProfileCount; i++)
+        out.push_back(Application::frameProfiles[(first + i) % FRAME_PROFILE_CAPACITY]);
+    return out;
+}
+
+bool Application::exportFrameProfiles(const std::string& path)
+{
+    std::vector<FrameProfile> frames = Application::getFrameProfiles();
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open())
+    {
+        Logger::error("Frame profiler: cannot open {}", path);
+        return false;
+    }
+
+    out << "start_us,total_us,drawn,input_us,animation_us,layout_us,draw_us,flush_us,sync_us,mpv_us\n";
+    for (const FrameProfile& p : frames)
+    {
+        out << p.start << ',' << p.total << ',' << (p.drawn ? 1 : 0);
+        for (size_t i = 0; i < (size_t)FramePhase::_COUNT; i++)
+            out << ',' << p.phase[i];
+        out << '\n';
+    }
+    Logger::info("Frame profiler: wrote {} frames to {}", frames.size(), path);
+    return true;
+}
+
+void Application::drawFrameProfilerOverlay(NVGcontext* vg)
+{
+    static const NVGcolor phaseColors[(size_t)FramePhase::_COUNT] = {
+        nvgRGB(90, 160, 255),  // input
+        nvgRGB(170, 120, 255), // animation
+        nvgRGB(255, 200, 60),  // layout
+        nvgRGB(80, 210, 120),  // draw
+        nvgRGB(140, 140, 150), // flush
+        nvgRGB(255, 120, 60),  // sync
+        nvgRGB(240, 80, 160),  // mpv
+    };
+    static const char* phaseNames[(size_t)FramePhase::_COUNT] = {
+        "input", "anim", "layout", "draw", "flush", "sync", "mpv"
+    };
+
+    const size_t shown  = 120;    // most recent frames in the graph
+    const float barW    = 2.0f;
+    const float graphW  = shown * barW;
+    const float graphH  = 80.0f;
+    const float fullUs  = 33333.0f; // top of the graph = 30 FPS frame
+    const float x0      = 12.0f;
+    const float y0      = Application::contentHeight - graphH - 40.0f;
+
+    std::vector<FrameProfile> frames = Application::getFrameProfiles();
+    size_t begin = frames.size() > shown ? frames.size() - shown : 0;
+
+    nvgSave(vg);
+    nvgBeginPath(vg);
+    nvgRect(vg, x0 - 6, y0 - 6, graphW + 12, graphH + 34);
+    nvgFillColor(vg, nvgRGBA(0, 0, 0, 170));
+    nvgFill(vg);
+
+    // Worst frame in view, for the caption.
+    const FrameProfile* worst = nullptr;
+    Time sum                  = 0;
+    for (size_t i = begin; i < frames.size(); i++)
+    {
+        const FrameProfile& p = frames[i];
+        sum += p.total;
+        if (!worst || p.total > worst->total)
+            worst = &p;
+
+        float bx = x0 + (i - begin) * barW;
+        float by = y0 + graphH;
+        for (size_t ph = 0; ph < (size_t)FramePhase::_COUNT; ph++)
+        {
+            float h = p.phase[ph] / fullUs * graphH;
+            if (h <= 0.0f)
+                continue;
+            if (by - h < y0)
+                h = by - y0;
+            nvgBeginPath(vg);
+            nvgRect(vg, bx, by - h, barW, h);
+            nvgFillColor(vg, phaseColors[ph]);
+            nvgFill(vg);
+            by -= h;
+            if (by <= y0)
+                break;
+        }
+    }
+
+    // 60 FPS budget line.
+    float budgetY = y0 + graphH - 16667.0f / fullUs * graphH;
+    nvgBeginPath(vg);
+    nvgRect(vg, x0, budgetY, graphW, 1.0f);
+    nvgFillColor(vg, nvgRGBA(255, 255, 255, 120));
+    nvgFill(vg);
+
+    nvgFontFaceId(vg, Application::getDefaultFont());
+    nvgFontSize(vg, 12.0f);
+    nvgTextAlign(vg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    float lx = x0;
+    for (size_t ph = 0; ph < (size_t)FramePhase::_COUNT; ph++)
+    {
+        nvgFillColor(vg, phaseColors[ph]);
+        lx = nvgText(vg, lx, y0 + graphH + 4.0f, phaseNames[ph], nullptr) + 6.0f;
+    }
+
+    if (worst)
+    {
+        size_t worstPhase = 0;
+        for (size_t ph = 1; ph < (size_t)FramePhase::_COUNT; ph++)
+            if (worst->phase[ph] > worst->phase[worstPhase])
+                worstPhase = ph;
+        std::string caption = fmt::format("avg {:.1f} ms  worst {:.1f} ms ({})",
+            sum / 1000.0f / (frames.size() - begin), worst->total / 1000.0f, phaseNames[worstPhase]);
+        nvgFillColor(vg, nvgRGB(255, 255, 255));
+        nvgText(vg, x0, y0 - 2.0f - 14.0f, caption.c_str(), nullptr);
+    }
+    nvgRestore(vg);
+}
+
+bool Application::consumeFrameDirty()
+{
+    if (!Application::redrawOnDemand)
+        return true;
+
+    Time now = getCPUTimeUsec();
+    if (Application::frameDirty.exchange(false, std::memory_order_relaxed))
+        Application::lastDirtyTime = now;
+    return now - Application::lastDirtyTime < Application::redrawSettleTime;
+}
+
 void Application::updateFPS()
 {
     static Time start = getCPUTimeUsec();
@@ -318,6 +647,10 @@ void Application::processInput()
     std::vector<RawTouchState> rawTouch;
     RawMouseState rawMouse;
 
+    // VitaPlex: set when anything is held / moving this iteration, for
+    // redraw-on-demand (see markDirty at the end).
+    bool inputActive = false;
+
     InputManager* inputManager = Application::platform->getInputManager();
     inputManager->runloopStart();
     inputManager->updateTouchStates(&rawTouch);
@@ -399,6 +732,8 @@ void Application::processInput()
         }
     }
     currentTouchState = touchState;
+    if (!touchState.empty())
+        inputActive = true;
 
     MouseState mouseState = InputManager::computeMouseState(rawMouse, currentMouseState);
 
@@ -406,6 +741,7 @@ void Application::processInput()
     {
         Application::setInputType(InputType::TOUCH);
         Application::setDrawCoursor(true);
+        inputActive = true;
     }
 
     if (mouseState.scroll.x == 0 && mouseState.scroll.y == 0 && mouseState.leftButton == TouchPhase::NONE && mouseState.middleButton == TouchPhase::NONE && mouseState.rightButton == TouchPhase::NONE)
@@ -440,6 +776,9 @@ void Application::processInput()
 
     for (int i = 0; i < _BUTTON_MAX; i++)
     {
+        if (controllerState.buttons[i] || oldControllerState.buttons[i])
+            inputActive = true;
+
         // Hold-A-to-open-menu shim. When enabled (e.g. on Android TV
         // via Application::setHoldAToOpenMenu), defer BUTTON_A click
         // firing to button release and turn long-holds into a
@@ -505,6 +844,12 @@ void Application::processInput()
 
     oldControllerState = controllerState;
 
+    for (int i = 0; i < _AXES_MAX; i++)
+    {
+        if (std::fabs(controllerState.axes[i]) > 0.1f)
+            inputActive = true;
+    }
+
     // Trigger keyboard events
     const bool ctrlPressed  = inputManager->getKeyboardKeyState(BRLS_KBD_KEY_LEFT_CONTROL) || inputManager->getKeyboardKeyState(BRLS_KBD_KEY_RIGHT_CONTROL);
     const bool altPressed   = inputManager->getKeyboardKeyState(BRLS_KBD_KEY_LEFT_ALT) || inputManager->getKeyboardKeyState(BRLS_KBD_KEY_RIGHT_ALT);
@@ -531,6 +876,9 @@ void Application::processInput()
             watchedKey.pressed = false;
         }
 
+        if (watchedKey.pressed || oldWatchedKey.pressed)
+            inputActive = true;
+
         if (watchedKey.pressed)
         {
             repeating = watchedKey.repeatingStop > 0 && cpuTime > watchedKey.repeatingStop;
@@ -551,6 +899,9 @@ void Application::processInput()
 
         oldWatchedKeys[i] = watchedKeys[i];
     }
+
+    if (inputActive)
+        Application::markDirty();
 }
 
 void Application::addToWatchedKeys(const BrlsKeyCombination key)
@@ -766,6 +1117,8 @@ bool Application::hasActiveEvent()
 
 void Application::setActiveEvent(bool value)
 {
+    if (value)
+        Application::markDirty();
 #ifndef __SWITCH__
     Application::activeEvent = value;
     if (value)
@@ -847,6 +1200,7 @@ bool Application::handleAction(const ActionType type, const int button, const bo
 void Application::frame()
 {
     VideoContext* videoContext = Application::platform->getVideoContext();
+    Application::inFrame = true;
 
     // Frame context
     FrameContext frameContext = FrameContext();
@@ -907,11 +1261,17 @@ void Application::frame()
         debugLayer->frame(&frameContext);
     }
 
+    if (frameProfilerEnabled && frameProfilerOverlay)
+        drawFrameProfilerOverlay(frameContext.vg);
+    Application::profileLap(FramePhase::DRAW);
+
     // End frame
     nvgResetTransform(Application::getNVGContext()); // scale
     nvgEndFrame(Application::getNVGContext());
 
     Application::platform->getVideoContext()->endFrame();
+    Application::profileLap(FramePhase::FLUSH);
+    Application::inFrame = false;
 }
 
 void Application::exit()
@@ -977,6 +1337,7 @@ void Application::setSwapInterval(int interval)
 
 void Application::notify(const std::string& text)
 {
+    Application::markDirty();
     Application::notificationManager->notify(text);
 }
 
@@ -991,6 +1352,7 @@ void Application::giveFocus(View* view)
             oldFocus->onFocusLost();
 
         Application::currentFocus = newFocus;
+        Application::markDirty();
         Application::globalFocusChangeEvent.fire(newFocus);
 
         if (newFocus)
@@ -1009,6 +1371,7 @@ bool Application::popActivity(TransitionAnimation animation, std::function<void(
         return false;
 
     Application::blockInputs();
+    Application::markDirty();
 
     Activity* last = Application::activitiesStack[Application::activitiesStack.size() - 1];
     last->willDisappear(true);
@@ -1074,6 +1437,7 @@ std::vector<Activity*> Application::getActivitiesStack()
 void Application::pushActivity(Activity* activity, TransitionAnimation animation)
 {
     Application::blockInputs();
+    Application::markDirty();
 
     // Focus
     if (!Application::activitiesStack.empty() && Application::currentFocus != nullptr)
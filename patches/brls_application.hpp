@@ -29,7 +29,10 @@
 #include <borealis/core/view.hpp>
 #include <borealis/core/notification_manager.hpp>
 #include <borealis/views/label.hpp>
+#include <atomic>
 #include <deque>
+#include <functional>
+#include <mutex>
 #include <vector>
 
 #ifdef __WINRT__
@@ -271,6 +274,85 @@ class Application
     static int getDeactivatedFPS();
     static double getDeactivatedFrameTime();
 
+    // VitaPlex: redraw-on-demand. When enabled, main loop iterations that
+    // nothing marked dirty skip layout and draw entirely; input, tickings,
+    // sync tasks and the run-loop event still run every iteration, so
+    // input latency is unchanged. Dirty sources: controller / touch /
+    // mouse / keyboard input, focus and activity changes, window resizes,
+    // any Yoga layout pass outside of frame(), and explicit markDirty()
+    // calls (video frames, decoded covers, views that animate from
+    // draw()). Frames keep being drawn for redrawSettleTime after the last
+    // mark so tickings started by those events (scrolls, fades, the focus
+    // highlight) finish. Tickings and brls::sync tasks don't mark dirty
+    // yet: a ticking that outlives the settle window (a spinner, a label
+    // ticker) or a sync task that changes a view stops being drawn until
+    // something else marks. Off, and not exposed in Settings, until both
+    // mark the frame dirty from brls core.
+    static void setRedrawOnDemand(bool enable);
+    static bool isRedrawOnDemand();
+
+    // Request that the next iteration draws. Thread-safe, cheap enough to
+    // call from every draw() of a continuously animating view.
+    static void markDirty();
+
+    // VitaPlex: time-budgeted main-thread task queue. Unlike brls::sync,
+    // which drains its whole queue every iteration, post()ed tasks run
+    // highest priority first only until the per-iteration budget is used
+    // up; the rest wait for the next iteration. At least one task runs per
+    // iteration so a single slow task can't stall the queue. A burst of
+    // completions (a page of covers, a library page) is spread over a few
+    // frames instead of producing one long one.
+    enum class TaskPriority
+    {
+        HIGH = 0, // user-visible result the user is waiting on
+        NORMAL,   // ordinary async completions
+        LOW,      // decoration: cover art, prefetched data
+        _COUNT
+    };
+
+    // Thread-safe. Runs `task` on the main thread during a later iteration.
+    static void post(std::function<void()> task, TaskPriority priority = TaskPriority::NORMAL);
+    // Per-iteration budget for post()ed tasks, in microseconds.
+    static void setTaskBudget(Time us);
+    static size_t getPendingTaskCount();
+
+    // VitaPlex: per-frame phase profiler. Each main-loop iteration records
+    // exclusive time per phase into a ring buffer (LAYOUT and MPV are
+    // subtracted from whichever phase triggered them, so the phases sum
+    // to at most `total`). FLUSH is nvgEndFrame + the video context swap,
+    // so it includes any vsync wait. Off by default; costs a handful of
+    // clock reads per iteration when on.
+    enum class FramePhase
+    {
+        INPUT = 0, // platform iteration + processInput
+        ANIMATION, // highlight + tickings
+        LAYOUT,    // Yoga layout passes, wherever they ran
+        DRAW,      // view tree, highlight, notifications
+        FLUSH,     // nvgEndFrame + endFrame
+        SYNC,      // brls::sync + post() queue drains, run-loop subscribers
+        MPV,       // mpv render calls made from sync tasks
+        _COUNT
+    };
+
+    struct FrameProfile
+    {
+        Time start = 0; // frameStartTime of the iteration
+        Time total = 0; // whole iteration, excluding the FPS-limit sleep
+        Time phase[(size_t)FramePhase::_COUNT] = {};
+        bool drawn = false; // false when redraw-on-demand skipped the draw
+    };
+
+    static void setFrameProfiler(bool enable);
+    static bool isFrameProfilerEnabled();
+    // Stacked per-frame bar graph painted over everything in frame().
+    static void setFrameProfilerOverlay(bool show);
+    // Main thread only. Credits `us` to the iteration in progress.
+    static void addFramePhaseTime(FramePhase phase, Time us);
+    // Recorded frames, oldest first.
+    static std::vector<FrameProfile> getFrameProfiles();
+    // Writes getFrameProfiles() as CSV (one row per frame, microseconds).
+    static bool exportFrameProfiles(const std::string& path);
+
     static GenericEvent* getGlobalFocusChangeEvent();
     static VoidEvent* getGlobalHintsUpdateEvent();
     static Event<InputType>* getGlobalInputTypeChangeEvent();
@@ -446,6 +528,38 @@ class Application
     inline static int deactivatedFPS       = 5; // FPS 5
     inline static int deactivatedTime      = 5000000; // 5s
 
+    // See setRedrawOnDemand above.
+    inline static bool redrawOnDemand       = false;
+    inline static std::atomic<bool> frameDirty{true};
+    inline static bool inFrame              = false; // layout passes inside frame() don't count
+    inline static Time lastDirtyTime        = 0;
+    inline static Time redrawSettleTime     = 1000000; // 1s
+    inline static Time idlePollTime         = 16666;   // ~60 Hz input polling while idle
+
+    static bool consumeFrameDirty();
+
+    // See post above.
+    inline static std::mutex postedTasksMutex;
+    inline static std::deque<std::function<void()>> postedTasks[(size_t)TaskPriority::_COUNT];
+    inline static Time taskBudget = 4000; // 4ms, a quarter of a 60 FPS frame
+
+    static void runPostedTasks();
+
+    // See setFrameProfiler above.
+    static constexpr size_t FRAME_PROFILE_CAPACITY = 600; // 10s at 60 FPS
+    inline static bool frameProfilerEnabled = false;
+    inline static bool frameProfilerOverlay = false;
+    inline static std::vector<FrameProfile> frameProfiles; // ring buffer
+    inline static size_t frameProfileHead   = 0;           // next slot to write
+    inline static size_t frameProfileCount  = 0;
+    inline static FrameProfile currentFrameProfile;
+    inline static Time profileMark          = 0;
+    inline static Time profileNestedAtMark  = 0;
+    inline static Time layoutPassStart      = 0;
+
+    static void profileLap(FramePhase phase);
+    static void drawFrameProfilerOverlay(NVGcontext* vg);
+
     inline static View* repetitionOldFocus = nullptr;
 
     inline static GenericEvent globalFocusChangeEvent;
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <math.h>
 #include <memory.h>
+#include <string.h>
 
 #include "nanovg.h"
 #define FONTSTASH_IMPLEMENTATION
@@ -70,6 +71,17 @@
 
 #define NVG_COUNTOF(arr) (sizeof(arr) / sizeof(0[arr]))
 
+// Whole-string text measurement cache. nvgTextBounds / nvgTextBoxBounds are
+// what brls::Label's measure and layout paths call, and every one re-walks
+// the string through fontstash (glyph lookup + kerning per pair) even though
+// the same titles are measured again on every relayout and focus change.
+// Results are keyed by the full font state plus the text bytes.
+#ifndef NVG_TEXT_CACHE_SIZE
+#	define NVG_TEXT_CACHE_SIZE 1024	// entries, must be a power of two
+#endif
+#define NVG_TEXT_CACHE_PROBES 8
+#define NVG_TEXT_CACHE_MAX_LEN 256	// longer strings (summaries) bypass the cache
+
 
 enum NVGcommands {
 	NVG_MOVETO = 0,
@@ -133,6 +145,39 @@ struct NVGpathCache {
 };
 typedef struct NVGpathCache NVGpathCache;
 
+enum NVGtextCacheKind {
+	NVG_TEXTCACHE_BOUNDS = 1,
+	NVG_TEXTCACHE_BOXBOUNDS = 2,
+};
+
+// All-float/int so the key can be compared with memcmp (no padding). No
+// draw position: entries are measured at the origin and offset on the way
+// out, so the same string drawn anywhere shares one entry.
+struct NVGtextKey {
+	int kind;
+	int fontId;
+	int align;
+	float scale;
+	float size;
+	float spacing;
+	float blur;
+	float dilate;
+	float lineHeight;
+	float breakRowWidth;
+};
+typedef struct NVGtextKey NVGtextKey;
+
+struct NVGtextMeasure {
+	NVGtextKey key;
+	unsigned int hash;	// 0 = empty slot
+	unsigned int stamp;	// last use, for eviction within a probe window
+	int len;
+	char* text;
+	float width;
+	float bounds[4];
+};
+typedef struct NVGtextMeasure NVGtextMeasure;
+
 struct NVGcontext {
 	NVGparams params;
 	float* commands;
@@ -158,6 +203,9 @@ struct NVGcontext {
 	// accumulated and flushed as one render call (see nvgTextBatchBegin).
 	int textBatch;
 	int textBatchNVerts;
+	// Whole-string measurement cache, allocated on first use.
+	NVGtextMeasure* textCache;
+	unsigned int textCacheStamp;
 };
 
 static float nvg__sqrtf(float a) { return sqrtf(a); }
@@ -190,6 +238,7 @@ static float nvg__normalize(float *x, float* y)
 }
 
 static void nvg__flushTextTexture(NVGcontext* ctx);
+static void nvg__textCacheClear(NVGcontext* ctx);
 
 static void nvg__deletePathCache(NVGpathCache* c)
 {
@@ -376,6 +425,10 @@ void nvgDeleteInternal(NVGcontext* ctx)
 	if (ctx == NULL) return;
 	if (ctx->commands != NULL) free(ctx->commands);
 	if (ctx->cache != NULL) nvg__deletePathCache(ctx->cache);
+	if (ctx->textCache != NULL) {
+		nvg__textCacheClear(ctx);
+		free(ctx->textCache);
+	}
 
 	if (ctx->fs)
 		fonsDeleteInternal(ctx->fs);
@@ -2331,21 +2384,25 @@ void nvgStroke(NVGcontext* ctx)
 // Add fonts
 int nvgCreateFont(NVGcontext* ctx, const char* name, const char* filename)
 {
+	nvg__textCacheClear(ctx);
 	return fonsAddFont(ctx->fs, name, filename, 0);
 }
 
 int nvgCreateFontAtIndex(NVGcontext* ctx, const char* name, const char* filename, const int fontIndex)
 {
+	nvg__textCacheClear(ctx);
 	return fonsAddFont(ctx->fs, name, filename, fontIndex);
 }
 
 int nvgCreateFontMem(NVGcontext* ctx, const char* name, unsigned char* data, int ndata, int freeData)
 {
+	nvg__textCacheClear(ctx);
 	return fonsAddFontMem(ctx->fs, name, data, ndata, freeData, 0);
 }
 
 int nvgCreateFontMemAtIndex(NVGcontext* ctx, const char* name, unsigned char* data, int ndata, int freeData, const int fontIndex)
 {
+	nvg__textCacheClear(ctx);
 	return fonsAddFontMem(ctx->fs, name, data, ndata, freeData, fontIndex);
 }
 
@@ -2359,6 +2416,8 @@ int nvgFindFont(NVGcontext* ctx, const char* name)
 int nvgAddFallbackFontId(NVGcontext* ctx, int baseFont, int fallbackFont)
 {
 	if(baseFont == -1 || fallbackFont == -1) return 0;
+	// A new fallback changes how previously-missing glyphs measure.
+	nvg__textCacheClear(ctx);
 	return fonsAddFallbackFont(ctx->fs, baseFont, fallbackFont);
 }
 
@@ -2369,6 +2428,7 @@ int nvgAddFallbackFont(NVGcontext* ctx, const char* baseFont, const char* fallba
 
 void nvgResetFallbackFontsId(NVGcontext* ctx, int baseFont)
 {
+	nvg__textCacheClear(ctx);
 	fonsResetFallbackFont(ctx->fs, baseFont);
 }
 
@@ -3075,15 +3135,134 @@ int nvgTextBreakLines(NVGcontext* ctx, const char* string, const char* end, floa
 	return nrows;
 }
 
+static void nvg__textCacheClear(NVGcontext* ctx)
+{
+	int i;
+	if (ctx->textCache == NULL) return;
+	for (i = 0; i < NVG_TEXT_CACHE_SIZE; i++) {
+		if (ctx->textCache[i].text != NULL) free(ctx->textCache[i].text);
+	}
+	memset(ctx->textCache, 0, sizeof(NVGtextMeasure) * NVG_TEXT_CACHE_SIZE);
+}
+
+static void nvg__textCacheKey(NVGcontext* ctx, NVGtextKey* key, int kind, float scale,
+							  float breakRowWidth)
+{
+	NVGstate* state = nvg__getState(ctx);
+	memset(key, 0, sizeof(*key));
+	key->kind = kind;
+	key->fontId = state->fontId;
+	key->align = state->textAlign;
+	key->scale = scale;
+	key->size = state->fontSize;
+	key->spacing = state->letterSpacing;
+	key->blur = state->fontBlur;
+	key->dilate = state->fontDilate;
+	key->lineHeight = state->lineHeight;
+	key->breakRowWidth = breakRowWidth;
+}
+
+static void nvg__textBoundsOffset(float* bounds, const float* src, float x, float y)
+{
+	bounds[0] = src[0] + x;
+	bounds[1] = src[1] + y;
+	bounds[2] = src[2] + x;
+	bounds[3] = src[3] + y;
+}
+
+static unsigned int nvg__textCacheHash(const NVGtextKey* key, const char* string, int len)
+{
+	// FNV-1a over the key and the text bytes.
+	const unsigned char* p = (const unsigned char*)key;
+	unsigned int h = 2166136261u;
+	int i;
+	for (i = 0; i < (int)sizeof(*key); i++) { h ^= p[i]; h *= 16777619u; }
+	p = (const unsigned char*)string;
+	for (i = 0; i < len; i++) { h ^= p[i]; h *= 16777619u; }
+	return h != 0 ? h : 1u;
+}
+
+static NVGtextMeasure* nvg__textCacheFind(NVGcontext* ctx, const NVGtextKey* key, unsigned int hash,
+										  const char* string, int len)
+{
+	unsigned int idx, i;
+	if (ctx->textCache == NULL) return NULL;
+	idx = hash & (NVG_TEXT_CACHE_SIZE - 1);
+	for (i = 0; i < NVG_TEXT_CACHE_PROBES; i++) {
+		NVGtextMeasure* e = &ctx->textCache[(idx + i) & (NVG_TEXT_CACHE_SIZE - 1)];
+		if (e->hash == 0) return NULL;
+		if (e->hash == hash && e->len == len &&
+			memcmp(&e->key, key, sizeof(*key)) == 0 &&
+			memcmp(e->text, string, len) == 0) {
+			e->stamp = ++ctx->textCacheStamp;
+			return e;
+		}
+	}
+	return NULL;
+}
+
+static void nvg__textCacheStore(NVGcontext* ctx, const NVGtextKey* key, unsigned int hash,
+								const char* string, int len, float width, const float* bounds)
+{
+	NVGtextMeasure* e = NULL;
+	unsigned int idx, i;
+	char* text;
+
+	if (ctx->textCache == NULL) {
+		ctx->textCache = (NVGtextMeasure*)calloc(NVG_TEXT_CACHE_SIZE, sizeof(NVGtextMeasure));
+		if (ctx->textCache == NULL) return;
+	}
+
+	// First empty slot in the probe window, else the least recently used.
+	idx = hash & (NVG_TEXT_CACHE_SIZE - 1);
+	for (i = 0; i < NVG_TEXT_CACHE_PROBES; i++) {
+		NVGtextMeasure* c = &ctx->textCache[(idx + i) & (NVG_TEXT_CACHE_SIZE - 1)];
+		if (c->hash == 0) { e = c; break; }
+		if (e == NULL || c->stamp < e->stamp) e = c;
+	}
+
+	text = (char*)malloc(len > 0 ? len : 1);
+	if (text == NULL) return;
+	memcpy(text, string, len);
+
+	if (e->text != NULL) free(e->text);
+	e->key = *key;
+	e->hash = hash;
+	e->stamp = ++ctx->textCacheStamp;
+	e->len = len;
+	e->text = text;
+	e->width = width;
+	memcpy(e->bounds, bounds, sizeof(e->bounds));
+}
+
 float nvgTextBounds(NVGcontext* ctx, float x, float y, const char* string, const char* end, float* bounds)
 {
 	NVGstate* state = nvg__getState(ctx);
 	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
 	float invscale = 1.0f / scale;
 	float width;
+	float b[4];
+	NVGtextKey key;
+	NVGtextMeasure* hit;
+	unsigned int hash = 0;
+	int len;
 
 	if (state->fontId == FONS_INVALID) return 0;
 
+	if (end == NULL)
+		end = string + strlen(string);
+	len = (int)(end - string);
+	if (len <= NVG_TEXT_CACHE_MAX_LEN) {
+		nvg__textCacheKey(ctx, &key, NVG_TEXTCACHE_BOUNDS, scale, 0.0f);
+		hash = nvg__textCacheHash(&key, string, len);
+		hit = nvg__textCacheFind(ctx, &key, hash, string, len);
+		if (hit != NULL) {
+			if (bounds != NULL)
+				nvg__textBoundsOffset(bounds, hit->bounds, x, y);
+			return hit->width;
+		}
+	}
+
 	fonsSetSize(ctx->fs, state->fontSize*scale);
 	fonsSetSpacing(ctx->fs, state->letterSpacing*scale);
 	fonsSetBlur(ctx->fs, state->fontBlur*scale);
@@ -3091,19 +3270,24 @@ float nvgTextBounds(NVGcontext* ctx, float x, float y, const char* string, const
 	fonsSetAlign(ctx->fs, state->textAlign);
 	fonsSetFont(ctx->fs, state->fontId);
 
-	width = fonsTextBounds(ctx->fs, x*scale, y*scale, string, end, bounds);
-	if (bounds != NULL) {
-		// Use line bounds for height.
-		fonsLineBounds(ctx->fs, y*scale, &bounds[1], &bounds[3]);
-		bounds[0] *= invscale;
-		bounds[1] *= invscale;
-		bounds[2] *= invscale;
-		bounds[3] *= invscale;
-	}
-	return width * invscale;
+	// Measured at the origin (see NVGtextKey); the caller's x/y is added below.
+	width = fonsTextBounds(ctx->fs, 0.0f, 0.0f, string, end, b);
+	// Use line bounds for height.
+	fonsLineBounds(ctx->fs, 0.0f, &b[1], &b[3]);
+	b[0] *= invscale;
+	b[1] *= invscale;
+	b[2] *= invscale;
+	b[3] *= invscale;
+	width *= invscale;
+
+	if (len <= NVG_TEXT_CACHE_MAX_LEN)
+		nvg__textCacheStore(ctx, &key, hash, string, len, width, b);
+	if (bounds != NULL)
+		nvg__textBoundsOffset(bounds, b, x, y);
+	return width;
 }
 
-void nvgTextBoxBounds(NVGcontext* ctx, float x, float y, float breakRowWidth, const char* string, const char* end, float* bounds)
+static void nvg__textBoxBoundsUncached(NVGcontext* ctx, float x, float y, float breakRowWidth, const char* string, const char* end, float* bounds)
 {
 	NVGstate* state = nvg__getState(ctx);
 	NVGtextRow rows[2];
@@ -3173,6 +3357,46 @@ void nvgTextBoxBounds(NVGcontext* ctx, float x, float y, float breakRowWidth, co
 	}
 }
 
+void nvgTextBoxBounds(NVGcontext* ctx, float x, float y, float breakRowWidth, const char* string, const char* end, float* bounds)
+{
+	NVGstate* state = nvg__getState(ctx);
+	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float b[4];
+	NVGtextKey key;
+	NVGtextMeasure* hit;
+	unsigned int hash;
+	int len;
+
+	if (state->fontId == FONS_INVALID || string == NULL) {
+		nvg__textBoxBoundsUncached(ctx, x, y, breakRowWidth, string, end, bounds);
+		return;
+	}
+
+	if (end == NULL)
+		end = string + strlen(string);
+	len = (int)(end - string);
+	if (len > NVG_TEXT_CACHE_MAX_LEN) {
+		nvg__textBoxBoundsUncached(ctx, x, y, breakRowWidth, string, end, bounds);
+		return;
+	}
+
+	// The width constraint is part of the key, so a label re-measured at
+	// the same width (every relayout) skips nvgTextBreakLines entirely.
+	nvg__textCacheKey(ctx, &key, NVG_TEXTCACHE_BOXBOUNDS, scale, breakRowWidth);
+	hash = nvg__textCacheHash(&key, string, len);
+	hit = nvg__textCacheFind(ctx, &key, hash, string, len);
+	if (hit != NULL) {
+		if (bounds != NULL)
+			nvg__textBoundsOffset(bounds, hit->bounds, x, y);
+		return;
+	}
+
+	nvg__textBoxBoundsUncached(ctx, 0.0f, 0.0f, breakRowWidth, string, end, b);
+	nvg__textCacheStore(ctx, &key, hash, string, len, 0.0f, b);
+	if (bounds != NULL)
+		nvg__textBoundsOffset(bounds, b, x, y);
+}
+
 void nvgTextMetrics(NVGcontext* ctx, float* ascender, float* descender, float* lineh)
 {
 	NVGstate* state = nvg__getState(ctx);
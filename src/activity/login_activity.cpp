@@ -188,6 +188,7 @@ public:
 
         const double t  = brls::getCPUTimeUsec() / 1000000.0;
         const float  a0 = static_cast<float>(t * 2.0 * NVG_PI);  // ~1 rev / sec
+        brls::Application::markDirty();  // keep spinning under redraw-on-demand
         nvgBeginPath(vg);
         nvgArc(vg, cx, cy, r, a0, a0 + NVG_PI * 0.85f, NVG_CW);
         nvgStrokeColor(vg, colA(kGold, a)); nvgStrokeWidth(vg, sw);
@@ -227,6 +228,7 @@ public:
                 const float r  = side / 2.0f - 2.0f;
                 const double t = brls::getCPUTimeUsec() / 1000000.0;
                 const float a0 = static_cast<float>(t * 2.0 * NVG_PI);
+                brls::Application::markDirty();
                 nvgBeginPath(vg);
                 nvgArc(vg, cx, cy, r, a0, a0 + NVG_PI * 1.4f, NVG_CW);
                 nvgStrokeColor(vg, colA(kGold, a));
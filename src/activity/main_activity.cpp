@@ -11,6 +11,7 @@
 #include "view/downloads_tab.hpp"
 #include "view/sidebar_editor.hpp"
 #include "view/long_press_gesture.hpp"
+#include "view/lazy_tab.hpp"
 #include "app/hint_icons.hpp"
 #include "app/downloads_manager.hpp"
 #include "app/application.hpp"
@@ -25,6 +26,7 @@
 #endif
 
 #include <algorithm>
+#include <functional>
 
 namespace vitaplex {
 
@@ -278,6 +280,12 @@ static brls::Box* withMusicBack(brls::View* content) {
     return wrap;
 }
 
+// Sidebar tabs are built through LazyTab so passing over an item in the
+// sidebar doesn't construct its tab; see view/lazy_tab.hpp.
+static std::function<brls::View*()> lazyTab(LazyTab::Creator creator) {
+    return [creator]() { return new LazyTab(creator); };
+}
+
 // Paints the platform START glyph on a sidebar item while it's focused — the
 // discoverable "Start = edit sidebar" affordance, mirroring the focus hint the
 // media cells show (HintIcons::getResPath(BUTTON_START): F1 on desktop, the
@@ -361,9 +369,9 @@ void MainActivity::buildSidebarTabs() {
 
     // Offline: only Downloads + Settings are reachable, order doesn't apply.
     if (Application::getInstance().isOfflineMode()) {
-        tabFrame->addTab("Downloads", []() { return new DownloadsTab(); });
+        tabFrame->addTab("Downloads", lazyTab([]() { return new DownloadsTab(); }));
         tabFrame->addSeparator();
-        tabFrame->addTab("Settings", []() { return new SettingsTab(); });
+        tabFrame->addTab("Settings", lazyTab([]() { return new SettingsTab(); }));
         return;
     }
 
@@ -376,7 +384,7 @@ void MainActivity::buildSidebarTabs() {
                         || Application::getInstance().getSettings().lastHadLiveTV;
 
     // Home is always pinned to the top.
-    tabFrame->addTab("Home", []() { return withMusicBack(new HomeTab()); });
+    tabFrame->addTab("Home", lazyTab([]() { return withMusicBack(new HomeTab()); }));
 
     // Library sections — fetch synchronously + cache (libraries always live in
     // the sidebar now; there is no premade Library/Music tab mode).
@@ -424,20 +432,20 @@ void MainActivity::buildSidebarTabs() {
             const LibrarySection* sec = findSection(key);
             if (!sec) continue;
             std::string k = sec->key, t = sec->title, ty = sec->type;
-            tabFrame->addTab(t, [k, t, ty]() { return withMusicBack(new LibrarySectionTab(k, t, ty)); });
+            tabFrame->addTab(t, lazyTab([k, t, ty]() { return withMusicBack(new LibrarySectionTab(k, t, ty)); }));
         } else {
             // Search is always shown; only Live TV / Downloads can be hidden
             // (via Settings ▸ Interface ▸ Manage Hidden Libraries).
             if (id != "search" && sidebarCsvHas(settings.hiddenSidebarItems, id)) continue;
-            if (id == "search")         tabFrame->addTab("Search",    []() { return withMusicBack(new SearchTab()); });
-            else if (id == "livetv")    tabFrame->addTab("Live TV",   []() { return new LiveTVTab(); });
-            else if (id == "downloads") tabFrame->addTab("Downloads", []() { return new DownloadsTab(); });
+            if (id == "search")         tabFrame->addTab("Search",    lazyTab([]() { return withMusicBack(new SearchTab()); }));
+            else if (id == "livetv")    tabFrame->addTab("Live TV",   lazyTab([]() { return new LiveTVTab(); }));
+            else if (id == "downloads") tabFrame->addTab("Downloads", lazyTab([]() { return new DownloadsTab(); }));
         }
     }
 
     // Settings is always pinned to the bottom.
     tabFrame->addSeparator();
-    tabFrame->addTab("Settings", []() { return new SettingsTab(); });
+    tabFrame->addTab("Settings", lazyTab([]() { return new SettingsTab(); }));
 
     // Hold any sidebar item to open the editor (touch equivalent of START), and
     // show a focus-only START hint so the shortcut is discoverable.
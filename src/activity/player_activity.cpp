@@ -8,6 +8,7 @@
 #include "app/downloads_manager.hpp"
 #include "app/music_queue.hpp"
 #include "app/music_controller.hpp"
+#include "app/music_prefetch.hpp"
 #include "utils/now_playing.hpp"
 #include "app/plex_palette.hpp"
 #include "app/synclounge_session.hpp"
@@ -129,7 +130,8 @@ PlayerActivity* PlayerActivity::createWithQueue(const std::vector<MediaItem>& tr
         [activity]() { activity->playPrevious(); },
         [activity](const QueueItem* nextTrack) { activity->onTrackEnded(nextTrack); },
         [activity](bool on) { activity->setShuffleFromOs(on); },
-        [activity](RepeatMode m) { activity->setRepeatFromOs(m); }
+        [activity](RepeatMode m) { activity->setRepeatFromOs(m); },
+        [activity]() { activity->onGaplessAdvance(); }
     });
 
     brls::Logger::info("PlayerActivity created with queue of {} tracks, starting at {} (server={})",
@@ -151,7 +153,8 @@ PlayerActivity* PlayerActivity::createResumeQueue() {
         [activity]() { activity->playPrevious(); },
         [activity](const QueueItem* nextTrack) { activity->onTrackEnded(nextTrack); },
         [activity](bool on) { activity->setShuffleFromOs(on); },
-        [activity](RepeatMode m) { activity->setRepeatFromOs(m); }
+        [activity](RepeatMode m) { activity->setRepeatFromOs(m); },
+        [activity]() { activity->onGaplessAdvance(); }
     });
 
     brls::Logger::info("PlayerActivity resumed existing queue at index {}", queue.getCurrentIndex());
@@ -736,7 +739,11 @@ void PlayerActivity::onContentAvailable() {
         updateProgress();
         // Keep the OS media notification's play/pause honest while the player is
         // up (e.g. mpv paused by audio-focus loss). No-op unless it diverged.
-        if (m_isQueueMode) MusicController::getInstance().syncSessionState();
+        if (m_isQueueMode) {
+            MusicController::getInstance().syncSessionState();
+            MusicController::getInstance().updateGapless();
+            MusicPrefetch::getInstance().update();
+        }
 
         // Returning from the background (Android/iOS): while the app was hidden
         // the OS tore down our GL surface, so a cover that finished loading during
@@ -993,12 +1000,18 @@ void PlayerActivity::loadFromQueue() {
     // without restarting the track (user pressed circle to return to player)
     MpvPlayer& resumePlayer = MpvPlayer::getInstance();
     if (m_isResuming && resumePlayer.isInitialized() &&
-        (resumePlayer.isPlaying() || resumePlayer.isPaused())) {
+        (resumePlayer.isPlaying() || resumePlayer.isPaused() || resumePlayer.isLoading())) {
         brls::Logger::info("PlayerActivity: Resuming existing playback, skipping reload");
         m_isPlaying = resumePlayer.isPlaying();
         m_mediaKey = track->ratingKey;
         m_isResuming = false;
 
+        // Timeline reports are suppressed for downloaded tracks; after a
+        // gapless advance the new track may differ from the last one.
+        DownloadItem localCheck;
+        m_isLocalFile = DownloadsManager::getInstance().getDownloadCopy(track->ratingKey, localCheck) &&
+                        localCheck.state == DownloadState::COMPLETED;
+
         // Update display labels and album art, then return without reloading
         if (musicTitleLabel) musicTitleLabel->setText(track->title);
         if (musicArtistLabel) musicArtistLabel->setText(track->artist);
@@ -1089,8 +1102,11 @@ void PlayerActivity::loadFromQueue() {
     } else {
         // Stream from server
         m_isLocalFile = false;  // Reset in case previous track was local
+        // A read-ahead copy still counts as online playback: timeline
+        // reports go out as for a stream.
         PlexClient& client = PlexClient::getInstance();
-        if (!client.getTranscodeUrl(track->ratingKey, url, 0)) {
+        if (!MusicPrefetch::getInstance().cachedPath(track->ratingKey, url) &&
+            !client.getTranscodeUrl(track->ratingKey, url, 0)) {
             brls::Logger::error("Failed to get transcode URL for track: {}", track->ratingKey);
             m_loadingMedia = false;
             return;
@@ -3094,6 +3110,19 @@ void PlayerActivity::updateRepeatIcon() {
     }
 }
 
+// MusicController saw mpv move on to the track it appended ahead of time,
+// sent the finished track's "stopped" timeline and advanced the queue to the
+// new one: refresh the screen through the resume path, which updates labels
+// and art without reloading the player.
+void PlayerActivity::onGaplessAdvance() {
+    if (m_destroying || !m_isQueueMode) return;
+    m_endHandled = false;
+    m_transcodeBaseOffsetMs = 0;   // the new track's stream starts at its beginning
+    m_lastTimelineState.clear();   // report the new track as playing right away
+    m_isResuming = true;
+    loadFromQueue();
+}
+
 void PlayerActivity::onTrackEnded(const QueueItem* nextTrack) {
     if (m_destroying) return;
 
@@ -5,6 +5,11 @@
 #include "app/application.hpp"
 #include "app/plex_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/home_snapshot.hpp"
+#include "app/metadata_cache.hpp"
+#include "app/music_prefetch.hpp"
+#include "app/library_index.hpp"
+#include "app/library_search.hpp"
 #include "app/plex_palette.hpp"
 #include "activity/login_activity.hpp"
 #include "activity/main_activity.hpp"
@@ -21,6 +26,7 @@
 #include <atomic>
 #include "platform/paths.hpp"
 #include "platform/platform.hpp"
+#include "utils/async.hpp"
 #include "utils/image_loader.hpp"
 #include "view/home_user_picker.hpp"
 
@@ -59,6 +65,8 @@ bool Application::init() {
     // Apply settings
     applyTheme();
     applyLogLevel();
+    brls::Application::setFrameProfiler(m_settings.showFrameProfiler);
+    brls::Application::setFrameProfilerOverlay(m_settings.showFrameProfiler);
 
     m_initialized = true;
     return true;
@@ -92,21 +100,35 @@ void Application::run() {
         brls::Logger::info("Restoring saved session...");
         // Verify connection and go to main
         PlexClient::getInstance().setAuthToken(m_authToken);
-        // Use connectToServer to properly initialize (including Live TV check)
-        if (PlexClient::getInstance().connectToServer(m_serverUrl)) {
+        if (HomeSnapshot::current()) {
+            // A saved Home for this server: show it straight away and verify
+            // the connection behind it. Home's own fetches go to the saved
+            // URL meanwhile; if it turns out to be unreachable they fail,
+            // the snapshot stays up and login is pushed over it.
+            brls::Logger::info("Restoring saved session from the Home snapshot");
+            PlexClient::getInstance().setServerUrl(m_serverUrl);
+            pushMainActivity();
+            const std::string serverUrl = m_serverUrl;
+            asyncRun([this, serverUrl]() {
+                const bool connected = PlexClient::getInstance().connectToServer(serverUrl);
+                brls::Application::post([this, connected]() {
+                    if (connected) {
+                        brls::Logger::info("Restored session and connected to server");
+                        finishSessionRestore();
+                    } else {
+                        brls::Logger::error("Failed to connect to saved server, showing login");
+                        pushLoginActivity();
+                    }
+                }, brls::Application::TaskPriority::HIGH);
+            });
+        } else if (PlexClient::getInstance().connectToServer(m_serverUrl)) {
+            // Use connectToServer to properly initialize (including Live TV check)
             brls::Logger::info("Restored session and connected to server");
-            // Bidirectional sync: push local offline progress, pull server progress
-            DownloadsManager::getInstance().init();
-            DownloadsManager::getInstance().syncProgressBidirectional();
             // Push Main first regardless — if the user backs out of the
             // picker (or never has one, because no Plex Home), they land
-            // on the app as the last-used user. Then overlay the picker
-            // when Auto-login is off. showHomeUserPicker no-ops when the
-            // account has no Plex Home or only the owner.
+            // on the app as the last-used user.
             pushMainActivity();
-            if (!m_settings.autoLoginAsLastUser) {
-                showHomeUserPicker(nullptr);
-            }
+            finishSessionRestore();
         } else {
             brls::Logger::error("Failed to connect to saved server, showing login");
             pushLoginActivity();
@@ -123,8 +145,21 @@ void Application::run() {
     }
 }
 
+// After a saved session reconnects: the offline-progress sync, then the
+// Home user picker when Auto-login is off. showHomeUserPicker no-ops when
+// the account has no Plex Home or only the owner.
+void Application::finishSessionRestore() {
+    // Bidirectional sync: push local offline progress, pull server progress
+    DownloadsManager::getInstance().init();
+    DownloadsManager::getInstance().syncProgressBidirectional();
+    if (!m_settings.autoLoginAsLastUser) {
+        showHomeUserPicker(nullptr);
+    }
+}
+
 void Application::shutdown() {
     saveSettings();
+    HomeSnapshot::flush();
     m_initialized = false;
     brls::Logger::info("VitaPlex shutting down");
 }
@@ -179,6 +214,14 @@ void Application::showHomeUserPicker(std::function<void()> onComplete) {
         // token — for a managed/shared user the server 401s and authenticates
         // as "guest". Resolve and adopt the per-server access token instead.
         PlexClient::getInstance().useHomeUserTokens(newToken);
+        // Library indexes carry the previous user's watch state.
+        if (user.uuid != app.getCurrentHomeUserUuid()) {
+            LibraryIndex::clear();
+            LibrarySearch::clear();
+            HomeSnapshot::clear();
+            MetadataCache::clear();
+            MusicPrefetch::getInstance().clear();
+        }
         app.setCurrentHomeUserUuid(user.uuid);
         app.setCurrentHomeUserTitle(user.title);
         app.saveSettings();
@@ -429,6 +472,7 @@ bool Application::loadSettings() {
     }
 
     m_settings.showMpvStats = extractBool("showMpvStats", false);
+    m_settings.showFrameProfiler = extractBool("showFrameProfiler", false);
 
     // Transcode settings. If the setting isn't present in the JSON, keep
     // the platform defaults Application::init() seeded earlier.
@@ -578,6 +622,7 @@ bool Application::saveSettings() {
     json += "  \"syncLoungeServer\": \"" + esc(m_settings.syncLoungeServer) + "\",\n";
     json += "  \"syncLoungeRoom\": \"" + esc(m_settings.syncLoungeRoom) + "\",\n";
     json += "  \"showMpvStats\": " + b(m_settings.showMpvStats) + ",\n";
+    json += "  \"showFrameProfiler\": " + b(m_settings.showFrameProfiler) + ",\n";
     json += "  \"videoQuality\": " + std::to_string(static_cast<int>(m_settings.videoQuality)) + ",\n";
     json += "  \"forceTranscode\": " + b(m_settings.forceTranscode) + ",\n";
     json += "  \"maxBitrate\": " + std::to_string(m_settings.maxBitrate) + ",\n";
@@ -314,10 +314,11 @@ void DownloadsManager::startDownloads() {
 
     brls::Logger::info("DownloadsManager: Starting download queue");
 
-    // Process downloads in background with larger stack size.
+    // Process downloads on a dedicated thread — it loops for as long as the
+    // queue runs, so it must not pin a pool worker — with a 512 KB stack:
     // downloadItem() has deep call stacks (HTTP, HLS parsing, file I/O)
     // that can overflow the Vita's default 256KB thread stack.
-    asyncRunLargeStack([this]() {
+    asyncRunDedicated([this]() {
         m_downloadThreadActive.store(true);
         brls::Logger::info("DownloadsManager: Download thread started");
 
@@ -594,13 +595,16 @@ void DownloadsManager::syncProgressFromServer() {
 
     brls::Logger::info("DownloadsManager: Pulling server progress for {} items", ratingKeys.size());
 
-    PlexClient& client = PlexClient::getInstance();
-    for (const auto& key : ratingKeys) {
-        MediaItem serverItem;
-        if (client.fetchMediaDetails(key, serverItem) && serverItem.viewOffset > 0) {
+    // One batched fetch for the whole library rather than a request per
+    // download, which made this sync take a minute on a full Vita card.
+    std::vector<MediaItem> serverItems;
+    if (!PlexClient::getInstance().fetchMediaDetailsBatch(ratingKeys, serverItems)) return;
+
+    for (const auto& serverItem : serverItems) {
+        if (serverItem.viewOffset > 0) {
             std::lock_guard<std::mutex> lock(m_mutex);
             for (auto& d : m_downloads) {
-                if (d.ratingKey == key) {
+                if (d.ratingKey == serverItem.ratingKey) {
                     // Use whichever progress is further ahead
                     if (serverItem.viewOffset > d.viewOffset) {
                         brls::Logger::info("DownloadsManager: Updated local progress for {} from {}ms to {}ms (from server)",
@@ -819,6 +823,109 @@ static std::string buildDirectDownloadUrl(const std::string& serverUrl, const st
     return url;
 }
 
+// Plex identification headers for a file download.
+static std::map<std::string, std::string> downloadHeaders(const std::string& token) {
+    const auto& vc = platform::getVideoConstraints();
+    std::map<std::string, std::string> headers;
+    headers["X-Plex-Client-Identifier"] = PLEX_CLIENT_NAME;
+    headers["X-Plex-Product"] = PLEX_CLIENT_NAME;
+    headers["X-Plex-Version"] = PLEX_CLIENT_VERSION;
+    headers["X-Plex-Platform"] = vc.plexPlatform;
+    headers["X-Plex-Device"] = vc.plexDevice;
+    headers["X-Plex-Device-Name"] = vc.plexDevice;
+    headers["X-Plex-Token"] = token;
+    return headers;
+}
+
+// Outcome of one fetchPartFile() attempt.
+struct PartFetch {
+    bool ok = false;            // transfer finished (or 416: the file was already whole)
+    bool openFailed = false;    // the local file couldn't be opened
+    int64_t totalBytes = 0;     // full size the server reported, 0 if unknown
+    int64_t bytes = 0;          // bytes of the file now on disk
+};
+
+// One attempt at fetching `url` into `path`. If a partial file already
+// exists, ask the server to continue from that byte via HTTP Range; a server
+// that doesn't honour it answers 200 and we restart from zero — we never
+// splice mismatched bytes into a half-file. `expectedSize` (0 if unknown)
+// guards the resume: a 206 for a file of another size means the server's
+// file changed. `onChunk(bytesOnDisk, fullSize)` runs after every write;
+// return false to stop.
+static PartFetch fetchPartFile(const std::string& url, const std::string& path,
+                               const std::map<std::string, std::string>& headers,
+                               int64_t expectedSize, const std::string& title,
+                               const std::function<bool(int64_t, int64_t)>& onChunk) {
+    PartFetch r;
+
+    // Trust the bytes actually on disk as the resume point.
+    int64_t resumeOffset = partFileSize(path);
+
+    PartFileWriter out;
+    bool alreadyComplete = false;   // server said 416 → file is whole
+
+    // Decide append-vs-truncate the instant the final status is known,
+    // before any body byte is delivered.
+    auto onStart = [&](int statusCode, int64_t fullSize) {
+        if (statusCode == 416) {
+            // Range past end of file — it's already fully downloaded.
+            alreadyComplete = true;
+            if (fullSize > 0) r.totalBytes = fullSize;
+            r.bytes = resumeOffset;
+            return;
+        }
+        bool resume = (statusCode == 206) && resumeOffset > 0;
+        // Guard: a 206 whose full size disagrees with the size we recorded
+        // earlier means the server's file changed — restart clean rather
+        // than append onto stale bytes.
+        if (resume && fullSize > 0 && expectedSize > 0 && fullSize != expectedSize) {
+            brls::Logger::warning("DownloadsManager: size changed ({} vs {}), restarting {}",
+                                  fullSize, expectedSize, title);
+            resume = false;
+        }
+        if (fullSize > 0) r.totalBytes = fullSize;
+        r.bytes = resume ? resumeOffset : 0;
+        if (!out.open(path, /*append=*/resume)) {
+            r.openFailed = true;
+            brls::Logger::error("DownloadsManager: Failed to open file {}", path);
+        } else if (resume) {
+            brls::Logger::info("DownloadsManager: Resuming {} from {} bytes",
+                               title, resumeOffset);
+        }
+    };
+
+    brls::Logger::debug("DownloadsManager: Downloading from {} (resume offset {})",
+                        url, resumeOffset);
+
+    HttpClient http;
+    r.ok = http.downloadFile(url,
+        [&](const char* data, size_t size) {
+            if (alreadyComplete) return false;   // 416: ignore any error body
+            if (r.openFailed) return false;
+            // Safety net: if the status path never opened a file, start fresh.
+            if (!out.isOpen()) {
+                r.bytes = 0;
+                if (!out.open(path, /*append=*/false)) { r.openFailed = true; return false; }
+            }
+            if (!out.write(data, size)) {
+                brls::Logger::error("DownloadsManager: Write failed (disk full?)");
+                return false;
+            }
+            r.bytes += size;
+            return onChunk(r.bytes, r.totalBytes);
+        },
+        /*sizeCallback*/ nullptr,   // full size comes from startCallback (correct for 206 + 200)
+        headers,
+        resumeOffset,
+        onStart
+    );
+    out.close();
+
+    if (alreadyComplete) r.ok = true;
+    if (r.openFailed) r.ok = false;
+    return r;
+}
+
 // Try downloading via the Plex Download Queue API (server-side transcode + file download).
 // This transcodes video to platform-compatible resolution before downloading.
 // Polls the queue status until transcoding is complete before returning the media URL.
@@ -1218,8 +1325,9 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     brls::Logger::info("DownloadsManager: Starting download of {}", item.title);
 
     PlexClient& client = PlexClient::getInstance();
-    std::string serverUrl = client.getServerUrl();
-    std::string token = client.getAuthToken();
+    const PlexSessionPtr session = client.session();
+    const std::string serverUrl = session->serverUrl;
+    const std::string token = session->authToken;
 
     // Fetch exact file size from Plex metadata API if not already known
     if (item.totalBytes <= 0) {
@@ -1418,15 +1526,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     item.state = DownloadState::DOWNLOADING;
 
     // Build Plex identification headers
-    const auto& vc = platform::getVideoConstraints();
-    std::map<std::string, std::string> dlHeaders;
-    dlHeaders["X-Plex-Client-Identifier"] = PLEX_CLIENT_NAME;
-    dlHeaders["X-Plex-Product"] = PLEX_CLIENT_NAME;
-    dlHeaders["X-Plex-Version"] = PLEX_CLIENT_VERSION;
-    dlHeaders["X-Plex-Platform"] = vc.plexPlatform;
-    dlHeaders["X-Plex-Device"] = vc.plexDevice;
-    dlHeaders["X-Plex-Device-Name"] = vc.plexDevice;
-    dlHeaders["X-Plex-Token"] = token;
+    std::map<std::string, std::string> dlHeaders = downloadHeaders(token);
     if (!profileExtra.empty()) {
         dlHeaders["X-Plex-Client-Profile-Name"] = "Generic";
         dlHeaders["X-Plex-Client-Profile-Extra"] = profileExtra;
@@ -1782,11 +1882,9 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
 
     } else {
         // Non-HLS download (audio direct download, or Download Queue API /media
-        // URL). Resume support: if a partial file already exists, ask the server
-        // to continue from that byte via HTTP Range. The Download Queue /media
-        // file and direct ?download=1 files both honour it (206 Partial Content);
-        // a server that doesn't answers 200 and we transparently restart from
-        // zero — we never splice mismatched bytes into a half-file.
+        // URL), resumed from a partial file by fetchPartFile(). The Download
+        // Queue /media file and direct ?download=1 files both honour Range
+        // (206 Partial Content).
         const int maxDownloadAttempts = 3;
         for (int attempt = 0; attempt < maxDownloadAttempts && m_downloading.load(); attempt++) {
             if (attempt > 0) {
@@ -1803,71 +1901,19 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
             // Trust the bytes actually on disk as the resume point each attempt.
             int64_t resumeOffset = partFileSize(item.localPath);
 
-            PartFileWriter out;
-            bool alreadyComplete = false;   // server said 416 → file is whole
-            bool openFailed = false;
-
-            // Decide append-vs-truncate the instant the final status is known,
-            // before any body byte is delivered.
-            auto onStart = [&](int statusCode, int64_t fullSize) {
-                if (statusCode == 416) {
-                    // Range past end of file — it's already fully downloaded.
-                    alreadyComplete = true;
+            PartFetch r = fetchPartFile(url, item.localPath, dlHeaders, item.totalBytes, item.title,
+                [&](int64_t bytes, int64_t fullSize) {
                     if (fullSize > 0) item.totalBytes = fullSize;
-                    item.downloadedBytes = resumeOffset;
-                    return;
-                }
-                bool resume = (statusCode == 206) && resumeOffset > 0;
-                // Guard: a 206 whose full size disagrees with the size we recorded
-                // earlier means the server's file changed — restart clean rather
-                // than append onto stale bytes.
-                if (resume && fullSize > 0 && item.totalBytes > 0 && fullSize != item.totalBytes) {
-                    brls::Logger::warning("DownloadsManager: size changed ({} vs {}), restarting {}",
-                                          fullSize, item.totalBytes, item.title);
-                    resume = false;
-                }
-                if (fullSize > 0) item.totalBytes = fullSize;
-                item.downloadedBytes = resume ? resumeOffset : 0;
-                if (!out.open(item.localPath, /*append=*/resume)) {
-                    openFailed = true;
-                    brls::Logger::error("DownloadsManager: Failed to open file {}", item.localPath);
-                } else if (resume) {
-                    brls::Logger::info("DownloadsManager: Resuming {} from {} bytes",
-                                       item.title, resumeOffset);
-                }
-            };
-
-            brls::Logger::debug("DownloadsManager: Downloading from {} (resume offset {})",
-                                url, resumeOffset);
-
-            HttpClient http;
-            success = http.downloadFile(url,
-                [&](const char* data, size_t size) {
-                    if (alreadyComplete) return false;   // 416: ignore any error body
-                    if (openFailed) return false;
-                    // Safety net: if the status path never opened a file, start fresh.
-                    if (!out.isOpen()) {
-                        item.downloadedBytes = 0;
-                        if (!out.open(item.localPath, /*append=*/false)) { openFailed = true; return false; }
-                    }
-                    if (!out.write(data, size)) {
-                        brls::Logger::error("DownloadsManager: Write failed (disk full?)");
-                        return false;
-                    }
-                    item.downloadedBytes += size;
+                    item.downloadedBytes = bytes;
                     auto cb = m_progressCallback;
                     if (cb) cb(item.downloadedBytes, item.totalBytes);
                     return m_downloading.load() && item.state != DownloadState::CANCELLED;
-                },
-                /*sizeCallback*/ nullptr,   // full size comes from startCallback (correct for 206 + 200)
-                dlHeaders,
-                resumeOffset,
-                onStart
-            );
-            out.close();
+                });
+            if (r.totalBytes > 0) item.totalBytes = r.totalBytes;
+            item.downloadedBytes = r.bytes;
+            success = r.ok;
 
-            if (alreadyComplete) { success = true; break; }
-            if (openFailed) { item.state = DownloadState::FAILED; saveState(); return; }
+            if (r.openFailed) { item.state = DownloadState::FAILED; saveState(); return; }
 
             if (success || !m_downloading.load() || item.state == DownloadState::CANCELLED) {
                 break;
@@ -1921,10 +1967,24 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     saveState();
 }
 
+bool DownloadsManager::fetchPartToFile(const std::string& partPath, const std::string& path,
+                                       int64_t expectedSize, const std::function<bool()>& keepGoing) {
+    const PlexSessionPtr session = PlexClient::getInstance().session();
+    if (!session || session->serverUrl.empty() || session->authToken.empty()) return false;
+
+    const std::string url = buildDirectDownloadUrl(session->serverUrl, session->authToken, partPath);
+    if (url.empty()) return false;
+
+    PartFetch r = fetchPartFile(url, path, downloadHeaders(session->authToken), expectedSize, path,
+        [&](int64_t, int64_t) { return keepGoing(); });
+    return r.ok;
+}
+
 void DownloadsManager::downloadCoverArt(DownloadItem& item) {
     PlexClient& client = PlexClient::getInstance();
-    std::string serverUrl = client.getServerUrl();
-    std::string token = client.getAuthToken();
+    const PlexSessionPtr session = client.session();
+    const std::string serverUrl = session->serverUrl;
+    const std::string token = session->authToken;
 
     if (serverUrl.empty() || token.empty() || item.thumbUrl.empty()) return;
 
@@ -1987,8 +2047,9 @@ void DownloadsManager::downloadCoverArt(DownloadItem& item) {
 
 bool DownloadsManager::reportTimeline(const DownloadItem& item, const std::string& state) {
     PlexClient& client = PlexClient::getInstance();
-    std::string serverUrl = client.getServerUrl();
-    std::string token = client.getAuthToken();
+    const PlexSessionPtr session = client.session();
+    const std::string serverUrl = session->serverUrl;
+    const std::string token = session->authToken;
 
     if (serverUrl.empty() || token.empty()) {
         return false;
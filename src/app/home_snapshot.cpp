@@ -0,0 +1,283 @@
+/**
+ * VitaPlex - Home snapshot implementation
+ */
+
+#include "app/home_snapshot.hpp"
+#include "app/application.hpp"
+#include "platform/paths.hpp"
+#include "utils/async.hpp"
+
+#include <borealis.hpp>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+
+namespace vitaplex {
+
+// Bump when the item layout changes; an older file is then ignored and
+// replaced after the first refresh.
+static constexpr char kMagic[4] = {'V', 'P', 'H', 'S'};
+static constexpr uint32_t kVersion = 1;
+
+static std::mutex s_mutex;
+static std::mutex s_writeMutex;        // held across a file write / delete
+static HomeSnapshot::Ptr s_current;
+static bool s_read = false;            // the file has been tried once
+static uint64_t s_stored = 0;          // store() count...
+static uint64_t s_written = 0;         // ...and how many of them are on disk
+
+static std::string snapshotPath() {
+    return platformPath("home.snap");
+}
+
+// ---------------------------------------------------------------------------
+// On-disk format: magic, version, header, then four rails of items. Strings
+// are u32 length + bytes; numbers are host-endian, as in LibraryIndex.
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Writer {
+    std::string buf;
+
+    template <typename T>
+    void pod(T v) { buf.append(reinterpret_cast<const char*>(&v), sizeof(v)); }
+
+    void str(const std::string& s) {
+        pod<uint32_t>(static_cast<uint32_t>(s.size()));
+        buf.append(s);
+    }
+
+    void items(const std::vector<MediaItem>& rail) {
+        pod<uint32_t>(static_cast<uint32_t>(rail.size()));
+        for (const auto& item : rail) {
+            str(item.ratingKey);
+            str(item.key);
+            str(item.title);
+            str(item.summary);
+            str(item.thumb);
+            str(item.type);
+            str(item.parentTitle);
+            str(item.grandparentTitle);
+            str(item.grandparentThumb);
+            str(item.parentRatingKey);
+            str(item.grandparentRatingKey);
+            pod<int32_t>(static_cast<int32_t>(item.mediaType));
+            pod<int32_t>(item.year);
+            pod<int32_t>(item.duration);
+            pod<int32_t>(item.viewOffset);
+            pod<int32_t>(item.index);
+            pod<int32_t>(item.parentIndex);
+            pod<int32_t>(item.leafCount);
+            pod<int32_t>(item.viewedLeafCount);
+            pod<float>(item.rating);
+            pod<float>(item.audienceRating);
+            pod<uint8_t>(item.watched ? 1 : 0);
+        }
+    }
+};
+
+struct Reader {
+    const std::string& buf;
+    size_t pos = 0;
+    bool ok = true;
+
+    explicit Reader(const std::string& b) : buf(b) {}
+
+    template <typename T>
+    T pod() {
+        T v{};
+        if (!ok || buf.size() - pos < sizeof(T)) { ok = false; return v; }
+        std::memcpy(&v, buf.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return v;
+    }
+
+    std::string str() {
+        const uint32_t n = pod<uint32_t>();
+        if (!ok || buf.size() - pos < n) { ok = false; return {}; }
+        std::string s = buf.substr(pos, n);
+        pos += n;
+        return s;
+    }
+
+    std::vector<MediaItem> items() {
+        std::vector<MediaItem> rail;
+        const uint32_t count = pod<uint32_t>();
+        // A rail is a handful of items; anything bigger is a corrupt count.
+        if (count > 256) ok = false;
+        for (uint32_t i = 0; i < count && ok; i++) {
+            MediaItem item;
+            item.ratingKey = str();
+            item.key = str();
+            item.title = str();
+            item.summary = str();
+            item.thumb = str();
+            item.type = str();
+            item.parentTitle = str();
+            item.grandparentTitle = str();
+            item.grandparentThumb = str();
+            item.parentRatingKey = str();
+            item.grandparentRatingKey = str();
+            item.mediaType = static_cast<MediaType>(pod<int32_t>());
+            item.year = pod<int32_t>();
+            item.duration = pod<int32_t>();
+            item.viewOffset = pod<int32_t>();
+            item.index = pod<int32_t>();
+            item.parentIndex = pod<int32_t>();
+            item.leafCount = pod<int32_t>();
+            item.viewedLeafCount = pod<int32_t>();
+            item.rating = pod<float>();
+            item.audienceRating = pod<float>();
+            item.watched = pod<uint8_t>() != 0;
+            rail.push_back(std::move(item));
+        }
+        return rail;
+    }
+};
+
+HomeSnapshot::Ptr readFile(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) return nullptr;
+    std::stringstream ss;
+    ss << f.rdbuf();
+    const std::string buf = ss.str();
+
+    Reader r(buf);
+    char magic[4];
+    for (char& c : magic) c = r.pod<char>();
+    if (!r.ok || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) return nullptr;
+    if (r.pod<uint32_t>() != kVersion) return nullptr;
+
+    auto snap = std::make_shared<HomeSnapshot>();
+    snap->serverUrl = r.str();
+    snap->homeUserUuid = r.str();
+    snap->savedAt = r.pod<int64_t>();
+    snap->continueWatching = r.items();
+    snap->recentMovies = r.items();
+    snap->recentShows = r.items();
+    snap->recentMusic = r.items();
+    if (!r.ok) {
+        brls::Logger::warning("HomeSnapshot: {} is truncated, ignoring it", path);
+        return nullptr;
+    }
+    return snap;
+}
+
+bool writeFile(const std::string& path, const HomeSnapshot& snap) {
+    Writer w;
+    w.buf.append(kMagic, sizeof(kMagic));
+    w.pod<uint32_t>(kVersion);
+    w.str(snap.serverUrl);
+    w.str(snap.homeUserUuid);
+    w.pod<int64_t>(snap.savedAt);
+    w.items(snap.continueWatching);
+    w.items(snap.recentMovies);
+    w.items(snap.recentShows);
+    w.items(snap.recentMusic);
+
+    // Write-then-rename so a crash mid-write leaves the previous snapshot.
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) {
+            brls::Logger::warning("HomeSnapshot: failed to open {} for write", tmp);
+            return false;
+        }
+        f.write(w.buf.data(), static_cast<std::streamsize>(w.buf.size()));
+        if (!f) {
+            brls::Logger::warning("HomeSnapshot: short write to {}", tmp);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        brls::Logger::warning("HomeSnapshot: failed to replace {}: {}", path, ec.message());
+        return false;
+    }
+    brls::Logger::debug("HomeSnapshot: saved ({} bytes)", w.buf.size());
+    return true;
+}
+
+// Write the latest stored snapshot unless it's already on disk. Serialised
+// by s_writeMutex so a slow write can't land after a newer one (or after
+// clear()).
+void writeLatest() {
+    std::lock_guard<std::mutex> writeLock(s_writeMutex);
+
+    HomeSnapshot::Ptr snap;
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (s_written == s_stored || !s_current) return;
+        snap = s_current;
+        version = s_stored;
+    }
+    if (!writeFile(snapshotPath(), *snap)) return;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_written < version) s_written = version;
+}
+
+} // namespace
+
+HomeSnapshot::Ptr HomeSnapshot::current() {
+    Ptr snap;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_read) {
+            s_read = true;
+            const int64_t t0 = brls::getCPUTimeUsec();
+            s_current = readFile(snapshotPath());
+            if (s_current)
+                brls::Logger::info("HomeSnapshot: loaded in {}ms",
+                                   (brls::getCPUTimeUsec() - t0) / 1000);
+        }
+        snap = s_current;
+    }
+    if (!snap) return nullptr;
+
+    const Application& app = Application::getInstance();
+    if (snap->serverUrl != app.getServerUrl() ||
+        snap->homeUserUuid != app.getCurrentHomeUserUuid())
+        return nullptr;
+    return snap;
+}
+
+void HomeSnapshot::store(HomeSnapshot snapshot) {
+    const Application& app = Application::getInstance();
+    snapshot.serverUrl = app.getServerUrl();
+    snapshot.homeUserUuid = app.getCurrentHomeUserUuid();
+    snapshot.savedAt = (int64_t)time(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_current = std::make_shared<const HomeSnapshot>(std::move(snapshot));
+        s_read = true;   // what's on disk is older than this anyway
+        s_stored++;
+    }
+    asyncRun(writeLatest);
+}
+
+void HomeSnapshot::flush() {
+    writeLatest();
+}
+
+void HomeSnapshot::clear() {
+    std::lock_guard<std::mutex> writeLock(s_writeMutex);
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_current.reset();
+        s_read = true;
+        s_written = s_stored;   // nothing left to flush
+    }
+    std::error_code ec;
+    std::filesystem::remove(snapshotPath(), ec);
+    if (ec) brls::Logger::warning("HomeSnapshot: clear() failed: {}", ec.message());
+}
+
+} // namespace vitaplex
@@ -0,0 +1,501 @@
+/**
+ * VitaPlex - Local library index implementation
+ */
+
+#include "app/library_index.hpp"
+#include "platform/paths.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+#include <unordered_map>
+
+namespace vitaplex {
+
+// Bump when the entry layout changes; older files are then ignored and
+// rebuilt by the next sync.
+static constexpr char kMagic[4] = {'V', 'P', 'L', 'I'};
+static constexpr uint32_t kVersion = 2;
+
+// The most recently loaded / synced index. Leaving a section and coming
+// straight back is the common case, and re-reading a large section from the
+// memory card costs more than keeping one index around.
+static std::mutex s_recentMutex;
+static LibraryIndex::Ptr s_recent;
+static std::string s_recentServerId;
+
+// Sections with a sync running. A second sync of the same section (the tab
+// re-opened, or search refreshing it) would only repeat the same listing.
+static std::mutex s_syncingMutex;
+static std::vector<std::string> s_syncing;
+
+// Sync pages are bigger than grid pages: nothing renders them, and on a
+// remote server round-trips dominate. Still platform-scaled so Vita doesn't
+// hold a multi-megabyte response in memory.
+static int syncPageSize() {
+    int page = platform::getImageConstraints().libraryPageSize;
+    if (page <= 0) page = 60;
+    return std::max(240, page * 4);
+}
+
+// "2010-07-16" -> 20100716
+static int32_t parseReleaseDate(const std::string& s) {
+    if (s.size() < 10) return 0;
+    int y = atoi(s.c_str()), m = atoi(s.c_str() + 5), d = atoi(s.c_str() + 8);
+    if (y <= 0) return 0;
+    return y * 10000 + m * 100 + d;
+}
+
+LibraryIndexEntry LibraryIndexEntry::fromMediaItem(const MediaItem& item) {
+    LibraryIndexEntry e;
+    e.ratingKey = item.ratingKey;
+    e.key = item.key;
+    e.title = item.title;
+    e.titleSort = item.titleSort;
+    e.thumb = item.thumb;
+    e.type = item.type;
+    e.contentRating = item.contentRating;
+    e.subtype = item.subtype;
+    e.mediaType = item.mediaType;
+    e.year = item.year;
+    e.duration = item.duration;
+    e.releaseDate = parseReleaseDate(item.originallyAvailableAt);
+    e.rating = item.rating;
+    e.audienceRating = item.audienceRating;
+    e.addedAt = item.addedAt;
+    e.updatedAt = item.updatedAt;
+    e.lastViewedAt = item.lastViewedAt;
+    e.watched = item.watched;
+    e.videoResolution = item.videoResolution;
+    e.genres = item.genres;
+    return e;
+}
+
+MediaItem LibraryIndexEntry::toMediaItem() const {
+    MediaItem item;
+    item.ratingKey = ratingKey;
+    item.key = key;
+    item.title = title;
+    item.titleSort = titleSort;
+    item.thumb = thumb;
+    item.type = type;
+    item.mediaType = mediaType;
+    item.contentRating = contentRating;
+    item.subtype = subtype;
+    item.year = year;
+    item.duration = duration;
+    item.rating = rating;
+    item.audienceRating = audienceRating;
+    item.addedAt = addedAt;
+    item.updatedAt = updatedAt;
+    item.lastViewedAt = lastViewedAt;
+    item.watched = watched;
+    item.videoResolution = videoResolution;
+    if (releaseDate > 0) {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "%04d-%02d-%02d",
+                      releaseDate / 10000, (releaseDate / 100) % 100, releaseDate % 100);
+        item.originallyAvailableAt = buf;
+    }
+    return item;
+}
+
+// ---------------------------------------------------------------------------
+// On-disk format: magic, version, header, then the entries back to back.
+// Strings are u32 length + bytes; numbers are host-endian (the file never
+// leaves the device that wrote it).
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Writer {
+    std::string buf;
+
+    template <typename T>
+    void pod(T v) { buf.append(reinterpret_cast<const char*>(&v), sizeof(v)); }
+
+    void str(const std::string& s) {
+        pod<uint32_t>(static_cast<uint32_t>(s.size()));
+        buf.append(s);
+    }
+};
+
+struct Reader {
+    const std::string& buf;
+    size_t pos = 0;
+    bool ok = true;
+
+    explicit Reader(const std::string& b) : buf(b) {}
+
+    template <typename T>
+    T pod() {
+        T v{};
+        if (!ok || buf.size() - pos < sizeof(T)) { ok = false; return v; }
+        std::memcpy(&v, buf.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return v;
+    }
+
+    std::string str() {
+        const uint32_t n = pod<uint32_t>();
+        if (!ok || buf.size() - pos < n) { ok = false; return {}; }
+        std::string s = buf.substr(pos, n);
+        pos += n;
+        return s;
+    }
+};
+
+// Replace entries whose ratingKey reappears in `changed`, append the rest.
+void mergeInto(std::vector<LibraryIndexEntry>& entries, std::vector<LibraryIndexEntry>&& changed) {
+    std::unordered_map<std::string, size_t> byKey;
+    byKey.reserve(entries.size() + changed.size());
+    for (size_t i = 0; i < entries.size(); i++) byKey[entries[i].ratingKey] = i;
+    for (auto& e : changed) {
+        auto it = byKey.find(e.ratingKey);
+        if (it != byKey.end()) {
+            entries[it->second] = std::move(e);
+        } else {
+            byKey.emplace(e.ratingKey, entries.size());
+            entries.push_back(std::move(e));
+        }
+    }
+}
+
+} // namespace
+
+std::string LibraryIndex::indexDir() {
+    return platformPath("library");
+}
+
+std::string LibraryIndex::pathFor(const std::string& serverId, const std::string& sectionKey) {
+    // machineIdentifier is hex and section keys are numeric, so the name is
+    // filesystem-safe as-is.
+    return indexDir() + "/" + serverId + "_" + sectionKey + ".idx";
+}
+
+LibraryIndex::Ptr LibraryIndex::readFile(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) return nullptr;
+    std::stringstream ss;
+    ss << f.rdbuf();
+    const std::string buf = ss.str();
+
+    Reader r(buf);
+    char magic[4];
+    for (char& c : magic) c = r.pod<char>();
+    if (!r.ok || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) return nullptr;
+    if (r.pod<uint32_t>() != kVersion) return nullptr;
+
+    auto index = std::make_shared<LibraryIndex>();
+    index->m_serverId = r.str();
+    index->m_sectionKey = r.str();
+    index->m_metadataType = r.pod<int32_t>();
+    index->m_syncedAt = r.pod<int64_t>();
+    const uint32_t count = r.pod<uint32_t>();
+    if (!r.ok) return nullptr;
+
+    // Every entry takes at least its fixed-size fields, so a corrupt count
+    // can't make us reserve more than the file could hold.
+    index->m_entries.reserve(std::min<size_t>(count, buf.size() / 64));
+    for (uint32_t i = 0; i < count && r.ok; i++) {
+        LibraryIndexEntry e;
+        e.ratingKey = r.str();
+        e.key = r.str();
+        e.title = r.str();
+        e.titleSort = r.str();
+        e.thumb = r.str();
+        e.type = r.str();
+        e.contentRating = r.str();
+        e.subtype = r.str();
+        e.mediaType = static_cast<MediaType>(r.pod<int32_t>());
+        e.year = r.pod<int32_t>();
+        e.duration = r.pod<int32_t>();
+        e.releaseDate = r.pod<int32_t>();
+        e.rating = r.pod<float>();
+        e.audienceRating = r.pod<float>();
+        e.addedAt = r.pod<int64_t>();
+        e.updatedAt = r.pod<int64_t>();
+        e.lastViewedAt = r.pod<int64_t>();
+        e.watched = r.pod<uint8_t>() != 0;
+        e.videoResolution = r.str();
+        const uint32_t genreCount = r.pod<uint32_t>();
+        for (uint32_t g = 0; g < genreCount && r.ok; g++) e.genres.push_back(r.str());
+        index->m_entries.push_back(std::move(e));
+    }
+    if (!r.ok) {
+        brls::Logger::warning("LibraryIndex: {} is truncated, ignoring it", path);
+        return nullptr;
+    }
+    return index;
+}
+
+void LibraryIndex::writeFile(const std::string& path, const LibraryIndex& index) {
+    const std::string dir = indexDir();
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        brls::Logger::warning("LibraryIndex: failed to create {}: {}", dir, ec.message());
+        return;
+    }
+
+    Writer w;
+    w.buf.reserve(64 + index.m_entries.size() * 160);
+    w.buf.append(kMagic, sizeof(kMagic));
+    w.pod<uint32_t>(kVersion);
+    w.str(index.m_serverId);
+    w.str(index.m_sectionKey);
+    w.pod<int32_t>(index.m_metadataType);
+    w.pod<int64_t>(index.m_syncedAt);
+    w.pod<uint32_t>(static_cast<uint32_t>(index.m_entries.size()));
+    for (const auto& e : index.m_entries) {
+        w.str(e.ratingKey);
+        w.str(e.key);
+        w.str(e.title);
+        w.str(e.titleSort);
+        w.str(e.thumb);
+        w.str(e.type);
+        w.str(e.contentRating);
+        w.str(e.subtype);
+        w.pod<int32_t>(static_cast<int32_t>(e.mediaType));
+        w.pod<int32_t>(e.year);
+        w.pod<int32_t>(e.duration);
+        w.pod<int32_t>(e.releaseDate);
+        w.pod<float>(e.rating);
+        w.pod<float>(e.audienceRating);
+        w.pod<int64_t>(e.addedAt);
+        w.pod<int64_t>(e.updatedAt);
+        w.pod<int64_t>(e.lastViewedAt);
+        w.pod<uint8_t>(e.watched ? 1 : 0);
+        w.str(e.videoResolution);
+        w.pod<uint32_t>(static_cast<uint32_t>(e.genres.size()));
+        for (const auto& g : e.genres) w.str(g);
+    }
+
+    // Write-then-rename so a crash mid-write leaves the previous index
+    // intact instead of a truncated one.
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) {
+            brls::Logger::warning("LibraryIndex: failed to open {} for write", tmp);
+            return;
+        }
+        f.write(w.buf.data(), static_cast<std::streamsize>(w.buf.size()));
+        if (!f) {
+            brls::Logger::warning("LibraryIndex: short write to {}", tmp);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        brls::Logger::warning("LibraryIndex: failed to replace {}: {}", path, ec.message());
+        return;
+    }
+    brls::Logger::debug("LibraryIndex: saved section {} ({} items, {} KB)",
+                        index.m_sectionKey, index.m_entries.size(), w.buf.size() / 1024);
+}
+
+// Plex type codes: 1=movie, 2=show, 8=artist, 9=album, 10=track
+int LibraryIndex::metadataTypeFor(const std::string& sectionType) {
+    if (sectionType == "movie") return 1;
+    if (sectionType == "show") return 2;
+    if (sectionType == "artist") return 8;
+    return 0;
+}
+
+LibraryIndex::Ptr LibraryIndex::load(const std::string& sectionKey, bool remember) {
+    const std::string serverId = PlexClient::getInstance().session()->server.machineIdentifier;
+    if (serverId.empty()) return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(s_recentMutex);
+        if (s_recent && s_recentServerId == serverId && s_recent->m_sectionKey == sectionKey)
+            return s_recent;
+    }
+
+    const int64_t t0 = brls::getCPUTimeUsec();
+    Ptr index = readFile(pathFor(serverId, sectionKey));
+    if (!index || index->m_serverId != serverId || index->m_sectionKey != sectionKey)
+        return nullptr;
+    brls::Logger::info("LibraryIndex: loaded section {} ({} items) in {}ms",
+                       sectionKey, index->size(), (brls::getCPUTimeUsec() - t0) / 1000);
+    if (!remember) return index;
+
+    std::lock_guard<std::mutex> lock(s_recentMutex);
+    s_recent = index;
+    s_recentServerId = serverId;
+    return index;
+}
+
+bool LibraryIndex::fetchAll(const std::string& sectionKey, int metadataType,
+                            const std::string& filter, std::vector<LibraryIndexEntry>& out,
+                            int* totalCount) {
+    PlexClient& client = PlexClient::getInstance();
+    // Oldest-added first: anything added while we page lands after the
+    // current offset instead of shifting earlier pages under us.
+    const std::string params = "&sort=addedAt:asc" + filter;
+    const int pageSize = syncPageSize();
+    int offset = 0;
+    int total = -1;
+    for (;;) {
+        std::vector<MediaItem> page;
+        int pageTotal = 0;
+        if (!client.fetchLibraryContent(sectionKey, page, metadataType, pageSize, offset,
+                                        &pageTotal, params))
+            return false;
+        if (total < 0) total = pageTotal;
+        offset += static_cast<int>(page.size());
+        for (const auto& item : page) out.push_back(LibraryIndexEntry::fromMediaItem(item));
+        if (page.empty() || offset >= total) break;
+    }
+    if (totalCount) *totalCount = std::max(0, total);
+    return true;
+}
+
+LibraryIndex::Ptr LibraryIndex::sync(const std::string& sectionKey, int metadataType, const Ptr& base) {
+    const std::string serverId = PlexClient::getInstance().session()->server.machineIdentifier;
+    if (serverId.empty()) return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(s_syncingMutex);
+        if (std::find(s_syncing.begin(), s_syncing.end(), sectionKey) != s_syncing.end()) {
+            brls::Logger::debug("LibraryIndex: section {} is already syncing", sectionKey);
+            return nullptr;
+        }
+        s_syncing.push_back(sectionKey);
+    }
+    struct SyncingGuard {
+        const std::string& key;
+        ~SyncingGuard() {
+            std::lock_guard<std::mutex> lock(s_syncingMutex);
+            s_syncing.erase(std::find(s_syncing.begin(), s_syncing.end(), key));
+        }
+    } syncing{sectionKey};
+
+    const int64_t t0 = brls::getCPUTimeUsec();
+    auto next = std::make_shared<LibraryIndex>();
+    next->m_serverId = serverId;
+    next->m_sectionKey = sectionKey;
+    next->m_metadataType = metadataType;
+
+    bool full = !base || base->m_serverId != serverId || base->m_sectionKey != sectionKey ||
+                base->m_metadataType != metadataType || base->m_entries.empty();
+    size_t changedCount = 0;
+
+    if (!full) {
+        int64_t maxAdded = 0, maxUpdated = 0, maxViewed = 0;
+        for (const auto& e : base->m_entries) {
+            maxAdded = std::max(maxAdded, e.addedAt);
+            maxUpdated = std::max(maxUpdated, e.updatedAt);
+            maxViewed = std::max(maxViewed, e.lastViewedAt);
+        }
+
+        // ">>=" is Plex's strictly-greater filter operator ('>' escaped for
+        // the query string). Both watermarks step back a second so an item
+        // saved in the same second as the newest one held isn't missed;
+        // re-fetching that one is harmless.
+        std::vector<LibraryIndexEntry> changed;
+        int total = 0;
+        if (!fetchAll(sectionKey, metadataType,
+                      "&updatedAt%3E%3E=" + std::to_string(maxUpdated - 1), changed, nullptr) ||
+            !fetchAll(sectionKey, metadataType,
+                      "&addedAt%3E%3E=" + std::to_string(maxAdded - 1), changed, nullptr)) {
+            brls::Logger::info("LibraryIndex: delta sync of section {} failed, keeping local copy",
+                               sectionKey);
+            return nullptr;
+        }
+
+        // Plays don't move updatedAt. Best effort: a server that rejects the
+        // filter just leaves watch state as it was.
+        std::vector<LibraryIndexEntry> viewed;
+        if (fetchAll(sectionKey, metadataType,
+                     "&lastViewedAt%3E%3E=" + std::to_string(maxViewed - 1), viewed, nullptr)) {
+            std::move(viewed.begin(), viewed.end(), std::back_inserter(changed));
+        }
+
+        // totalSize of an unfiltered one-item page is the live section size.
+        std::vector<MediaItem> probe;
+        if (!PlexClient::getInstance().fetchLibraryContent(sectionKey, probe, metadataType, 1, 0,
+                                                           &total))
+            return nullptr;
+
+        // Anything whose timestamps haven't moved past what we hold is the
+        // watermark re-fetch, not a change.
+        std::unordered_map<std::string, const LibraryIndexEntry*> held;
+        held.reserve(base->m_entries.size());
+        for (const auto& e : base->m_entries) held[e.ratingKey] = &e;
+        for (const auto& e : changed) {
+            auto it = held.find(e.ratingKey);
+            if (it == held.end() || e.updatedAt > it->second->updatedAt ||
+                e.lastViewedAt > it->second->lastViewedAt || e.watched != it->second->watched)
+                changedCount++;
+        }
+
+        next->m_entries = base->m_entries;
+        mergeInto(next->m_entries, std::move(changed));
+
+        if (next->m_entries.size() != static_cast<size_t>(total)) {
+            // Deleted items never show up in a delta. Fewer on the server
+            // than we hold (or more, if a delta page was missed) leaves
+            // nothing to do but re-list the section.
+            brls::Logger::info("LibraryIndex: section {} holds {} items, server has {}; rebuilding",
+                               sectionKey, next->m_entries.size(), total);
+            full = true;
+        } else if (changedCount == 0) {
+            brls::Logger::debug("LibraryIndex: section {} up to date ({} items, {}ms)",
+                                sectionKey, total, (brls::getCPUTimeUsec() - t0) / 1000);
+            return base;
+        }
+    }
+
+    if (full) {
+        std::vector<LibraryIndexEntry> all;
+        int total = 0;
+        if (!fetchAll(sectionKey, metadataType, "", all, &total)) {
+            brls::Logger::info("LibraryIndex: full sync of section {} failed", sectionKey);
+            return nullptr;
+        }
+        next->m_entries.clear();
+        mergeInto(next->m_entries, std::move(all));   // dedups across page shifts
+        changedCount = next->m_entries.size();
+    }
+
+    next->m_entries.shrink_to_fit();
+    next->m_syncedAt = static_cast<int64_t>(std::time(nullptr));
+    writeFile(pathFor(serverId, sectionKey), *next);
+    brls::Logger::info("LibraryIndex: synced section {} ({} items, {} changed, {}, {}ms)",
+                       sectionKey, next->size(), changedCount, full ? "full" : "delta",
+                       (brls::getCPUTimeUsec() - t0) / 1000);
+
+    std::lock_guard<std::mutex> lock(s_recentMutex);
+    s_recent = next;
+    s_recentServerId = serverId;
+    return next;
+}
+
+void LibraryIndex::clear() {
+    {
+        std::lock_guard<std::mutex> lock(s_recentMutex);
+        s_recent.reset();
+        s_recentServerId.clear();
+    }
+    std::error_code ec;
+    std::filesystem::remove_all(indexDir(), ec);
+    if (ec) {
+        brls::Logger::warning("LibraryIndex: clear() failed: {}", ec.message());
+    } else {
+        brls::Logger::info("LibraryIndex: cleared");
+    }
+}
+
+} // namespace vitaplex
@@ -0,0 +1,199 @@
+/**
+ * VitaPlex - Library query engine implementation
+ */
+
+#include "app/library_query.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <cctype>
+
+namespace vitaplex {
+
+static std::string lowerCase(const std::string& s) {
+    std::string out = s;
+    for (auto& c : out) c = (char)std::tolower((unsigned char)c);
+    return out;
+}
+
+// Split "addedAt:desc" into field + direction.
+static std::string sortField(const std::string& sortParam, bool* desc) {
+    const size_t colon = sortParam.find(':');
+    if (desc) *desc = colon != std::string::npos && sortParam.compare(colon + 1, 4, "desc") == 0;
+    return sortParam.substr(0, colon);
+}
+
+void LibraryQuery::set(Bitmap& bitmap, uint32_t i) const {
+    if (bitmap.empty()) bitmap.assign(m_words, 0);
+    bitmap[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+LibraryQuery::Ptr LibraryQuery::build(LibraryIndex::Ptr index) {
+    if (!index) return nullptr;
+    const int64_t t0 = brls::getCPUTimeUsec();
+
+    auto q = std::make_shared<LibraryQuery>();
+    q->m_index = std::move(index);
+    const auto& entries = q->m_index->entries();
+    const uint32_t n = (uint32_t)entries.size();
+    q->m_words = (n + 63) / 64;
+
+    std::vector<uint32_t> identity(n);
+    for (uint32_t i = 0; i < n; i++) identity[i] = i;
+
+    // Title order first, folded once up front: Plex's titleSort when set,
+    // else the title. Case-insensitive byte order is close enough to Plex's
+    // collation for the ASCII titles that dominate real libraries.
+    {
+        std::vector<std::string> folded(n);
+        for (uint32_t i = 0; i < n; i++)
+            folded[i] = lowerCase(entries[i].titleSort.empty() ? entries[i].title
+                                                               : entries[i].titleSort);
+        std::vector<uint32_t> byTitle = identity;
+        std::stable_sort(byTitle.begin(), byTitle.end(),
+                         [&](uint32_t a, uint32_t b) { return folded[a] < folded[b]; });
+        q->m_sortedDesc["titleSort"].assign(byTitle.rbegin(), byTitle.rend());
+        q->m_sorted["titleSort"] = std::move(byTitle);
+    }
+    std::vector<uint32_t> titleRank(n);
+    {
+        const auto& byTitle = q->m_sorted["titleSort"];
+        for (uint32_t r = 0; r < n; r++) titleRank[byTitle[r]] = r;
+    }
+
+    // Every other sort: its key, then title rank — integer compares only.
+    // Descending is the key runs of the ascending order back to front, each
+    // run kept as is: ties stay in ascending title order both ways, as the
+    // server returns them, where reversing the whole permutation would flip
+    // the tie-break too.
+    auto sortBy = [&](const char* field, auto key) {
+        std::vector<uint32_t> order = identity;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            const auto ka = key(entries[a]), kb = key(entries[b]);
+            if (ka != kb) return ka < kb;
+            return titleRank[a] < titleRank[b];
+        });
+        std::vector<uint32_t> desc;
+        desc.reserve(n);
+        for (size_t end = order.size(); end > 0;) {
+            size_t begin = end - 1;
+            while (begin > 0 && key(entries[order[begin - 1]]) == key(entries[order[end - 1]]))
+                begin--;
+            desc.insert(desc.end(), order.begin() + begin, order.begin() + end);
+            end = begin;
+        }
+        // Cheap next to the sort: check the descending order really is key
+        // descending with ascending titles among equal keys.
+        for (size_t r = 1; r < desc.size(); r++) {
+            const auto ka = key(entries[desc[r - 1]]), kb = key(entries[desc[r]]);
+            if (ka < kb || (ka == kb && titleRank[desc[r - 1]] > titleRank[desc[r]])) {
+                brls::Logger::error("LibraryQuery: {} descending order broken at {}", field, r);
+                break;
+            }
+        }
+        q->m_sorted[field] = std::move(order);
+        q->m_sortedDesc[field] = std::move(desc);
+    };
+    sortBy("year", [](const LibraryIndexEntry& e) { return e.year; });
+    sortBy("originallyAvailableAt", [](const LibraryIndexEntry& e) { return e.releaseDate; });
+    sortBy("rating", [](const LibraryIndexEntry& e) { return e.rating; });
+    sortBy("addedAt", [](const LibraryIndexEntry& e) { return e.addedAt; });
+    sortBy("duration", [](const LibraryIndexEntry& e) { return e.duration; });
+
+    for (uint32_t i = 0; i < n; i++) {
+        const LibraryIndexEntry& e = entries[i];
+        for (const auto& g : e.genres) q->set(q->m_genre[lowerCase(g)], i);
+        if (!e.contentRating.empty()) q->set(q->m_contentRating[lowerCase(e.contentRating)], i);
+        if (!e.videoResolution.empty()) q->set(q->m_resolution[lowerCase(e.videoResolution)], i);
+        if (e.year > 0) {
+            q->set(q->m_year[std::to_string(e.year)], i);
+            q->set(q->m_decade[std::to_string(e.year / 10 * 10)], i);
+        }
+        q->set(e.watched ? q->m_watched : q->m_unwatched, i);
+    }
+
+    brls::Logger::debug("LibraryQuery: built section {} ({} items, {} genres) in {}ms",
+                        q->m_index->sectionKey(), n, q->m_genre.size(),
+                        (brls::getCPUTimeUsec() - t0) / 1000);
+    return q;
+}
+
+bool LibraryQuery::canSort(const std::string& sortParam) {
+    static const char* kFields[] = {
+        "titleSort", "year", "originallyAvailableAt", "rating", "addedAt", "duration",
+    };
+    const std::string field = sortField(sortParam, nullptr);
+    for (const char* f : kFields)
+        if (field == f) return true;
+    return false;
+}
+
+bool LibraryQuery::canFilter(const std::string& field) {
+    return field == "genre" || field == "year" || field == "decade" ||
+           field == "contentRating" || field == "resolution" || field == "unwatched";
+}
+
+bool LibraryQuery::canRun(const std::string& sortParam, const Filters& filters) {
+    if (!canSort(sortParam)) return false;
+    for (const auto& kv : filters)
+        if (!kv.second.values.empty() && !canFilter(kv.first)) return false;
+    return true;
+}
+
+const LibraryQuery::Bitmap* LibraryQuery::lookup(
+        const std::string& field, const std::pair<std::string, std::string>& value) const {
+    auto find = [](const std::unordered_map<std::string, Bitmap>& map,
+                   const std::string& k) -> const Bitmap* {
+        auto it = map.find(k);
+        return it != map.end() ? &it->second : nullptr;
+    };
+    if (field == "genre") return find(m_genre, lowerCase(value.second));
+    if (field == "contentRating") return find(m_contentRating, lowerCase(value.second));
+    if (field == "resolution") return find(m_resolution, lowerCase(value.first));
+    if (field == "year") return find(m_year, value.first);
+    if (field == "decade") return find(m_decade, value.first);
+    // Watch Status: unwatched=1 is unplayed, unwatched=0 played.
+    if (field == "unwatched") return value.first == "0" ? &m_watched : &m_unwatched;
+    return nullptr;
+}
+
+std::vector<uint32_t> LibraryQuery::run(const std::string& sortParam,
+                                        const Filters& filters) const {
+    Bitmap mask;
+    bool masked = false;
+    for (const auto& kv : filters) {
+        const Filter& f = kv.second;
+        if (f.values.empty()) continue;
+        Bitmap fieldMask(m_words, f.andMode ? ~(uint64_t)0 : 0);
+        for (const auto& v : f.values) {
+            const Bitmap* b = lookup(kv.first, v);
+            for (size_t w = 0; w < m_words; w++) {
+                const uint64_t bits = (b && !b->empty()) ? (*b)[w] : 0;
+                fieldMask[w] = f.andMode ? (fieldMask[w] & bits) : (fieldMask[w] | bits);
+            }
+        }
+        if (!masked) {
+            mask = std::move(fieldMask);
+            masked = true;
+        } else {
+            for (size_t w = 0; w < m_words; w++) mask[w] &= fieldMask[w];
+        }
+    }
+
+    bool desc = false;
+    const std::string field = sortField(sortParam, &desc);
+    const auto& sorted = desc ? m_sortedDesc : m_sorted;
+    auto it = sorted.find(field);
+    if (it == sorted.end()) it = sorted.find("titleSort");
+    const std::vector<uint32_t>& order = it->second;
+
+    std::vector<uint32_t> out;
+    out.reserve(masked ? 0 : order.size());
+    auto keep = [&](uint32_t i) {
+        if (!masked || (mask[i / 64] >> (i % 64)) & 1) out.push_back(i);
+    };
+    for (uint32_t i : order) keep(i);
+    return out;
+}
+
+} // namespace vitaplex
@@ -0,0 +1,313 @@
+/**
+ * VitaPlex - Local search index implementation
+ */
+
+#include "app/library_search.hpp"
+#include "app/application.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <utility>
+
+namespace vitaplex {
+
+static std::mutex s_mutex;                 // guards s_current / s_generation
+static LibrarySearch::Ptr s_current;
+static uint64_t s_generation = 0;          // bumped by clear()
+static int64_t s_refreshedAt = 0;          // last refresh() publish, guarded by s_mutex
+static std::mutex s_buildMutex;            // one build at a time
+static std::atomic<bool> s_refreshing{false};
+
+static uint64_t currentGeneration() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_generation;
+}
+
+// Append `in` to `out` folded for matching: ASCII lower-cased, every other
+// ASCII byte a single separating space, UTF-8 bytes kept as they are (so
+// accented titles still match themselves). No leading / trailing space.
+static void foldInto(const std::string& in, std::string& out) {
+    const size_t start = out.size();
+    for (unsigned char c : in) {
+        if (c >= 0x80 || std::isalnum(c)) {
+            out.push_back((char)std::tolower(c));
+        } else if (out.size() > start && out.back() != ' ') {
+            out.push_back(' ');
+        }
+    }
+    if (out.size() > start && out.back() == ' ') out.pop_back();
+}
+
+static uint32_t trigramAt(const char* p) {
+    return ((uint32_t)(unsigned char)p[0] << 16) | ((uint32_t)(unsigned char)p[1] << 8) |
+           (uint32_t)(unsigned char)p[2];
+}
+
+static bool startsWith(std::string_view s, std::string_view prefix) {
+    return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+}
+
+static std::vector<std::string_view> splitWords(std::string_view s) {
+    std::vector<std::string_view> words;
+    size_t i = 0;
+    while (i < s.size()) {
+        size_t j = s.find(' ', i);
+        if (j == std::string_view::npos) j = s.size();
+        if (j > i) words.push_back(s.substr(i, j - i));
+        i = j + 1;
+    }
+    return words;
+}
+
+LibrarySearch::Ptr LibrarySearch::current() {
+    const std::string serverId = PlexClient::getInstance().session()->server.machineIdentifier;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_current || s_current->m_serverId != serverId) return nullptr;
+    return s_current;
+}
+
+LibrarySearch::Ptr LibrarySearch::build(std::vector<LibraryIndex::Ptr> indexes,
+                                        const std::string& serverId) {
+    const int64_t t0 = brls::getCPUTimeUsec();
+    auto s = std::make_shared<LibrarySearch>();
+    s->m_serverId = serverId;
+    s->m_indexes = std::move(indexes);
+
+    size_t n = 0;
+    for (const auto& index : s->m_indexes) n += index->size();
+    s->m_docs.reserve(n);
+    s->m_ratingKeys.reserve(n);
+
+    std::vector<std::pair<uint32_t, uint32_t>> grams;   // (trigram, doc)
+    std::vector<uint32_t> docGrams;
+    for (const auto& index : s->m_indexes) {
+        for (const LibraryIndexEntry& e : index->entries()) {
+            if (!s->m_ratingKeys.insert(e.ratingKey).second) continue;
+            const uint32_t text = (uint32_t)s->m_text.size();
+            foldInto(e.title, s->m_text);
+            const uint32_t len = (uint32_t)s->m_text.size() - text;
+            if (len == 0) continue;   // nothing searchable; still contains()
+            const uint32_t doc = (uint32_t)s->m_docs.size();
+            s->m_docs.push_back({&e, text, len});
+
+            const char* p = s->m_text.data() + text;
+            for (uint32_t i = 0; i < len;) {
+                uint32_t j = i;
+                while (j < len && p[j] != ' ') j++;
+                s->m_tokens.push_back({text + i, j - i, doc});
+                i = j + 1;
+            }
+
+            docGrams.clear();
+            for (uint32_t i = 0; i + 3 <= len; i++) docGrams.push_back(trigramAt(p + i));
+            std::sort(docGrams.begin(), docGrams.end());
+            docGrams.erase(std::unique(docGrams.begin(), docGrams.end()), docGrams.end());
+            for (uint32_t g : docGrams) grams.emplace_back(g, doc);
+        }
+    }
+    s->m_text.shrink_to_fit();
+
+    const char* text = s->m_text.data();
+    std::sort(s->m_tokens.begin(), s->m_tokens.end(), [text](const Token& a, const Token& b) {
+        return std::string_view(text + a.text, a.len) < std::string_view(text + b.text, b.len);
+    });
+
+    // Docs were appended in order, so each trigram's run stays ascending.
+    std::sort(grams.begin(), grams.end());
+    s->m_trigramDocs.reserve(grams.size());
+    for (size_t i = 0; i < grams.size(); i++) {
+        if (i == 0 || grams[i].first != grams[i - 1].first) {
+            s->m_trigrams.push_back(grams[i].first);
+            s->m_trigramStart.push_back((uint32_t)s->m_trigramDocs.size());
+        }
+        s->m_trigramDocs.push_back(grams[i].second);
+    }
+    s->m_trigramStart.push_back((uint32_t)s->m_trigramDocs.size());
+
+    brls::Logger::debug("LibrarySearch: built {} titles from {} sections ({} tokens, {} trigrams) in {}ms",
+                        s->m_docs.size(), s->m_indexes.size(), s->m_tokens.size(),
+                        s->m_trigrams.size(), (brls::getCPUTimeUsec() - t0) / 1000);
+    return s;
+}
+
+void LibrarySearch::publish(std::vector<LibraryIndex::Ptr> indexes, const std::string& serverId,
+                            uint64_t generation) {
+    std::lock_guard<std::mutex> buildLock(s_buildMutex);
+
+    // A section tab may have swapped in a newer copy of a section while
+    // this caller was loading or syncing; don't roll it back.
+    if (Ptr held = current()) {
+        for (auto& index : indexes) {
+            for (const auto& h : held->m_indexes) {
+                if (h->sectionKey() == index->sectionKey() && h->syncedAt() > index->syncedAt())
+                    index = h;
+            }
+        }
+    }
+
+    Ptr next = build(std::move(indexes), serverId);
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (generation != s_generation) return;   // cleared while building
+    s_current = std::move(next);
+}
+
+bool LibrarySearch::needsRefresh() {
+    if (!current()) return true;
+    const int64_t maxAge = Application::getInstance().getSettings().cacheLifetimeMinutes * 60;
+    const int64_t now = static_cast<int64_t>(std::time(nullptr));
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return now - s_refreshedAt > maxAge;
+}
+
+bool LibrarySearch::refresh() {
+    if (s_refreshing.exchange(true)) return false;
+    struct Done { ~Done() { s_refreshing = false; } } done;
+    if (!needsRefresh()) return false;
+
+    const uint64_t generation = currentGeneration();
+    PlexClient& client = PlexClient::getInstance();
+    const std::string serverId = client.session()->server.machineIdentifier;
+    if (serverId.empty()) return false;
+
+    std::vector<LibrarySection> sections;
+    if (!client.fetchLibrarySections(sections)) return false;
+
+    // Only sections never synced are listed here. One that is merely stale
+    // is searched as it is; its tab's own delta sync swaps the fresh copy in
+    // through update().
+    std::vector<LibraryIndex::Ptr> indexes;
+    for (const auto& section : sections) {
+        const int metadataType = LibraryIndex::metadataTypeFor(section.type);
+        if (metadataType == 0) continue;
+        LibraryIndex::Ptr index = LibraryIndex::load(section.key, false);
+        if (!index) index = LibraryIndex::sync(section.key, metadataType, nullptr);
+        if (index) indexes.push_back(std::move(index));
+    }
+
+    publish(std::move(indexes), serverId, generation);
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (generation == s_generation) s_refreshedAt = static_cast<int64_t>(std::time(nullptr));
+    return true;
+}
+
+void LibrarySearch::update(const LibraryIndex::Ptr& index) {
+    if (!index) return;
+    const uint64_t generation = currentGeneration();
+    Ptr held = current();
+    if (!held) return;
+
+    std::vector<LibraryIndex::Ptr> indexes = held->m_indexes;
+    auto it = std::find_if(indexes.begin(), indexes.end(), [&](const LibraryIndex::Ptr& i) {
+        return i->sectionKey() == index->sectionKey();
+    });
+    if (it != indexes.end()) *it = index;
+    else indexes.push_back(index);
+    publish(std::move(indexes), held->m_serverId, generation);
+}
+
+void LibrarySearch::clear() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_current.reset();
+    s_refreshedAt = 0;
+    s_generation++;
+}
+
+bool LibrarySearch::contains(const std::string& ratingKey) const {
+    return m_ratingKeys.count(ratingKey) != 0;
+}
+
+std::vector<MediaItem> LibrarySearch::search(const std::string& query, size_t limitPerType) const {
+    std::vector<MediaItem> out;
+    std::string q;
+    foldInto(query, q);
+    if (q.empty() || m_docs.empty()) return out;
+    const std::vector<std::string_view> words = splitWords(q);
+
+    const char* text = m_text.data();
+    auto title = [&](uint32_t doc) {
+        return std::string_view(text + m_docs[doc].text, m_docs[doc].len);
+    };
+
+    // Higher is better: the whole title, a title prefix, every query word
+    // starting some title word, then a match anywhere inside the title.
+    enum : uint8_t { kSubstring = 1, kWords = 2, kPrefix = 3, kExact = 4 };
+    std::vector<std::pair<uint32_t, uint8_t>> hits;   // (doc, score)
+
+    // Word-prefix candidates come from the longest query word, the most
+    // selective one; every other word is checked against the title.
+    std::string_view pivot = *std::max_element(
+        words.begin(), words.end(),
+        [](std::string_view a, std::string_view b) { return a.size() < b.size(); });
+    auto lo = std::lower_bound(m_tokens.begin(), m_tokens.end(), pivot,
+                               [text](const Token& t, std::string_view v) {
+                                   return std::string_view(text + t.text, t.len) < v;
+                               });
+    std::vector<uint32_t> candidates;
+    for (auto it = lo; it != m_tokens.end() &&
+                       startsWith(std::string_view(text + it->text, it->len), pivot); ++it)
+        candidates.push_back(it->doc);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (uint32_t doc : candidates) {
+        const std::string_view t = title(doc);
+        if (t == q) { hits.emplace_back(doc, kExact); continue; }
+        if (startsWith(t, q)) { hits.emplace_back(doc, kPrefix); continue; }
+        const std::vector<std::string_view> titleWords = splitWords(t);
+        bool all = true;
+        for (std::string_view w : words) {
+            all = std::any_of(titleWords.begin(), titleWords.end(),
+                              [w](std::string_view tw) { return startsWith(tw, w); });
+            if (!all) break;
+        }
+        if (all) hits.emplace_back(doc, kWords);
+    }
+
+    // Inside-a-word matches: walk the rarest trigram's postings and confirm
+    // with a plain find. Shorter queries would match half the library.
+    if (q.size() >= 3) {
+        size_t best = SIZE_MAX, bestLen = SIZE_MAX;
+        for (size_t i = 0; i + 3 <= q.size(); i++) {
+            auto g = std::lower_bound(m_trigrams.begin(), m_trigrams.end(), trigramAt(q.data() + i));
+            if (g == m_trigrams.end() || *g != trigramAt(q.data() + i)) { best = SIZE_MAX; break; }
+            const size_t gi = (size_t)(g - m_trigrams.begin());
+            const size_t len = m_trigramStart[gi + 1] - m_trigramStart[gi];
+            if (len < bestLen) { best = gi; bestLen = len; }
+        }
+        if (best != SIZE_MAX) {
+            const size_t wordHits = hits.size();   // these are in doc order
+            for (uint32_t k = m_trigramStart[best]; k < m_trigramStart[best + 1]; k++) {
+                const uint32_t doc = m_trigramDocs[k];
+                auto end = hits.begin() + wordHits;
+                auto seen = std::lower_bound(hits.begin(), end, std::make_pair(doc, (uint8_t)0));
+                if (seen != end && seen->first == doc) continue;
+                if (title(doc).find(q) != std::string_view::npos) hits.emplace_back(doc, kSubstring);
+            }
+        }
+    }
+
+    // Best score first; among equals the shorter (closer) title, then A-Z.
+    std::sort(hits.begin(), hits.end(), [&](const auto& a, const auto& b) {
+        if (a.second != b.second) return a.second > b.second;
+        if (m_docs[a.first].len != m_docs[b.first].len)
+            return m_docs[a.first].len < m_docs[b.first].len;
+        return title(a.first) < title(b.first);
+    });
+
+    std::map<MediaType, size_t> perType;
+    for (const auto& hit : hits) {
+        const LibraryIndexEntry& e = *m_docs[hit.first].entry;
+        if (perType[e.mediaType]++ >= limitPerType) continue;
+        out.push_back(e.toMediaItem());
+    }
+    return out;
+}
+
+} // namespace vitaplex
@@ -0,0 +1,224 @@
+/**
+ * VitaPlex - Metadata cache implementation
+ */
+
+#include "app/metadata_cache.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vitaplex {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Kind = MetadataCache::Kind;
+
+struct Entry {
+    Kind kind;
+    std::string ratingKey;
+    std::vector<MediaItem> items;
+    size_t bytes = 0;
+    Clock::time_point storedAt;
+};
+
+// After this many invalidated keys the per-key versions are folded into
+// s_clearedAt, which costs at most a few in-flight puts.
+constexpr size_t kMaxTrackedKeys = 1024;
+
+std::mutex s_mutex;
+std::list<Entry> s_lru;   // most recently used first
+std::unordered_map<std::string, std::list<Entry>::iterator> s_index;
+size_t s_bytes = 0;
+uint64_t s_clock = 0;       // bumped by every invalidate() / clear()
+uint64_t s_clearedAt = 0;   // puts stamped before this are stale
+std::unordered_map<std::string, uint64_t> s_invalidatedAt;   // ratingKey -> s_clock
+
+std::string indexKey(Kind kind, const std::string& ratingKey) {
+    return std::string(1, static_cast<char>('0' + static_cast<int>(kind))) + ':' + ratingKey;
+}
+
+// Rough heap footprint; strings short enough for SSO count as free.
+size_t approxBytes(const MediaItem& item) {
+    auto str = [](const std::string& s) { return s.size() > 15 ? s.capacity() + 1 : 0; };
+    size_t n = sizeof(MediaItem);
+    for (const std::string* s : {&item.ratingKey, &item.key, &item.title, &item.summary,
+                                 &item.thumb, &item.art, &item.type, &item.contentRating,
+                                 &item.studio, &item.grandparentTitle, &item.parentTitle,
+                                 &item.grandparentThumb, &item.parentThumb,
+                                 &item.parentRatingKey, &item.grandparentRatingKey,
+                                 &item.subtype, &item.partPath, &item.titleSort})
+        n += str(*s);
+    for (const auto& g : item.genres) n += sizeof(std::string) + str(g);
+    n += item.markers.size() * sizeof(MediaItem::Marker);
+    for (const auto& p : item.cast)
+        n += sizeof(MediaItem::Person) + str(p.tag) + str(p.role) + str(p.thumb) + str(p.filter);
+    return n;
+}
+
+void eraseLocked(std::list<Entry>::iterator it) {
+    s_bytes -= it->bytes;
+    s_index.erase(indexKey(it->kind, it->ratingKey));
+    s_lru.erase(it);
+}
+
+bool isStaleLocked(const std::string& ratingKey, uint64_t stamp) {
+    auto it = s_invalidatedAt.find(ratingKey);
+    return it != s_invalidatedAt.end() && it->second > stamp;
+}
+
+bool lookupLocked(Kind kind, const std::string& ratingKey, int maxAgeSec,
+                  std::vector<MediaItem>& out) {
+    if (maxAgeSec <= 0) return false;
+    auto found = s_index.find(indexKey(kind, ratingKey));
+    if (found == s_index.end()) return false;
+    auto it = found->second;
+    if (Clock::now() - it->storedAt > std::chrono::seconds(maxAgeSec)) {
+        eraseLocked(it);
+        return false;
+    }
+    s_lru.splice(s_lru.begin(), s_lru, it);
+    out = it->items;
+    return true;
+}
+
+void storeLocked(Kind kind, const std::string& ratingKey, uint64_t stamp,
+                 std::vector<MediaItem> items) {
+    if (stamp < s_clearedAt || isStaleLocked(ratingKey, stamp)) return;
+    // A listing that includes an item invalidated mid-fetch is as stale as
+    // the item itself.
+    for (const auto& item : items)
+        if (isStaleLocked(item.ratingKey, stamp)) return;
+
+    size_t bytes = sizeof(Entry) + ratingKey.size();
+    for (const auto& item : items) bytes += approxBytes(item);
+    // One huge listing (a 2000-track album) would flush everything else.
+    const size_t budget = platform::metadataCacheBytes();
+    if (bytes > budget / 4) return;
+
+    auto found = s_index.find(indexKey(kind, ratingKey));
+    if (found != s_index.end()) eraseLocked(found->second);
+
+    s_lru.push_front(Entry{kind, ratingKey, std::move(items), bytes, Clock::now()});
+    s_index[indexKey(kind, ratingKey)] = s_lru.begin();
+    s_bytes += bytes;
+    while (s_bytes > budget && !s_lru.empty()) eraseLocked(std::prev(s_lru.end()));
+}
+
+} // namespace
+
+uint64_t MetadataCache::stamp() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_clock;
+}
+
+bool MetadataCache::get(Kind kind, const std::string& ratingKey, int maxAgeSec,
+                        std::vector<MediaItem>& out) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return lookupLocked(kind, ratingKey, maxAgeSec, out);
+}
+
+bool MetadataCache::get(const std::string& ratingKey, int maxAgeSec, MediaItem& out) {
+    std::vector<MediaItem> items;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!lookupLocked(Kind::DETAILS, ratingKey, maxAgeSec, items)) return false;
+    }
+    if (items.empty()) return false;
+    out = std::move(items.front());
+    return true;
+}
+
+void MetadataCache::put(Kind kind, const std::string& ratingKey, uint64_t stamp,
+                        int maxAgeSec, const std::vector<MediaItem>& items) {
+    if (maxAgeSec <= 0 || ratingKey.empty()) return;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    storeLocked(kind, ratingKey, stamp, items);
+}
+
+void MetadataCache::put(const std::string& ratingKey, uint64_t stamp, int maxAgeSec,
+                        const MediaItem& item) {
+    if (maxAgeSec <= 0 || ratingKey.empty()) return;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    storeLocked(Kind::DETAILS, ratingKey, stamp, {item});
+}
+
+void MetadataCache::invalidate(const std::string& ratingKey) {
+    if (ratingKey.empty()) return;
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    // The item, the season / show (or album / artist) above it...
+    std::unordered_set<std::string> affected{ratingKey};
+    auto details = s_index.find(indexKey(Kind::DETAILS, ratingKey));
+    if (details != s_index.end() && !details->second->items.empty()) {
+        const MediaItem& item = details->second->items.front();
+        if (!item.parentRatingKey.empty()) affected.insert(item.parentRatingKey);
+        if (!item.grandparentRatingKey.empty()) affected.insert(item.grandparentRatingKey);
+    }
+    // ...and any container whose cached children list one of them, since
+    // its viewed counts came from them. Repeat until nothing new turns up.
+    for (bool grew = true; grew;) {
+        grew = false;
+        for (const auto& e : s_lru) {
+            if (e.kind != Kind::CHILDREN || affected.count(e.ratingKey)) continue;
+            for (const auto& child : e.items) {
+                if (affected.count(child.ratingKey)) {
+                    affected.insert(e.ratingKey);
+                    grew = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    ++s_clock;
+    if (s_invalidatedAt.size() + affected.size() > kMaxTrackedKeys) {
+        s_invalidatedAt.clear();
+        s_clearedAt = s_clock;
+    }
+    for (const auto& key : affected) s_invalidatedAt[key] = s_clock;
+
+    // Drop their entries, and extras / related rails that show one of them.
+    size_t dropped = 0;
+    for (auto it = s_lru.begin(); it != s_lru.end();) {
+        bool drop = affected.count(it->ratingKey) > 0;
+        for (size_t i = 0; !drop && i < it->items.size(); i++)
+            drop = affected.count(it->items[i].ratingKey) > 0;
+        if (drop) {
+            auto next = std::next(it);
+            eraseLocked(it);
+            it = next;
+            dropped++;
+        } else {
+            ++it;
+        }
+    }
+    brls::Logger::debug("MetadataCache: invalidated {} ({} keys, {} entries)",
+                        ratingKey, affected.size(), dropped);
+}
+
+void MetadataCache::clear() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_lru.clear();
+    s_index.clear();
+    s_bytes = 0;
+    s_invalidatedAt.clear();
+    s_clearedAt = ++s_clock;
+}
+
+size_t MetadataCache::entryCount() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_lru.size();
+}
+
+size_t MetadataCache::totalBytes() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_bytes;
+}
+
+} // namespace vitaplex
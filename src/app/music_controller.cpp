@@ -9,6 +9,7 @@
 #include "player/mpv_player.hpp"
 #include "app/plex_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/music_prefetch.hpp"
 
 namespace vitaplex {
 
@@ -29,6 +30,52 @@ RepeatMode fromBridgeRepeat(nowplaying::RepeatMode m) {
         case nowplaying::RepeatMode::Off: default: return RepeatMode::OFF;
     }
 }
+
+// How long before the end of a track the next one is resolved and appended:
+// room for the /decision round trip plus mpv opening the stream.
+constexpr double kGaplessLeadSec = 20.0;
+
+// Playable URL for a queue track: the completed download or read-ahead copy
+// if there is one, else a transcode URL (a /decision round trip — call from
+// a worker when the UI can't wait). With `sessionId`, a new transcode
+// session is returned there rather than replacing PlexClient's current one.
+bool resolveTrackUrl(const std::string& ratingKey, std::string& url,
+                     std::string* sessionId = nullptr) {
+    DownloadItem dl;
+    if (DownloadsManager::getInstance().getDownloadCopy(ratingKey, dl) &&
+        dl.state == DownloadState::COMPLETED && !dl.localPath.empty()) {
+        url = dl.localPath;
+        return true;
+    }
+    if (MusicPrefetch::getInstance().cachedPath(ratingKey, url)) return true;
+    return PlexClient::getInstance().getTranscodeUrl(ratingKey, url, 0, sessionId);
+}
+
+// Off the UI thread: the stop is a blocking request.
+void stopPreparedSession(const std::string& sessionId) {
+    if (sessionId.empty()) return;
+    asyncRun([sessionId]() { PlexClient::getInstance().stopTranscodeSession(sessionId); });
+}
+
+// The final "stopped" timeline the player's end-of-track path leaves for a
+// finished track, for one mpv left gaplessly: at the full duration, so the
+// server scrobbles it and closes its session. Downloaded tracks are skipped,
+// as the player skips timelines for them.
+void reportTrackFinished(const QueueItem& track) {
+    DownloadItem dl;
+    if (track.ratingKey.empty() ||
+        (DownloadsManager::getInstance().getDownloadCopy(track.ratingKey, dl) &&
+         dl.state == DownloadState::COMPLETED)) {
+        return;
+    }
+    const std::string ratingKey = track.ratingKey;
+    const int durationMs = track.duration * 1000;
+    const int pqItemID = track.playQueueItemID;
+    asyncRun([ratingKey, durationMs, pqItemID]() {
+        PlexClient::getInstance().reportTimeline(ratingKey, "/library/metadata/" + ratingKey,
+                                                 "stopped", durationMs, durationMs, pqItemID);
+    });
+}
 } // namespace
 
 MusicController& MusicController::getInstance() {
@@ -66,6 +113,8 @@ void MusicController::install() {
             m_endHandled = false;
         }
         syncSessionState();   // keep the notification honest about play/pause
+        updateGapless();
+        MusicPrefetch::getInstance().update();
     });
 }
 
@@ -146,11 +195,7 @@ bool MusicController::loadCurrentHeadless() {
     if (!track) return false;
 
     std::string url;
-    DownloadItem dl;
-    if (DownloadsManager::getInstance().getDownloadCopy(track->ratingKey, dl) &&
-        dl.state == DownloadState::COMPLETED && !dl.localPath.empty()) {
-        url = dl.localPath;
-    } else if (!PlexClient::getInstance().getTranscodeUrl(track->ratingKey, url, 0)) {
+    if (!resolveTrackUrl(track->ratingKey, url)) {
         brls::Logger::error("MusicController: failed to resolve URL for {}", track->ratingKey);
         return false;
     }
@@ -172,6 +217,118 @@ bool MusicController::loadCurrentHeadless() {
     return true;
 }
 
+void MusicController::dropAppended() {
+    if (!m_resolveKey.empty()) {
+        m_resolveTask.cancel();
+        m_resolveKey.clear();
+    }
+    if (!m_appendedKey.empty()) {
+        MpvPlayer::getInstance().clearAppended();
+        m_appendedKey.clear();
+    }
+    stopPreparedSession(m_appendedSession);
+    m_appendedSession.clear();
+}
+
+void MusicController::updateGapless() {
+    MpvPlayer& p = MpvPlayer::getInstance();
+    MusicQueue& q = MusicQueue::getInstance();
+    if (!p.isInitialized() || !p.isAudioOnly()) {
+        dropAppended();
+        return;
+    }
+
+    // mpv moved on to the appended track by itself: advance the queue the
+    // same way (playNext keeps shuffle / repeat semantics). If the queue now
+    // points somewhere else — edited in the last second — load that instead.
+    if (p.getAdvanceCount() != m_seenAdvances) {
+        m_seenAdvances = p.getAdvanceCount();
+        const std::string expected = m_appendedKey;
+        const std::string session = m_appendedSession;
+        m_appendedKey.clear();
+        m_appendedSession.clear();
+        // Close out the track that just finished before anything (the
+        // foreground player included) switches over to the next one.
+        if (const QueueItem* finished = q.getCurrentTrack()) reportTrackFinished(*finished);
+        const QueueItem* track = q.advanceAfterTrackEnded();
+        if (track && track->ratingKey == expected) {
+            brls::Logger::info("MusicController: gapless advance to {}", track->title);
+            // Its transcode is the one playing now (the last track's ended
+            // with its stream).
+            if (!session.empty()) PlexClient::getInstance().adoptTranscodeSession(session);
+            m_endHandled = false;
+            if (m_hasForeground && m_fg.onGaplessAdvance) m_fg.onGaplessAdvance();
+            publishNowPlaying(1);
+        } else {
+            stopPreparedSession(session);
+            if (!track) p.stop();
+            handleTrackEnded(track);
+        }
+        return;
+    }
+
+    // A load, stop or failed append emptied mpv's playlist behind our back.
+    if (!m_appendedKey.empty() && !p.hasAppended()) {
+        m_appendedKey.clear();
+        stopPreparedSession(m_appendedSession);
+        m_appendedSession.clear();
+    }
+
+    const int next = q.peekNext();
+    const std::string nextKey = next >= 0 ? q.getQueue()[next].ratingKey : std::string();
+
+    // The queue no longer picks what was prepared (edit, shuffle, repeat).
+    if ((!m_appendedKey.empty() && m_appendedKey != nextKey) ||
+        (!m_resolveKey.empty() && m_resolveKey != nextKey)) {
+        dropAppended();
+    }
+    const QueueItem* current = q.getCurrentTrack();
+    const std::string currentKey = current ? current->ratingKey : std::string();
+    if (nextKey.empty() || nextKey == m_appendedKey || nextKey == m_resolveKey ||
+        currentKey == m_failedForKey) {
+        return;
+    }
+
+    if (!p.isPlaying() && !p.isPaused()) return;
+    const double duration = p.getDuration();
+    if (duration <= 0.0 || duration - p.getPosition() > kGaplessLeadSec) return;
+
+    const std::string title = q.getQueue()[next].title;
+    m_resolveKey = nextKey;
+    m_resolveTask = Task<PreparedTrack>::run([nextKey]() {
+        PreparedTrack prepared;
+        if (!resolveTrackUrl(nextKey, prepared.url, &prepared.sessionId)) prepared = {};
+        return prepared;
+    });
+    m_resolveTask.onUI([this, nextKey, currentKey, title](const PreparedTrack& prepared) {
+        if (m_resolveKey != nextKey) {   // superseded
+            stopPreparedSession(prepared.sessionId);
+            return;
+        }
+        m_resolveKey.clear();
+
+        MusicQueue& queue = MusicQueue::getInstance();
+        const QueueItem* cur = queue.getCurrentTrack();
+        const int peek = queue.peekNext();
+        if (!cur || cur->ratingKey != currentKey || peek < 0 ||
+            queue.getQueue()[peek].ratingKey != nextKey) {
+            stopPreparedSession(prepared.sessionId);
+            return;   // moved on meanwhile; the next tick starts over
+        }
+        if (prepared.url.empty()) {
+            brls::Logger::warning("MusicController: could not resolve next track {}", nextKey);
+            m_failedForKey = currentKey;   // the usual load at the end will retry
+            return;
+        }
+        if (MpvPlayer::getInstance().appendUrl(prepared.url, title)) {
+            m_appendedKey = nextKey;
+            m_appendedSession = prepared.sessionId;
+        } else {
+            stopPreparedSession(prepared.sessionId);
+        }
+    });
+}
+
 void MusicController::publishNowPlaying(int playingOverride) {
     MusicQueue& q = MusicQueue::getInstance();
     const QueueItem* t = q.getCurrentTrack();
@@ -0,0 +1,362 @@
+/**
+ * VitaPlex - Music read-ahead cache implementation
+ */
+
+#include "app/music_prefetch.hpp"
+#include "app/downloads_manager.hpp"
+#include "app/music_queue.hpp"
+#include "app/plex_client.hpp"
+#include "player/mpv_player.hpp"
+#include "platform/paths.hpp"
+#include "platform/platform.hpp"
+#include "utils/async.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <thread>
+
+#ifdef __vita__
+#include <psp2/kernel/threadmgr.h>
+#endif
+
+namespace vitaplex {
+
+namespace {
+// Tracks kept ahead of the one playing. Enough to ride out a dropout of a
+// few minutes without spending the budget on tracks a skip throws away.
+constexpr int kReadAheadTracks = 3;
+
+std::string cacheDir() {
+    return platformPath("music_cache");
+}
+
+std::string markerPath() {
+    return cacheDir() + "/server";
+}
+
+// Which server the cached ratingKeys belong to: its machineIdentifier, or
+// empty while that isn't known. The URL is no stand-in — one server is
+// reached through several (LAN, remote, relay) — so an unknown server
+// neither loads the cache nor wipes it.
+std::string connectedServer() {
+    const PlexSessionPtr session = PlexClient::getInstance().session();
+    return session ? session->server.machineIdentifier : std::string();
+}
+
+// ".flac" from "/library/parts/1/2/file.flac"; empty if there is none.
+std::string extensionOf(const std::string& partPath) {
+    const size_t slash = partPath.find_last_of('/');
+    const size_t dot = partPath.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return "";
+    std::string ext = partPath.substr(dot);
+    if (ext.size() > 6 || ext.find('?') != std::string::npos) return "";
+    return ext;
+}
+
+void removeFile(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+void sleepMs(int ms) {
+#ifdef __vita__
+    sceKernelDelayThread(ms * 1000);
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+}  // namespace
+
+MusicPrefetch& MusicPrefetch::getInstance() {
+    static MusicPrefetch instance;
+    return instance;
+}
+
+void MusicPrefetch::update() {
+    MpvPlayer& player = MpvPlayer::getInstance();
+    MusicQueue& queue = MusicQueue::getInstance();
+
+    const bool musicUp = player.isInitialized() && player.isAudioOnly();
+    // The track that is opening gets the link to itself; fetches resume
+    // once it plays.
+    m_holdOff.store(musicUp && player.isLoading());
+
+    std::string current;
+    std::vector<std::string> wanted;
+    if (musicUp && (player.isPlaying() || player.isPaused() || player.isLoading())) {
+        if (const QueueItem* track = queue.getCurrentTrack()) current = track->ratingKey;
+        for (int index : queue.peekUpcoming(kReadAheadTracks)) {
+            const std::string& key = queue.getQueue()[index].ratingKey;
+            if (!key.empty() && std::find(wanted.begin(), wanted.end(), key) == wanted.end())
+                wanted.push_back(key);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_current = current;
+        if (wanted != m_wanted) {
+            m_wanted = wanted;
+            m_skipped.clear();
+            if (!m_active.empty() &&
+                std::find(m_wanted.begin(), m_wanted.end(), m_active) == m_wanted.end()) {
+                m_stopActive.store(true);
+            }
+        }
+        if (m_workerRunning || m_wanted.empty()) return;
+        m_workerRunning = true;
+    }
+
+    // Its own thread: a track can take minutes on a slow link, too long to
+    // hold a pool worker.
+    asyncRunDedicated([this]() { workerLoop(); });
+}
+
+bool MusicPrefetch::cachedPath(const std::string& ratingKey, std::string& path) {
+    if (ratingKey.empty()) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    loadIndexLocked();
+
+    auto it = m_entries.find(ratingKey);
+    if (it == m_entries.end()) return false;
+
+    std::error_code ec;
+    if (!std::filesystem::exists(it->second.path, ec)) {
+        m_totalBytes -= it->second.bytes;
+        m_entries.erase(it);
+        return false;
+    }
+    it->second.lastUsed = ++m_clock;
+    path = it->second.path;
+    brls::Logger::info("MusicPrefetch: playing {} from the read-ahead cache", ratingKey);
+    return true;
+}
+
+void MusicPrefetch::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wanted.clear();
+    m_current.clear();
+    m_skipped.clear();
+    if (!m_active.empty()) m_stopActive.store(true);
+    wipeLocked();
+    m_indexLoaded = !m_server.empty();   // else claimed once the server is known
+}
+
+// Drop every file and start over for the connected server.
+void MusicPrefetch::wipeLocked() {
+    m_entries.clear();
+    m_totalBytes = 0;
+
+    std::error_code ec;
+    auto it = std::filesystem::directory_iterator(cacheDir(), ec);
+    if (!ec) {
+        for (const auto& entry : it) {
+            // The fetch in flight deletes its own partial once it stops.
+            if (!m_active.empty() && entry.path().filename().string().rfind(m_active + ".", 0) == 0)
+                continue;
+            std::filesystem::remove(entry.path(), ec);
+        }
+    }
+
+    m_server = connectedServer();
+    std::filesystem::create_directories(cacheDir(), ec);
+    std::ofstream marker(markerPath(), std::ios::trunc);
+    marker << m_server;
+}
+
+void MusicPrefetch::loadIndexLocked() {
+    const std::string connected = connectedServer();
+    if (connected.empty()) return;   // can't tell yet; keep what is there
+    if (m_indexLoaded) {
+        // ratingKeys are per server; another server's files would answer
+        // for the wrong tracks.
+        if (m_server != connected) wipeLocked();
+        return;
+    }
+    m_indexLoaded = true;
+
+    std::string server;
+    {
+        std::ifstream marker(markerPath());
+        std::getline(marker, server);
+    }
+    if (server != connected) {
+        wipeLocked();
+        return;
+    }
+    m_server = server;
+
+    std::error_code ec;
+    auto it = std::filesystem::directory_iterator(cacheDir(), ec);
+    if (ec) return;
+    for (const auto& entry : it) {
+        if (!entry.is_regular_file(ec)) continue;
+        const std::filesystem::path& p = entry.path();
+        if (p.filename() == "server") continue;
+        if (p.extension() == ".part") {   // interrupted by the last exit
+            std::filesystem::remove(p, ec);
+            continue;
+        }
+        Entry e;
+        e.path = p.string();
+        e.bytes = (int64_t)entry.file_size(ec);
+        if (ec) continue;
+        m_totalBytes += e.bytes;
+        m_entries[p.stem().string()] = std::move(e);
+    }
+    makeRoomLocked(0);   // the budget may have shrunk since
+    brls::Logger::info("MusicPrefetch: {} cached tracks ({} KB)",
+                       m_entries.size(), m_totalBytes / 1024);
+}
+
+bool MusicPrefetch::pinnedLocked(const std::string& ratingKey) const {
+    return ratingKey == m_current ||
+           std::find(m_wanted.begin(), m_wanted.end(), ratingKey) != m_wanted.end();
+}
+
+// Evict least recently played tracks until `bytes` more fit the budget.
+// False when only pinned tracks are left to evict.
+bool MusicPrefetch::makeRoomLocked(int64_t bytes) {
+    const int64_t budget = platform::musicPrefetchBytes();
+    while (m_totalBytes + bytes > budget) {
+        auto victim = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (pinnedLocked(it->first)) continue;
+            if (victim == m_entries.end() || it->second.lastUsed < victim->second.lastUsed)
+                victim = it;
+        }
+        if (victim == m_entries.end()) return false;
+        removeFile(victim->second.path);
+        m_totalBytes -= victim->second.bytes;
+        m_entries.erase(victim);
+    }
+    return true;
+}
+
+void MusicPrefetch::workerLoop() {
+    int heldOff = 0;
+    for (;;) {
+        std::string ratingKey;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            loadIndexLocked();
+            // Server not known yet: nothing to file the tracks under.
+            if (!m_indexLoaded) {
+                m_workerRunning = false;
+                return;
+            }
+            for (const auto& key : m_wanted) {
+                if (!m_entries.count(key) && !m_skipped.count(key)) {
+                    ratingKey = key;
+                    break;
+                }
+            }
+            // Nothing missing — or held off for 30 s, in which case the
+            // timers that call update() may have stopped; it restarts us.
+            if (ratingKey.empty() || heldOff >= 60) {
+                m_workerRunning = false;
+                return;
+            }
+            if (!m_holdOff.load()) {
+                m_active = ratingKey;
+                m_stopActive.store(false);
+            }
+        }
+
+        if (m_holdOff.load()) {
+            heldOff++;
+            sleepMs(500);
+            continue;
+        }
+        heldOff = 0;
+
+        fetchTrack(ratingKey);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_active.clear();
+    }
+}
+
+// Worker thread. Fetch one track into the cache; on failure it is skipped
+// until the upcoming set changes.
+void MusicPrefetch::fetchTrack(const std::string& ratingKey) {
+    auto skip = [&]() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_skipped.insert(ratingKey);
+    };
+
+    // A download already plays offline.
+    DownloadItem dl;
+    if (DownloadsManager::getInstance().getDownloadCopy(ratingKey, dl) &&
+        dl.state == DownloadState::COMPLETED) {
+        skip();
+        return;
+    }
+
+    MediaItem details;
+    if (!PlexClient::getInstance().fetchMediaDetails(ratingKey, details) ||
+        details.partPath.empty()) {
+        skip();
+        return;
+    }
+    // An unknown size can't be budgeted, and one track may take at most its
+    // share of the budget.
+    const int64_t size = details.partSize;
+    if (size <= 0 || size > platform::musicPrefetchBytes() / kReadAheadTracks) {
+        brls::Logger::debug("MusicPrefetch: not caching {} ({} bytes)", ratingKey, size);
+        skip();
+        return;
+    }
+
+    const std::string path = cacheDir() + "/" + ratingKey + extensionOf(details.partPath);
+    const std::string partPath = path + ".part";
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!makeRoomLocked(size)) {
+            m_skipped.insert(ratingKey);
+            return;
+        }
+    }
+
+    const bool ok = DownloadsManager::getInstance().fetchPartToFile(
+        details.partPath, partPath, size,
+        [this]() { return !m_stopActive.load() && !m_holdOff.load(); });
+
+    std::error_code ec;
+    const int64_t onDisk = (int64_t)std::filesystem::file_size(partPath, ec);
+    if (ok && !ec && onDisk == size) {
+        std::filesystem::rename(partPath, path, ec);
+        if (!ec) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // The cache may have been cleared (or the server switched) meanwhile.
+            const std::string connected = connectedServer();
+            if ((!connected.empty() && m_server != connected) || m_stopActive.load()) {
+                removeFile(path);
+                return;
+            }
+            Entry e;
+            e.path = path;
+            e.bytes = size;
+            e.lastUsed = ++m_clock;
+            m_totalBytes += size;
+            m_entries[ratingKey] = std::move(e);
+            brls::Logger::info("MusicPrefetch: cached {} ({} KB)", ratingKey, size / 1024);
+            return;
+        }
+    }
+
+    // Backed off for the current track: keep the partial, it resumes next.
+    if (m_holdOff.load() && !m_stopActive.load()) return;
+
+    removeFile(partPath);
+    if (!m_stopActive.load()) {
+        brls::Logger::warning("MusicPrefetch: failed to fetch {}", ratingKey);
+        skip();
+    }
+}
+
+} // namespace vitaplex
@@ -310,6 +310,40 @@ bool MusicQueue::playNext() {
     return true;
 }
 
+std::vector<int> MusicQueue::peekUpcoming(int count) const {
+    std::vector<int> upcoming;
+    if (m_queue.empty() || m_currentIndex < 0 || count <= 0) return upcoming;
+
+    // Same choices as playNext(), without moving.
+    if (m_repeatMode == RepeatMode::ONE) {
+        upcoming.push_back(m_currentIndex);
+        return upcoming;
+    }
+    if (m_shuffleEnabled) {
+        // Past the end repeat-all reshuffles, so those tracks aren't known yet.
+        for (int pos = m_shufflePosition + 1;
+             pos < (int)m_shuffleOrder.size() && (int)upcoming.size() < count; pos++) {
+            upcoming.push_back(m_shuffleOrder[pos]);
+        }
+        return upcoming;
+    }
+    const int size = (int)m_queue.size();
+    for (int step = 1; step <= size && (int)upcoming.size() < count; step++) {
+        int index = m_currentIndex + step;
+        if (index >= size) {
+            if (m_repeatMode != RepeatMode::ALL) break;
+            index -= size;
+        }
+        upcoming.push_back(index);
+    }
+    return upcoming;
+}
+
+int MusicQueue::peekNext() const {
+    std::vector<int> next = peekUpcoming(1);
+    return next.empty() ? -1 : next.front();
+}
+
 bool MusicQueue::playPrevious() {
     if (m_queue.empty()) return false;
 
@@ -457,17 +491,17 @@ void MusicQueue::cycleRepeatMode() {
 void MusicQueue::onTrackEnded() {
     brls::Logger::debug("MusicQueue: Track ended, checking for next");
 
-    const QueueItem* nextTrack = nullptr;
-
-    if (playNext()) {
-        nextTrack = getCurrentTrack();
-    }
+    const QueueItem* nextTrack = advanceAfterTrackEnded();
 
     if (m_trackEndedCallback) {
         m_trackEndedCallback(nextTrack);
     }
 }
 
+const QueueItem* MusicQueue::advanceAfterTrackEnded() {
+    return playNext() ? getCurrentTrack() : nullptr;
+}
+
 void MusicQueue::notifyQueueChanged() {
     ++m_version;
     if (m_queueChangedCallback) {
@@ -4,16 +4,23 @@
 
 #include "app/plex_client.hpp"
 #include "app/application.hpp"
+#include "app/metadata_cache.hpp"
 #include "utils/http_client.hpp"
 #include "utils/http_cache.hpp"
+#include "utils/task_pool.hpp"
 #include "platform/platform.hpp"
 
 #include <borealis.hpp>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <condition_variable>
+#include <iterator>
+#include <mutex>
 #include <set>
 #include <string_view>
+#include <unordered_map>
 
 namespace vitaplex {
 
@@ -99,13 +106,49 @@ static int64_t svToInt64(std::string_view v) {
     return neg ? -out : out;
 }
 
+// Age limit for MetadataCache hits: the user's cache lifetime (zero turns
+// it off), but never more than five minutes, since watch state also
+// changes on other clients.
+static int metadataMaxAgeSec() {
+    constexpr int kMaxAgeSec = 5 * 60;
+    return std::min(Application::getInstance().getSettings().cacheLifetimeMinutes * 60, kMaxAgeSec);
+}
+
 PlexClient& PlexClient::getInstance() {
     static PlexClient instance;
     return instance;
 }
 
+PlexSessionPtr PlexClient::session() const {
+    std::lock_guard<std::mutex> lock(m_sessionMutex);
+    return m_session;
+}
+
+void PlexClient::updateSession(const std::function<void(PlexSession&)>& edit) {
+    std::lock_guard<std::mutex> writeLock(m_sessionWriteMutex);
+    auto next = std::make_shared<PlexSession>(*session());
+    edit(*next);
+    std::lock_guard<std::mutex> lock(m_sessionMutex);
+    m_session = std::move(next);
+}
+
+void PlexClient::setAuthToken(const std::string& token) {
+    updateSession([&](PlexSession& s) { s.authToken = token; });
+}
+
+void PlexClient::setServerUrl(const std::string& url) {
+    // ratingKeys are per server; another server's cached metadata would
+    // answer for the wrong titles.
+    if (session()->serverUrl != url) MetadataCache::clear();
+    updateSession([&](PlexSession& s) { s.serverUrl = url; });
+}
+
 std::string PlexClient::buildApiUrl(const std::string& endpoint) {
-    std::string url = m_serverUrl;
+    return buildApiUrl(*session(), endpoint);
+}
+
+std::string PlexClient::buildApiUrl(const PlexSession& session, const std::string& endpoint) {
+    std::string url = session.serverUrl;
 
     // Remove trailing slash
     while (!url.empty() && url.back() == '/') {
@@ -115,11 +158,11 @@ std::string PlexClient::buildApiUrl(const std::string& endpoint) {
     url += endpoint;
 
     // Add token
-    if (!m_authToken.empty()) {
+    if (!session.authToken.empty()) {
         if (endpoint.find('?') != std::string::npos) {
-            url += "&X-Plex-Token=" + m_authToken;
+            url += "&X-Plex-Token=" + session.authToken;
         } else {
-            url += "?X-Plex-Token=" + m_authToken;
+            url += "?X-Plex-Token=" + session.authToken;
         }
     }
 
@@ -311,11 +354,12 @@ bool PlexClient::login(const std::string& username, const std::string& password)
     HttpResponse resp = client.request(req);
 
     if (resp.statusCode == 201 || resp.statusCode == 200) {
-        m_authToken = extractJsonValue(resp.body, "authToken");
-        if (!m_authToken.empty()) {
+        std::string token = extractJsonValue(resp.body, "authToken");
+        if (!token.empty()) {
             brls::Logger::info("Login successful");
+            setAuthToken(token);
             m_reauthTriggered = false;  // Reset reauth guard on successful login
-            Application::getInstance().setAuthToken(m_authToken);
+            Application::getInstance().setAuthToken(token);
             return true;
         }
     }
@@ -375,9 +419,9 @@ bool PlexClient::checkPin(PinAuth& pinAuth) {
         pinAuth.expired = extractJsonBool(resp.body, "expired");
 
         if (!pinAuth.authToken.empty()) {
-            m_authToken = pinAuth.authToken;
+            setAuthToken(pinAuth.authToken);
             m_reauthTriggered = false;  // Reset reauth guard on successful login
-            Application::getInstance().setAuthToken(m_authToken);
+            Application::getInstance().setAuthToken(pinAuth.authToken);
             brls::Logger::info("PIN authenticated successfully");
             return true;
         }
@@ -560,16 +604,16 @@ bool PlexClient::switchHomeUser(const std::string& masterToken,
 void PlexClient::useHomeUserTokens(const std::string& accountToken) {
     if (accountToken.empty()) return;
 
-    const std::string machineId = m_currentServer.machineIdentifier;
-
-    // Temporarily fly the account token so fetchServers (a plex.tv call)
-    // authorises and returns THIS user's per-server access tokens.
-    m_authToken = accountToken;
+    const std::string machineId = session()->server.machineIdentifier;
 
+    // Query plex.tv with the account token so it returns THIS user's
+    // per-server access tokens. The session keeps the old token until the
+    // final one is known, so concurrent server requests never see the
+    // account token in flight.
     std::string serverToken;
     if (!machineId.empty()) {
         std::vector<PlexServer> servers;
-        if (fetchServers(servers)) {
+        if (fetchServersWithToken(accountToken, servers)) {
             for (const auto& s : servers) {
                 if (s.machineIdentifier == machineId && !s.accessToken.empty()) {
                     serverToken = s.accessToken;
@@ -587,8 +631,9 @@ void PlexClient::useHomeUserTokens(const std::string& accountToken) {
 
     // Server requests use the per-server token when we found one; otherwise the
     // account token (owner / own-server, where the two are identical).
-    m_authToken = serverToken.empty() ? accountToken : serverToken;
-    Application::getInstance().setAuthToken(m_authToken);
+    const std::string token = serverToken.empty() ? accountToken : serverToken;
+    setAuthToken(token);
+    Application::getInstance().setAuthToken(token);
     brls::Logger::info("useHomeUserTokens: adopted {} token for server requests",
                        serverToken.empty() ? "account" : "per-server access");
 }
@@ -605,7 +650,8 @@ bool PlexClient::refreshToken() {
 }
 
 bool PlexClient::validateToken() {
-    if (m_authToken.empty()) return false;
+    const std::string token = getAuthToken();
+    if (token.empty()) return false;
 
     // Check token validity by hitting plex.tv/api/v2/user
     HttpClient client;
@@ -613,7 +659,7 @@ bool PlexClient::validateToken() {
     req.url = "https://plex.tv/api/v2/user";
     req.method = "GET";
     req.headers["Accept"] = "application/json";
-    req.headers["X-Plex-Token"] = m_authToken;
+    req.headers["X-Plex-Token"] = token;
     req.headers["X-Plex-Client-Identifier"] = PLEX_CLIENT_ID;
     req.timeout = 10;
 
@@ -628,11 +674,11 @@ bool PlexClient::validateToken() {
 }
 
 void PlexClient::handleUnauthorized() {
-    if (m_reauthTriggered) {
+    // exchange() so parallel requests all hitting 401 trigger one reauth
+    if (m_reauthTriggered.exchange(true)) {
         // Already handling reauth, don't recurse
         return;
     }
-    m_reauthTriggered = true;
 
     brls::Logger::error("Authentication failed (401) - clearing session and redirecting to login");
 
@@ -646,9 +692,13 @@ void PlexClient::handleUnauthorized() {
 }
 
 bool PlexClient::fetchServers(std::vector<PlexServer>& servers) {
+    return fetchServersWithToken(getAuthToken(), servers);
+}
+
+bool PlexClient::fetchServersWithToken(const std::string& token, std::vector<PlexServer>& servers) {
     brls::Logger::info("Fetching user's servers from plex.tv");
 
-    if (m_authToken.empty()) {
+    if (token.empty()) {
         brls::Logger::error("No auth token - please login first");
         return false;
     }
@@ -658,7 +708,7 @@ bool PlexClient::fetchServers(std::vector<PlexServer>& servers) {
     req.url = "https://plex.tv/api/v2/resources?includeHttps=1&includeRelay=1&includeIPv6=0";
     req.method = "GET";
     req.headers["Accept"] = "application/json";
-    req.headers["X-Plex-Token"] = m_authToken;
+    req.headers["X-Plex-Token"] = token;
     req.headers["X-Plex-Client-Identifier"] = PLEX_CLIENT_ID;
 
     HttpResponse resp = client.request(req);
@@ -795,16 +845,17 @@ bool PlexClient::connectToServer(const std::string& url, int timeoutSeconds) {
     brls::Logger::info("Connecting to server: {} (timeout: {}s)", url, timeoutSeconds);
 
     // Normalize URL - ensure http/https is lowercase
-    m_serverUrl = url;
-    if (m_serverUrl.length() > 7) {
-        size_t colonPos = m_serverUrl.find("://");
+    std::string serverUrl = url;
+    if (serverUrl.length() > 7) {
+        size_t colonPos = serverUrl.find("://");
         if (colonPos != std::string::npos && colonPos < 6) {
             for (size_t i = 0; i < colonPos; i++) {
-                m_serverUrl[i] = tolower(m_serverUrl[i]);
+                serverUrl[i] = tolower(serverUrl[i]);
             }
         }
     }
-    Application::getInstance().setServerUrl(m_serverUrl);  // Use normalized URL
+    setServerUrl(serverUrl);
+    Application::getInstance().setServerUrl(serverUrl);  // Use normalized URL
 
     HttpClient client;
     HttpRequest req;
@@ -818,16 +869,23 @@ bool PlexClient::connectToServer(const std::string& url, int timeoutSeconds) {
     HttpResponse resp = client.request(req);
 
     if (resp.statusCode == 200) {
-        m_currentServer.name = extractJsonValue(resp.body, "friendlyName");
-        m_currentServer.machineIdentifier = extractJsonValue(resp.body, "machineIdentifier");
-        m_currentServer.address = url;
-
-        brls::Logger::info("Connected to: {}", m_currentServer.name);
-
-        // Live TV availability (m_dvrId / m_epgProviderKey) is probed
+        const std::string name = extractJsonValue(resp.body, "friendlyName");
+        const std::string machineId = extractJsonValue(resp.body, "machineIdentifier");
+        updateSession([&](PlexSession& s) {
+            // A different server's DVR setup means nothing here; drop it so
+            // the next Live TV consumer re-probes.
+            if (s.server.machineIdentifier != machineId) s.liveTV = LiveTVConfig();
+            s.server.name = name;
+            s.server.machineIdentifier = machineId;
+            s.server.address = url;
+        });
+
+        brls::Logger::info("Connected to: {}", name);
+
+        // Live TV availability (liveTV.dvrId / epgProviderKey) is probed
         // lazily by every consumer (fetchLiveTVChannels, fetchEPGGrid,
         // tuneLiveTVChannel all call checkLiveTVAvailability when
-        // m_dvrId is empty), so don't block session restore on the
+        // the DVR ID is empty), so don't block session restore on the
         // /livetv/dvrs round trip here — hardware logs showed it taking
         // 0.1-3.2s of app launch depending on server mood, and the
         // first Live TV fetch runs on a worker thread anyway.
@@ -840,18 +898,21 @@ bool PlexClient::connectToServer(const std::string& url, int timeoutSeconds) {
 }
 
 void PlexClient::logout() {
-    m_authToken.clear();
-    m_serverUrl.clear();
+    updateSession([](PlexSession& s) {
+        s.authToken.clear();
+        s.serverUrl.clear();
+    });
     m_reauthTriggered = false;
     Application::getInstance().setAuthToken("");
     Application::getInstance().setServerUrl("");
 }
 
 bool PlexClient::fetchLibrarySections(std::vector<LibrarySection>& sections) {
+    const PlexSessionPtr session = this->session();
     brls::Logger::debug("fetchLibrarySections: serverUrl={}, hasToken={}",
-                        m_serverUrl, !m_authToken.empty());
+                        session->serverUrl, !session->authToken.empty());
 
-    std::string url = buildApiUrl("/library/sections");
+    std::string url = buildApiUrl(*session, "/library/sections");
     brls::Logger::debug("Fetching: {}", redactBodyForLog(url));
 
     // Cache check — library sections rarely change. Skipping the
@@ -1025,6 +1086,30 @@ bool PlexClient::fetchLibraryContent(const std::string& sectionKey, std::vector<
         item.audienceRating = extractJsonFloatRange(resp.body, objStart, objEnd, "audienceRating");
         item.contentRating = extractJsonValueRange(resp.body, objStart, objEnd, "contentRating");
         item.subtype = extractJsonValueRange(resp.body, objStart, objEnd, "subtype");
+        item.titleSort = extractJsonValueRange(resp.body, objStart, objEnd, "titleSort");
+        item.originallyAvailableAt = extractJsonValueRange(resp.body, objStart, objEnd, "originallyAvailableAt");
+        item.addedAt = std::strtoll(extractJsonValueRange(resp.body, objStart, objEnd, "addedAt").c_str(), nullptr, 10);
+        item.updatedAt = std::strtoll(extractJsonValueRange(resp.body, objStart, objEnd, "updatedAt").c_str(), nullptr, 10);
+        item.lastViewedAt = std::strtoll(extractJsonValueRange(resp.body, objStart, objEnd, "lastViewedAt").c_str(), nullptr, 10);
+        // Fields LibraryQuery filters on: resolution of the first Media,
+        // watch state (viewCount for movies, leaf counts for shows / artists)
+        // and the Genre tags, scanned only within this item's own array.
+        item.videoResolution = extractJsonValueRange(resp.body, objStart, objEnd, "videoResolution");
+        item.leafCount = extractJsonIntRange(resp.body, objStart, objEnd, "leafCount");
+        item.viewedLeafCount = extractJsonIntRange(resp.body, objStart, objEnd, "viewedLeafCount");
+        item.watched = item.leafCount > 0
+                           ? item.viewedLeafCount >= item.leafCount
+                           : extractJsonIntRange(resp.body, objStart, objEnd, "viewCount") > 0;
+        size_t genrePos = resp.body.find("\"Genre\"", objStart);
+        if (genrePos < objEnd) {
+            const size_t arrEnd = std::min(resp.body.find(']', genrePos), objEnd);
+            size_t tagPos = genrePos;
+            while ((tagPos = resp.body.find("\"tag\"", tagPos)) < arrEnd) {
+                std::string tag = extractJsonValueRange(resp.body, tagPos, arrEnd, "tag");
+                if (!tag.empty()) item.genres.push_back(std::move(tag));
+                tagPos += 5;
+            }
+        }
         // Skip summary and art for grid display - saves ~200-500 bytes per item
 
         if (!item.ratingKey.empty() && !item.title.empty()) {
@@ -1115,6 +1200,10 @@ bool PlexClient::fetchSectionRecentlyAdded(const std::string& sectionKey, std::v
 bool PlexClient::fetchChildren(const std::string& ratingKey, std::vector<MediaItem>& items) {
     brls::Logger::debug("fetchChildren: ratingKey={}", ratingKey);
 
+    const int maxAge = metadataMaxAgeSec();
+    if (MetadataCache::get(MetadataCache::Kind::CHILDREN, ratingKey, maxAge, items)) return true;
+    const uint64_t stamp = MetadataCache::stamp();
+
     HttpClient client;
     std::string url = buildApiUrl("/library/metadata/" + ratingKey + "/children");
 
@@ -1192,11 +1281,16 @@ bool PlexClient::fetchChildren(const std::string& ratingKey, std::vector<MediaIt
         pos = objEnd;
     }
 
+    MetadataCache::put(MetadataCache::Kind::CHILDREN, ratingKey, stamp, maxAge, items);
     brls::Logger::info("Found {} children", items.size());
     return true;
 }
 
 bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item) {
+    const int maxAge = metadataMaxAgeSec();
+    if (MetadataCache::get(ratingKey, maxAge, item)) return true;
+    const uint64_t stamp = MetadataCache::stamp();
+
     HttpClient client;
     std::string url = buildApiUrl("/library/metadata/" + ratingKey);
 
@@ -1212,32 +1306,281 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
         return false;
     }
 
-    item.ratingKey = extractJsonValue(resp.body, "ratingKey");
-    item.title = extractJsonValue(resp.body, "title");
-    item.summary = extractJsonValue(resp.body, "summary");
-    item.thumb = extractJsonValue(resp.body, "thumb");
-    item.art = extractJsonValue(resp.body, "art");
-    item.type = extractJsonValue(resp.body, "type");
+    parseMediaDetails(resp.body, item);
+    MetadataCache::put(ratingKey, stamp, maxAge, item);
+    return true;
+}
+
+bool PlexClient::cachedMediaDetails(const std::string& ratingKey, MediaItem& item) {
+    if (ratingKey.empty()) return false;
+    return MetadataCache::get(ratingKey, metadataMaxAgeSec(), item);
+}
+
+// Split the "Metadata" array of a /library/metadata response into its
+// top-level objects. String-aware, so a brace inside a summary can't end an
+// object early the way a plain brace count would.
+static std::vector<std::string_view> splitMetadataObjects(std::string_view body) {
+    std::vector<std::string_view> objects;
+    size_t pos = body.find("\"Metadata\":");
+    if (pos == std::string_view::npos) return objects;
+    pos = body.find('[', pos);
+    if (pos == std::string_view::npos) return objects;
+
+    int depth = 0;
+    bool inString = false;
+    size_t objStart = 0;
+    for (size_t i = pos + 1; i < body.size(); i++) {
+        char c = body[i];
+        if (inString) {
+            if (c == '\\') i++;
+            else if (c == '"') inString = false;
+            continue;
+        }
+        if (c == '"') {
+            inString = true;
+        } else if (c == '{' || c == '[') {
+            if (depth == 0 && c == '{') objStart = i;
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) break;   // end of the Metadata array
+            depth--;
+            if (depth == 0 && c == '}') objects.push_back(body.substr(objStart, i - objStart + 1));
+        }
+    }
+    return objects;
+}
+
+bool PlexClient::fetchMediaDetailsBatch(const std::vector<std::string>& ratingKeys,
+                                        std::vector<MediaItem>& items) {
+    items.clear();
+    if (ratingKeys.empty()) return true;
+
+    // Only what the metadata cache doesn't already hold goes to the server.
+    const int maxAge = metadataMaxAgeSec();
+    const uint64_t stamp = MetadataCache::stamp();
+    std::unordered_map<std::string, MediaItem> cached;
+    std::vector<std::string> missing;
+    for (const auto& key : ratingKeys) {
+        MediaItem hit;
+        if (MetadataCache::get(key, maxAge, hit)) cached.emplace(key, std::move(hit));
+        else missing.push_back(key);
+    }
+
+    // Keys per request. Plex takes a comma-separated list on
+    // /library/metadata/{keys}; 25 keeps the URL well short of proxy limits
+    // and a chunk's response (full Media/Part/Role arrays) in the low
+    // hundreds of KB.
+    constexpr size_t kChunkKeys = 25;
+
+    struct Batch {
+        std::vector<std::vector<std::string>> chunks;
+        std::vector<std::vector<MediaItem>> results;
+        std::vector<char> ok;
+        HttpCancelFlag cancel;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t next = 0;     // first unclaimed chunk
+        size_t active = 0;   // chunks being fetched
+    };
+    auto batch = std::make_shared<Batch>();
+    for (size_t i = 0; i < missing.size(); i += kChunkKeys) {
+        size_t end = std::min(missing.size(), i + kChunkKeys);
+        batch->chunks.emplace_back(missing.begin() + i, missing.begin() + end);
+    }
+    batch->results.resize(batch->chunks.size());
+    batch->ok.assign(batch->chunks.size(), 0);
+    // Helpers run on other pool threads; carry the caller's cancellation
+    // over so cancelling the flow stops every chunk, not just its own.
+    batch->cancel = HttpCancelScope::current();
+
+    // Work-sharing rather than fan-out-and-wait: the caller is usually a
+    // pool worker itself, so it fetches chunks too and never blocks on a
+    // helper that hasn't been scheduled. A helper that starts late finds
+    // nothing left and returns.
+    auto work = [this, batch, stamp, maxAge]() {
+        HttpCancelScope scope(batch->cancel);
+        for (;;) {
+            size_t idx;
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                if (batch->next >= batch->chunks.size()) return;
+                if (batch->cancel && batch->cancel->load()) {
+                    batch->next = batch->chunks.size();
+                    return;
+                }
+                idx = batch->next++;
+                batch->active++;
+            }
+
+            std::string keyList;
+            for (const auto& key : batch->chunks[idx]) {
+                if (!keyList.empty()) keyList += ',';
+                keyList += key;
+            }
+
+            HttpClient client;
+            HttpRequest req;
+            req.url = buildApiUrl("/library/metadata/" + keyList);
+            req.method = "GET";
+            req.headers["Accept"] = "application/json";
+            HttpResponse resp = client.request(req);
+
+            std::vector<MediaItem> parsed;
+            bool ok = resp.statusCode == 200;
+            if (ok) {
+                for (std::string_view obj : splitMetadataObjects(resp.body)) {
+                    MediaItem item;
+                    parseMediaDetails(std::string(obj), item);
+                    if (item.ratingKey.empty()) continue;
+                    MetadataCache::put(item.ratingKey, stamp, maxAge, item);
+                    parsed.push_back(std::move(item));
+                }
+            } else {
+                brls::Logger::error("fetchMediaDetailsBatch: chunk of {} failed: {}",
+                                    batch->chunks[idx].size(), resp.statusCode);
+                if (isAuthError(resp.statusCode)) handleUnauthorized();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                batch->results[idx] = std::move(parsed);
+                batch->ok[idx] = ok ? 1 : 0;
+                batch->active--;
+            }
+            batch->cv.notify_all();
+        }
+    };
+
+    if (!batch->chunks.empty()) {
+        const size_t helpers = std::min(batch->chunks.size(),
+            std::max<size_t>(1, platform::maxConcurrentNetworkRequests())) - 1;
+        for (size_t i = 0; i < helpers; i++) TaskPool::submit(work);
+        work();
+    }
+    {
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->cv.wait(lock, [&]() {
+            return batch->next >= batch->chunks.size() && batch->active == 0;
+        });
+    }
+
+    // Back into the caller's order; keys the server didn't return are
+    // simply absent.
+    std::unordered_map<std::string, MediaItem*> byKey;
+    bool anyOk = batch->chunks.empty();
+    for (auto& hit : cached) byKey[hit.first] = &hit.second;
+    for (size_t c = 0; c < batch->chunks.size(); c++) {
+        anyOk = anyOk || batch->ok[c];
+        for (auto& item : batch->results[c]) byKey[item.ratingKey] = &item;
+    }
+    items.reserve(byKey.size());
+    for (const auto& key : ratingKeys) {
+        auto it = byKey.find(key);
+        if (it == byKey.end() || !it->second) continue;
+        items.push_back(std::move(*it->second));
+        it->second = nullptr;   // a key listed twice is returned once
+    }
+
+    brls::Logger::info("fetchMediaDetailsBatch: {}/{} items in {} requests ({} cached)",
+                       items.size(), ratingKeys.size(), batch->chunks.size(), cached.size());
+    return anyOk;
+}
+
+bool PlexClient::fetchAllLeaves(const std::string& ratingKey,
+                                const std::function<bool(std::vector<MediaItem>&)>& onPage) {
+    // The first page is kept small so a player fed from it can start while
+    // the rest is still on the wire; the remainder then comes in one request
+    // unless the container is big enough that a single response would be a
+    // memory problem on Vita.
+    constexpr int kFirstPage = 100;
+    constexpr int kMaxPage = 1000;
+
+    int offset = 0;
+    int pageSize = kFirstPage;
+    for (;;) {
+        HttpClient client;
+        HttpRequest req;
+        req.url = buildApiUrl("/library/metadata/" + ratingKey + "/allLeaves" +
+                              "?X-Plex-Container-Start=" + std::to_string(offset) +
+                              "&X-Plex-Container-Size=" + std::to_string(pageSize));
+        req.method = "GET";
+        req.headers["Accept"] = "application/json";
+        HttpResponse resp = client.request(req);
+
+        if (resp.statusCode != 200) {
+            brls::Logger::error("fetchAllLeaves: {} at offset {} failed: {}",
+                                ratingKey, offset, resp.statusCode);
+            if (isAuthError(resp.statusCode)) handleUnauthorized();
+            return false;
+        }
+
+        const std::vector<std::string_view> objects = splitMetadataObjects(resp.body);
+        std::vector<MediaItem> page;
+        page.reserve(objects.size());
+        for (std::string_view view : objects) {
+            std::string obj(view);
+            MediaItem item;
+            parseMediaDetails(obj, item);
+            // Fields the full-metadata parse leaves to the listing calls.
+            item.key = extractJsonValue(obj, "key");
+            item.parentThumb = extractJsonValue(obj, "parentThumb");
+            item.grandparentThumb = extractJsonValue(obj, "grandparentThumb");
+            item.watched = extractJsonInt(obj, "viewCount") > 0;
+            if (!item.ratingKey.empty()) page.push_back(std::move(item));
+        }
+
+        const int received = (int)objects.size();
+        offset += received;
+        // totalSize is only sent with container paging; without it a short
+        // page is the last one.
+        const int total = extractJsonInt(resp.body, "totalSize");
+        const bool more = received > 0 && (total > 0 ? offset < total : received == pageSize);
+
+        if (!page.empty() && !onPage(page)) return true;
+        if (!more) break;
+        pageSize = total > 0 ? std::min(total - offset, kMaxPage) : kMaxPage;
+    }
+
+    brls::Logger::info("fetchAllLeaves: {} leaves under {}", offset, ratingKey);
+    return true;
+}
+
+bool PlexClient::fetchAllLeaves(const std::string& ratingKey, std::vector<MediaItem>& items) {
+    items.clear();
+    return fetchAllLeaves(ratingKey, [&items](std::vector<MediaItem>& page) {
+        items.insert(items.end(), std::make_move_iterator(page.begin()),
+                     std::make_move_iterator(page.end()));
+        return true;
+    });
+}
+
+void PlexClient::parseMediaDetails(const std::string& json, MediaItem& item) {
+    item.ratingKey = extractJsonValue(json, "ratingKey");
+    item.title = extractJsonValue(json, "title");
+    item.summary = extractJsonValue(json, "summary");
+    item.thumb = extractJsonValue(json, "thumb");
+    item.art = extractJsonValue(json, "art");
+    item.type = extractJsonValue(json, "type");
     item.mediaType = parseMediaType(item.type);
-    item.year = extractJsonInt(resp.body, "year");
-    item.duration = extractJsonInt(resp.body, "duration");
-    item.viewOffset = extractJsonInt(resp.body, "viewOffset");
-    item.rating = extractJsonFloat(resp.body, "rating");
-    item.contentRating = extractJsonValue(resp.body, "contentRating");
-    item.studio = extractJsonValue(resp.body, "studio");
+    item.year = extractJsonInt(json, "year");
+    item.duration = extractJsonInt(json, "duration");
+    item.viewOffset = extractJsonInt(json, "viewOffset");
+    item.rating = extractJsonFloat(json, "rating");
+    item.contentRating = extractJsonValue(json, "contentRating");
+    item.studio = extractJsonValue(json, "studio");
     // leafCount = track count for artists, episode count for shows/seasons.
-    item.leafCount = extractJsonInt(resp.body, "leafCount");
+    item.leafCount = extractJsonInt(json, "leafCount");
 
     // Genres: Plex returns "Genre":[{"tag":"Anime"},{"tag":"J-Pop"}]. Pull the
     // tag of each entry (used by the artist detail meta row). Bounded scan over
     // the Genre array only, so it never picks up "tag" fields from other arrays.
     {
-        size_t gPos = resp.body.find("\"Genre\":");
+        size_t gPos = json.find("\"Genre\":");
         if (gPos != std::string::npos) {
-            size_t arrStart = resp.body.find('[', gPos);
-            size_t arrEnd   = resp.body.find(']', arrStart == std::string::npos ? gPos : arrStart);
+            size_t arrStart = json.find('[', gPos);
+            size_t arrEnd   = json.find(']', arrStart == std::string::npos ? gPos : arrStart);
             if (arrStart != std::string::npos && arrEnd != std::string::npos && arrEnd > arrStart) {
-                std::string arr = resp.body.substr(arrStart, arrEnd - arrStart + 1);
+                std::string arr = json.substr(arrStart, arrEnd - arrStart + 1);
                 size_t oPos = 0;
                 while ((oPos = arr.find('{', oPos)) != std::string::npos) {
                     size_t oEnd = arr.find('}', oPos);
@@ -1251,39 +1594,39 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
     }
 
     // Episode info
-    item.grandparentTitle = extractJsonValue(resp.body, "grandparentTitle");
-    item.parentTitle = extractJsonValue(resp.body, "parentTitle");
-    item.parentRatingKey = extractJsonValue(resp.body, "parentRatingKey");
-    item.grandparentRatingKey = extractJsonValue(resp.body, "grandparentRatingKey");
-    item.index = extractJsonInt(resp.body, "index");
-    item.parentIndex = extractJsonInt(resp.body, "parentIndex");
+    item.grandparentTitle = extractJsonValue(json, "grandparentTitle");
+    item.parentTitle = extractJsonValue(json, "parentTitle");
+    item.parentRatingKey = extractJsonValue(json, "parentRatingKey");
+    item.grandparentRatingKey = extractJsonValue(json, "grandparentRatingKey");
+    item.index = extractJsonInt(json, "index");
+    item.parentIndex = extractJsonInt(json, "parentIndex");
 
     // Extract part path for downloads from Media[0].Part[0].key
     // Look for "Part":[{"key":"/library/parts/...
-    size_t partPos = resp.body.find("\"Part\":");
+    size_t partPos = json.find("\"Part\":");
     if (partPos != std::string::npos) {
-        size_t partKeyPos = resp.body.find("\"key\":", partPos);
+        size_t partKeyPos = json.find("\"key\":", partPos);
         if (partKeyPos != std::string::npos && partKeyPos < partPos + 500) {
             // Extract the part key value
-            size_t start = resp.body.find('"', partKeyPos + 6);
+            size_t start = json.find('"', partKeyPos + 6);
             if (start != std::string::npos) {
-                size_t end = resp.body.find('"', start + 1);
+                size_t end = json.find('"', start + 1);
                 if (end != std::string::npos) {
-                    item.partPath = resp.body.substr(start + 1, end - start - 1);
+                    item.partPath = json.substr(start + 1, end - start - 1);
                     brls::Logger::debug("fetchMediaDetails: partPath={}", item.partPath);
                 }
             }
         }
 
         // Also try to get the file size
-        size_t sizePos = resp.body.find("\"size\":", partPos);
+        size_t sizePos = json.find("\"size\":", partPos);
         if (sizePos != std::string::npos && sizePos < partPos + 500) {
             size_t numStart = sizePos + 7;
-            while (numStart < resp.body.length() && !isdigit(resp.body[numStart])) numStart++;
+            while (numStart < json.length() && !isdigit(json[numStart])) numStart++;
             size_t numEnd = numStart;
-            while (numEnd < resp.body.length() && isdigit(resp.body[numEnd])) numEnd++;
+            while (numEnd < json.length() && isdigit(json[numEnd])) numEnd++;
             if (numEnd > numStart) {
-                item.partSize = std::stoll(resp.body.substr(numStart, numEnd - numStart));
+                item.partSize = std::stoll(json.substr(numStart, numEnd - numStart));
                 brls::Logger::debug("fetchMediaDetails: partSize={}", item.partSize);
             }
         }
@@ -1291,13 +1634,13 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
 
     // Parse markers (intro/credits) from "Marker" array in response
     // Plex returns: "Marker":[{"type":"intro","startTimeOffset":0,"endTimeOffset":30000}, ...]
-    size_t markerArrayPos = resp.body.find("\"Marker\":");
+    size_t markerArrayPos = json.find("\"Marker\":");
     if (markerArrayPos != std::string::npos) {
-        size_t arrStart = resp.body.find('[', markerArrayPos);
+        size_t arrStart = json.find('[', markerArrayPos);
         if (arrStart != std::string::npos) {
-            size_t arrEnd = resp.body.find(']', arrStart);
+            size_t arrEnd = json.find(']', arrStart);
             if (arrEnd != std::string::npos) {
-                std::string markerArr = resp.body.substr(arrStart, arrEnd - arrStart + 1);
+                std::string markerArr = json.substr(arrStart, arrEnd - arrStart + 1);
                 // Parse each marker object in the array
                 size_t mPos = 0;
                 while ((mPos = markerArr.find('{', mPos)) != std::string::npos) {
@@ -1324,7 +1667,7 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
     // Library section id, so the detail view can browse a person's other
     // titles within the same section ("more by this person").
     {
-        int sid = extractJsonInt(resp.body, "librarySectionID");
+        int sid = extractJsonInt(json, "librarySectionID");
         if (sid > 0) item.librarySectionKey = std::to_string(sid);
     }
 
@@ -1335,20 +1678,20 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
         auto parsePeople = [&](const char* arrayKey, const std::string& jobLabel,
                                const char* filterField) {
             std::string needle = std::string("\"") + arrayKey + "\":";
-            size_t keyPos = resp.body.find(needle);
+            size_t keyPos = json.find(needle);
             if (keyPos == std::string::npos) return;
-            size_t arrStart = resp.body.find('[', keyPos);
+            size_t arrStart = json.find('[', keyPos);
             if (arrStart == std::string::npos) return;
             // Walk to the matching close bracket for this array.
             int depth = 1;
             size_t i = arrStart + 1;
-            while (i < resp.body.size() && depth > 0) {
-                char c = resp.body[i];
+            while (i < json.size() && depth > 0) {
+                char c = json[i];
                 if (c == '[') depth++;
                 else if (c == ']') depth--;
                 i++;
             }
-            std::string arr = resp.body.substr(arrStart, i - arrStart);
+            std::string arr = json.substr(arrStart, i - arrStart);
             size_t p = 0;
             while ((p = arr.find('{', p)) != std::string::npos) {
                 int d = 1;
@@ -1380,8 +1723,6 @@ bool PlexClient::fetchMediaDetails(const std::string& ratingKey, MediaItem& item
         parsePeople("Writer", "Writer", "writer");
         if (item.cast.size() > 30) item.cast.resize(30);
     }
-
-    return true;
 }
 
 bool PlexClient::fetchByPersonFilter(const std::string& sectionKey, const std::string& filter,
@@ -1457,6 +1798,10 @@ bool PlexClient::fetchByPersonFilter(const std::string& sectionKey, const std::s
 
 bool PlexClient::fetchRelated(const std::string& ratingKey, std::vector<MediaItem>& items) {
     brls::Logger::debug("fetchRelated: ratingKey={}", ratingKey);
+
+    const int maxAge = metadataMaxAgeSec();
+    if (MetadataCache::get(MetadataCache::Kind::RELATED, ratingKey, maxAge, items)) return true;
+    const uint64_t stamp = MetadataCache::stamp();
     items.clear();
 
     HttpClient client;
@@ -1522,6 +1867,7 @@ bool PlexClient::fetchRelated(const std::string& ratingKey, std::vector<MediaIte
 
     // Keep the carousel light.
     if (items.size() > 24) items.resize(24);
+    MetadataCache::put(MetadataCache::Kind::RELATED, ratingKey, stamp, maxAge, items);
     brls::Logger::info("fetchRelated: {} related items", items.size());
     return true;
 }
@@ -1529,6 +1875,10 @@ bool PlexClient::fetchRelated(const std::string& ratingKey, std::vector<MediaIte
 bool PlexClient::fetchExtras(const std::string& ratingKey, std::vector<MediaItem>& items) {
     brls::Logger::debug("fetchExtras: ratingKey={}", ratingKey);
 
+    const int maxAge = metadataMaxAgeSec();
+    if (MetadataCache::get(MetadataCache::Kind::EXTRAS, ratingKey, maxAge, items)) return true;
+    const uint64_t stamp = MetadataCache::stamp();
+
     HttpClient client;
     std::string url = buildApiUrl("/library/metadata/" + ratingKey + "/extras");
 
@@ -1585,6 +1935,7 @@ bool PlexClient::fetchExtras(const std::string& ratingKey, std::vector<MediaItem
         pos = objEnd;
     }
 
+    MetadataCache::put(MetadataCache::Kind::EXTRAS, ratingKey, stamp, maxAge, items);
     brls::Logger::info("Found {} extras", items.size());
     return true;
 }
@@ -1831,7 +2182,7 @@ bool PlexClient::fetchArtistAlbumsByFilter(const std::string& sectionKey,
 }
 
 bool PlexClient::fetchHubs(std::vector<Hub>& hubs) {
-    brls::Logger::debug("fetchHubs: serverUrl={}", m_serverUrl);
+    brls::Logger::debug("fetchHubs: serverUrl={}", getServerUrl());
 
     std::string url = buildApiUrl("/hubs");
 
@@ -1943,7 +2294,7 @@ bool PlexClient::fetchHubs(std::vector<Hub>& hubs) {
 }
 
 bool PlexClient::fetchContinueWatching(std::vector<MediaItem>& items) {
-    brls::Logger::debug("fetchContinueWatching: serverUrl={}", m_serverUrl);
+    brls::Logger::debug("fetchContinueWatching: serverUrl={}", getServerUrl());
 
     HttpClient client;
     std::string url = buildApiUrl("/hubs/continueWatching");
@@ -2019,7 +2370,7 @@ bool PlexClient::fetchContinueWatching(std::vector<MediaItem>& items) {
 }
 
 bool PlexClient::fetchRecentlyAdded(std::vector<MediaItem>& items) {
-    brls::Logger::debug("fetchRecentlyAdded: serverUrl={}", m_serverUrl);
+    brls::Logger::debug("fetchRecentlyAdded: serverUrl={}", getServerUrl());
 
     HttpClient client;
     std::string url = buildApiUrl("/library/recentlyAdded");
@@ -2508,6 +2859,66 @@ bool PlexClient::fetchFilterValues(const std::string& sectionKey,
     return true;
 }
 
+bool PlexClient::fetchFirstCharacters(const std::string& sectionKey,
+                                      std::vector<FirstCharacter>& buckets,
+                                      int metadataType, const std::string& extraParams) {
+    HttpClient client;
+    std::string url = buildApiUrl("/library/sections/" + sectionKey + "/firstCharacter");
+    if (metadataType > 0) {
+        url += "&type=" + std::to_string(metadataType);
+    }
+    if (!extraParams.empty()) {
+        url += extraParams;
+    }
+
+    HttpRequest req;
+    req.url = url;
+    req.method = "GET";
+    req.headers["Accept"] = "application/json";
+    HttpResponse resp = client.request(req);
+
+    if (resp.statusCode != 200) {
+        brls::Logger::error("Failed to fetch first characters: {}", resp.statusCode);
+        if (isAuthError(resp.statusCode)) handleUnauthorized();
+        return false;
+    }
+
+    buckets.clear();
+
+    // Directory entries: {"size": 12, "key": "A", "title": "A"} ("#" comes
+    // back URL-encoded in key, so read the title).
+    size_t pos = 0;
+    while ((pos = resp.body.find("\"key\"", pos)) != std::string::npos) {
+        size_t objStart = resp.body.rfind('{', pos);
+        if (objStart == std::string::npos) {
+            pos++;
+            continue;
+        }
+
+        int braceCount = 1;
+        size_t objEnd = objStart + 1;
+        while (braceCount > 0 && objEnd < resp.body.length()) {
+            if (resp.body[objEnd] == '{') braceCount++;
+            else if (resp.body[objEnd] == '}') braceCount--;
+            objEnd++;
+        }
+
+        std::string obj = resp.body.substr(objStart, objEnd - objStart);
+
+        FirstCharacter bucket;
+        bucket.title = extractJsonValue(obj, "title");
+        bucket.size = extractJsonInt(obj, "size");
+        if (!bucket.title.empty() && bucket.size > 0) {
+            buckets.push_back(bucket);
+        }
+
+        pos = objEnd;
+    }
+
+    brls::Logger::debug("Found {} first-character buckets for section {}", buckets.size(), sectionKey);
+    return true;
+}
+
 bool PlexClient::fetchGenreItems(const std::string& sectionKey, std::vector<GenreItem>& genres) {
     return fetchFilterValues(sectionKey, "genre", genres);
 }
@@ -2651,8 +3062,9 @@ bool PlexClient::getPlaybackUrl(const std::string& ratingKey, std::string& url)
     brls::Logger::debug("getPlaybackUrl: ratingKey={}", ratingKey);
 
     // Fetch media details to get the Part key for streaming
+    const PlexSessionPtr session = this->session();
     HttpClient client;
-    std::string apiUrl = buildApiUrl("/library/metadata/" + ratingKey);
+    std::string apiUrl = buildApiUrl(*session, "/library/metadata/" + ratingKey);
 
     HttpRequest req;
     req.url = apiUrl;
@@ -2689,7 +3101,7 @@ bool PlexClient::getPlaybackUrl(const std::string& ratingKey, std::string& url)
 
     // Build stream URL from Part key
     // The Part key is something like /library/parts/12345/1234567890/file.mkv
-    url = m_serverUrl + partKey + "?X-Plex-Token=" + m_authToken;
+    url = session->serverUrl + partKey + "?X-Plex-Token=" + session->authToken;
 
     brls::Logger::info("getPlaybackUrl: Stream URL = {}", url);
     return true;
@@ -2963,26 +3375,41 @@ bool PlexClient::selectSearchedSubtitle(const std::string& ratingKey, int partId
 }
 
 void PlexClient::stopTranscode() {
-    if (m_lastSessionId.empty()) return;
+    std::string sessionId;
+    {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        sessionId.swap(m_lastSessionId);
+    }
+    stopTranscodeSession(sessionId);
+}
+
+void PlexClient::stopTranscodeSession(const std::string& sessionId) {
+    if (sessionId.empty()) return;
 
     HttpClient client;
-    std::string url = buildApiUrl("/video/:/transcode/universal/stop?session=" + m_lastSessionId);
+    std::string url = buildApiUrl("/video/:/transcode/universal/stop?session=" + sessionId);
 
     HttpRequest req;
     req.url = url;
     req.method = "GET";
     HttpResponse resp = client.request(req);
 
-    brls::Logger::debug("stopTranscode: session={} status={}", m_lastSessionId, resp.statusCode);
-    m_lastSessionId.clear();
+    brls::Logger::debug("stopTranscode: session={} status={}", sessionId, resp.statusCode);
 }
 
-bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url, int offsetMs) {
+void PlexClient::adoptTranscodeSession(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(m_playbackMutex);
+    m_lastSessionId = sessionId;
+}
+
+bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url, int offsetMs,
+                                 std::string* sessionIdOut) {
     brls::Logger::debug("getTranscodeUrl: ratingKey={}, offsetMs={}", ratingKey, offsetMs);
 
     // Fetch media details to get the Part key and determine if audio or video
+    const PlexSessionPtr session = this->session();
     HttpClient client;
-    std::string apiUrl = buildApiUrl("/library/metadata/" + ratingKey);
+    std::string apiUrl = buildApiUrl(*session, "/library/metadata/" + ratingKey);
 
     HttpRequest req;
     req.url = apiUrl;
@@ -3089,12 +3516,18 @@ bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url,
         queryParams += buf;
     }
 
-    // Session ID
-    m_lastSessionId = sessionId;
+    // Session ID. A track resolved ahead of time keeps its own so the one
+    // playing can still be stopped.
+    if (sessionIdOut) {
+        *sessionIdOut = sessionId;
+    } else {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        m_lastSessionId = sessionId;
+    }
     queryParams += "&session=" + sessionId;
 
     // Auth token
-    queryParams += "&X-Plex-Token=" + m_authToken;
+    queryParams += "&X-Plex-Token=" + session->authToken;
 
     // Profile augmentation (per official API Profile Augmentations spec).
     // Tell Plex exactly what transcode targets this client supports.
@@ -3133,7 +3566,7 @@ bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url,
 
     // Step 1: Call /decision with X-Plex-* as HTTP headers
     snprintf(buf, sizeof(buf), "/%s/:/transcode/universal/decision?", transcodeType);
-    std::string decisionUrl = m_serverUrl + buf + queryParams;
+    std::string decisionUrl = session->serverUrl + buf + queryParams;
     brls::Logger::info("getTranscodeUrl: Calling decision endpoint...");
 
     HttpClient decisionClient;
@@ -3173,7 +3606,7 @@ bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url,
         decisionResp.statusCode == 200 &&
         (decisionResp.body.find("\"decision\":\"directplay\"") != std::string::npos ||
          decisionResp.body.find("Direct play OK") != std::string::npos)) {
-        url = m_serverUrl + partKey + "?X-Plex-Token=" + m_authToken;
+        url = session->serverUrl + partKey + "?X-Plex-Token=" + session->authToken;
         brls::Logger::info("getTranscodeUrl: Direct play — original file {}", partKey);
         return true;
     }
@@ -3196,7 +3629,7 @@ bool PlexClient::getTranscodeUrl(const std::string& ratingKey, std::string& url,
     // HLS playlist for video (m3u8), mp3 for audio
     const char* container = isAudio ? "mp3" : "m3u8";
     snprintf(buf, sizeof(buf), "/%s/:/transcode/universal/start.%s?", transcodeType, container);
-    url = m_serverUrl + buf + startQuery;
+    url = session->serverUrl + buf + startQuery;
     brls::Logger::info("getTranscodeUrl: Transcode URL = {}", url);
 
     return true;
@@ -3206,6 +3639,7 @@ bool PlexClient::updatePlayProgress(const std::string& ratingKey, int timeMs) {
     HttpClient client;
     std::string url = buildApiUrl("/:/progress?key=" + ratingKey + "&time=" + std::to_string(timeMs) + "&identifier=com.plexapp.plugins.library");
     HttpResponse resp = client.get(url);
+    MetadataCache::invalidate(ratingKey);
     return resp.statusCode == 200;
 }
 
@@ -3230,6 +3664,8 @@ bool PlexClient::reportTimeline(const std::string& ratingKey, const std::string&
     req.headers["X-Plex-Product"] = PLEX_CLIENT_NAME;
 
     HttpResponse resp = client.request(req);
+    // viewOffset (and, past the end, the watched state) moved on the server.
+    MetadataCache::invalidate(ratingKey);
     return resp.statusCode == 200;
 }
 
@@ -3244,13 +3680,18 @@ bool PlexClient::reportLiveTimeline(const std::string& liveSessionUuid, int play
     // timer. The server *resolves* the playing item via ratingKey first,
     // and 404s if it can't — so we must pass the live-session metadata id
     // the tune created (captured into m_lastLiveRatingKey).
-    if (m_lastLiveRatingKey.empty()) {
+    std::string liveRatingKey;
+    {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        liveRatingKey = m_lastLiveRatingKey;
+    }
+    if (liveRatingKey.empty()) {
         brls::Logger::warning("reportLiveTimeline: no live ratingKey captured; skipping keep-alive");
         return false;
     }
     std::string keyPath = "/livetv/sessions/" + liveSessionUuid;
     std::string params = "/:/timeline?key=" + HttpClient::urlEncode(keyPath) +
-                         "&ratingKey=" + m_lastLiveRatingKey +
+                         "&ratingKey=" + liveRatingKey +
                          "&duration=0" +
                          "&time=0" +
                          "&playbackTime=" + std::to_string(playbackTimeMs) +
@@ -3280,6 +3721,7 @@ bool PlexClient::markAsWatched(const std::string& ratingKey) {
     HttpClient client;
     std::string url = buildApiUrl("/:/scrobble?key=" + ratingKey + "&identifier=com.plexapp.plugins.library");
     HttpResponse resp = client.get(url);
+    MetadataCache::invalidate(ratingKey);
     return resp.statusCode == 200;
 }
 
@@ -3287,21 +3729,32 @@ bool PlexClient::markAsUnwatched(const std::string& ratingKey) {
     HttpClient client;
     std::string url = buildApiUrl("/:/unscrobble?key=" + ratingKey + "&identifier=com.plexapp.plugins.library");
     HttpResponse resp = client.get(url);
+    MetadataCache::invalidate(ratingKey);
     return resp.statusCode == 200;
 }
 
 bool PlexClient::probeLiveTV() {
-    if (m_dvrId.empty()) {
+    return liveTVSession()->liveTV.available;
+}
+
+PlexSessionPtr PlexClient::liveTVSession() {
+    if (session()->liveTV.dvrId.empty()) {
         checkLiveTVAvailability();
     }
-    return m_hasLiveTV;
+    return session();
 }
 
 void PlexClient::checkLiveTVAvailability() {
     // Official Plex API: GET /livetv/dvrs
     // Returns DVR list with key, lineup, uuid, Device array, and ChannelMapping
+    // Parsed into a fresh LiveTVConfig and published in one swap, so Live TV
+    // callers on other threads never see a half-filled DVR setup.
+    const PlexSessionPtr session = this->session();
+    LiveTVConfig live;
+    live.epgProviderKey = session->liveTV.epgProviderKey;
+
     HttpClient client;
-    std::string url = buildApiUrl("/livetv/dvrs");
+    std::string url = buildApiUrl(*session, "/livetv/dvrs");
     HttpRequest req;
     req.url = url;
     req.method = "GET";
@@ -3310,9 +3763,9 @@ void PlexClient::checkLiveTVAvailability() {
 
     HttpResponse resp = client.request(req);
 
-    m_hasLiveTV = (resp.statusCode == 200);
+    live.available = (resp.statusCode == 200);
 
-    if (m_hasLiveTV && !resp.body.empty()) {
+    if (live.available && !resp.body.empty()) {
         brls::Logger::debug("DVR response (first 1000): {}",
                             resp.body.substr(0, 1000));
 
@@ -3323,33 +3776,32 @@ void PlexClient::checkLiveTVAvailability() {
             // Key may be just a number like "28" or a path like "/livetv/dvrs/28"
             size_t lastSlash = key.rfind('/');
             if (lastSlash != std::string::npos) {
-                m_dvrId = key.substr(lastSlash + 1);
+                live.dvrId = key.substr(lastSlash + 1);
             } else {
-                m_dvrId = key;
+                live.dvrId = key;
             }
         }
-        brls::Logger::info("Live TV DVR ID: {}", m_dvrId.empty() ? "(none)" : m_dvrId);
+        brls::Logger::info("Live TV DVR ID: {}", live.dvrId.empty() ? "(none)" : live.dvrId);
 
         // Parse lineup URI from DVR response
         // Per openapi.json: "lineup": "lineup://tv.plex.providers.epg.onconnect/USA-HI51418-X"
-        m_lineupUri = extractJsonValue(resp.body, "lineup");
-        if (!m_lineupUri.empty()) {
-            brls::Logger::info("Live TV Lineup URI: {}", m_lineupUri);
+        live.lineupUri = extractJsonValue(resp.body, "lineup");
+        if (!live.lineupUri.empty()) {
+            brls::Logger::info("Live TV Lineup URI: {}", live.lineupUri);
         }
 
         // Parse Device array for device UUIDs
         // Per openapi.json: Device items have "uuid" like "device://tv.plex.grabbers.hdhomerun/1053C0CA"
-        m_deviceIds.clear();
         size_t pos = 0;
         while ((pos = resp.body.find("\"uuid\"", pos)) != std::string::npos) {
             std::string uuid = extractJsonValue(resp.body.substr(pos), "uuid");
             if (!uuid.empty() && uuid.find("device://") != std::string::npos) {
                 bool found = false;
-                for (const auto& d : m_deviceIds) {
+                for (const auto& d : live.deviceIds) {
                     if (d == uuid) { found = true; break; }
                 }
                 if (!found) {
-                    m_deviceIds.push_back(uuid);
+                    live.deviceIds.push_back(uuid);
                     brls::Logger::info("Live TV Device UUID: {}", uuid);
                 }
             }
@@ -3358,7 +3810,6 @@ void PlexClient::checkLiveTVAvailability() {
 
         // Parse ChannelMapping to get available channel identifiers
         // Per openapi.json: "channelKey", "deviceIdentifier", "enabled", "lineupIdentifier"
-        m_channelMappings.clear();
         pos = 0;
         while ((pos = resp.body.find("\"channelKey\"", pos)) != std::string::npos) {
             std::string region = resp.body.substr(pos, std::min((size_t)300, resp.body.length() - pos));
@@ -3371,56 +3822,60 @@ void PlexClient::checkLiveTVAvailability() {
                 mapping.channelKey = channelKey;
                 mapping.deviceIdentifier = deviceId;
                 mapping.lineupIdentifier = extractJsonValue(region, "lineupIdentifier");
-                m_channelMappings.push_back(mapping);
+                live.channelMappings.push_back(mapping);
             }
             pos++;
         }
-        brls::Logger::info("Live TV: Found {} channel mappings", m_channelMappings.size());
+        brls::Logger::info("Live TV: Found {} channel mappings", live.channelMappings.size());
 
         // Extract EPG provider key from the DVR response's "epgIdentifier" field
         // This is the full provider key including DVR-specific suffix (e.g., "tv.plex.providers.epg.cloud:40")
         // The grid endpoint uses this as: GET /{epgIdentifier}/grid
-        if (m_epgProviderKey.empty()) {
-            m_epgProviderKey = extractJsonValue(resp.body, "epgIdentifier");
-            if (!m_epgProviderKey.empty()) {
-                brls::Logger::info("Live TV EPG provider key (from epgIdentifier): {}", m_epgProviderKey);
+        if (live.epgProviderKey.empty()) {
+            live.epgProviderKey = extractJsonValue(resp.body, "epgIdentifier");
+            if (!live.epgProviderKey.empty()) {
+                brls::Logger::info("Live TV EPG provider key (from epgIdentifier): {}", live.epgProviderKey);
             }
         }
 
         // Fallback: derive from lineup URI if epgIdentifier not found
-        if (m_epgProviderKey.empty() && !m_lineupUri.empty()) {
-            size_t protoEnd = m_lineupUri.find("://");
+        if (live.epgProviderKey.empty() && !live.lineupUri.empty()) {
+            size_t protoEnd = live.lineupUri.find("://");
             if (protoEnd != std::string::npos) {
                 size_t hostStart = protoEnd + 3;
-                size_t hostEnd = m_lineupUri.find('/', hostStart);
+                size_t hostEnd = live.lineupUri.find('/', hostStart);
                 if (hostEnd != std::string::npos) {
-                    m_epgProviderKey = m_lineupUri.substr(hostStart, hostEnd - hostStart);
+                    live.epgProviderKey = live.lineupUri.substr(hostStart, hostEnd - hostStart);
                 } else {
-                    m_epgProviderKey = m_lineupUri.substr(hostStart);
+                    live.epgProviderKey = live.lineupUri.substr(hostStart);
                 }
             }
-            if (!m_epgProviderKey.empty()) {
-                brls::Logger::info("Live TV EPG provider key (from lineup URI): {}", m_epgProviderKey);
+            if (!live.epgProviderKey.empty()) {
+                brls::Logger::info("Live TV EPG provider key (from lineup URI): {}", live.epgProviderKey);
             }
         }
     }
 
     brls::Logger::info("Live TV availability check: {} (dvr: {}, devices: {}, lineup: {}, mappings: {}, epg: {})",
-                        m_hasLiveTV ? "available" : "not available",
-                        m_dvrId.empty() ? "(none)" : m_dvrId,
-                        m_deviceIds.size(),
-                        m_lineupUri.empty() ? "(none)" : "set",
-                        m_channelMappings.size(),
-                        m_epgProviderKey.empty() ? "(none)" : m_epgProviderKey);
+                        live.available ? "available" : "not available",
+                        live.dvrId.empty() ? "(none)" : live.dvrId,
+                        live.deviceIds.size(),
+                        live.lineupUri.empty() ? "(none)" : "set",
+                        live.channelMappings.size(),
+                        live.epgProviderKey.empty() ? "(none)" : live.epgProviderKey);
+
+    // Drop the result if the user switched servers while we were probing.
+    updateSession([&](PlexSession& s) {
+        if (s.serverUrl == session->serverUrl) s.liveTV = std::move(live);
+    });
 }
 
 bool PlexClient::fetchLiveTVChannels(std::vector<LiveTVChannel>& channels) {
     HttpClient client;
 
     // Ensure DVR info is loaded
-    if (m_dvrId.empty()) {
-        checkLiveTVAvailability();
-    }
+    const PlexSessionPtr session = liveTVSession();
+    const LiveTVConfig& live = session->liveTV;
 
     channels.clear();
 
@@ -3431,11 +3886,11 @@ bool PlexClient::fetchLiveTVChannels(std::vector<LiveTVChannel>& channels) {
 
     // Official API: GET /livetv/epg/channels?lineup={lineupUri}
     // Returns Channel array with: callSign, identifier, channelVcn, hd, thumb, title, key
-    if (!m_lineupUri.empty()) {
-        std::string url = buildApiUrl("/livetv/epg/channels");
-        url += "&lineup=" + HttpClient::urlEncode(m_lineupUri);
+    if (!live.lineupUri.empty()) {
+        std::string url = buildApiUrl(*session, "/livetv/epg/channels");
+        url += "&lineup=" + HttpClient::urlEncode(live.lineupUri);
         req.url = url;
-        brls::Logger::debug("fetchLiveTVChannels: GET /livetv/epg/channels?lineup={}", m_lineupUri);
+        brls::Logger::debug("fetchLiveTVChannels: GET /livetv/epg/channels?lineup={}", live.lineupUri);
 
         // Cache the channels list — call signs, channel numbers, and
         // station logos almost never change. This is the body the user
@@ -3528,7 +3983,7 @@ bool PlexClient::fetchLiveTVChannels(std::vector<LiveTVChannel>& channels) {
                 // of "No guide data" rows for channels the user
                 // can't tune anyway.
                 const ChannelMapping* matchedMapping = nullptr;
-                for (const auto& mapping : m_channelMappings) {
+                for (const auto& mapping : live.channelMappings) {
                     if (!channel.key.empty() && channel.key == mapping.channelKey) {
                         matchedMapping = &mapping;
                         break;
@@ -3547,7 +4002,7 @@ bool PlexClient::fetchLiveTVChannels(std::vector<LiveTVChannel>& channels) {
                 // If we have no ChannelMapping data at all (some EPG
                 // providers don't), fall back to the old behaviour so
                 // the EPG isn't empty.
-                if (matchedMapping || m_channelMappings.empty()) {
+                if (matchedMapping || live.channelMappings.empty()) {
                     if (!channel.callSign.empty() || !channel.title.empty()) {
                         // Dedupe by the mapping's channelKey when one
                         // matched — two lineup entries can resolve to
@@ -3579,10 +4034,10 @@ bool PlexClient::fetchLiveTVChannels(std::vector<LiveTVChannel>& channels) {
     }
 
     // Fallback: GET /livetv/dvrs/{dvrId} to get ChannelMapping and build channel list
-    if (channels.empty() && !m_dvrId.empty()) {
-        std::string url = buildApiUrl("/livetv/dvrs/" + m_dvrId);
+    if (channels.empty() && !live.dvrId.empty()) {
+        std::string url = buildApiUrl(*session, "/livetv/dvrs/" + live.dvrId);
         req.url = url;
-        brls::Logger::debug("fetchLiveTVChannels: GET /livetv/dvrs/{}", m_dvrId);
+        brls::Logger::debug("fetchLiveTVChannels: GET /livetv/dvrs/{}", live.dvrId);
 
         HttpResponse resp = client.request(req);
         if (resp.statusCode == 200 && !resp.body.empty()) {
@@ -3661,9 +4116,8 @@ bool PlexClient::fetchEPGGrid(std::vector<LiveTVChannel>& channelsWithPrograms,
     int64_t profChanUs = 0;   // channel-list fetch (its own HTTP + parse)
 
     // Ensure DVR info is loaded
-    if (m_dvrId.empty()) {
-        checkLiveTVAvailability();
-    }
+    const PlexSessionPtr session = liveTVSession();
+    const LiveTVConfig& live = session->liveTV;
     profDvrUs = brls::getCPUTimeUsec() - profT0;
 
     // First get channel list via official API
@@ -3694,7 +4148,7 @@ bool PlexClient::fetchEPGGrid(std::vector<LiveTVChannel>& channelsWithPrograms,
     bool gotProgramData = false;
 
     bool skipPerChannel = false;
-    if (!m_epgProviderKey.empty()) {
+    if (!live.epgProviderKey.empty()) {
         // Attempt ONE type-less grid query first (gridType -1 omits the
         // type parameter): if the server returns airings of every EPG type
         // across all channels in a single response, the two type-filtered
@@ -3703,7 +4157,7 @@ bool PlexClient::fetchEPGGrid(std::vector<LiveTVChannel>& channelsWithPrograms,
         // entirely. Falls back to the old behaviour when the type-less
         // response is thin.
         for (int gridType : {-1, 4, 1}) {
-            std::string gridUrl = buildApiUrl("/" + m_epgProviderKey + "/grid");
+            std::string gridUrl = buildApiUrl(*session, "/" + live.epgProviderKey + "/grid");
             if (gridType >= 0) gridUrl += "&type=" + std::to_string(gridType);
             gridUrl += "&beginsAt%3C=" + std::to_string(endTime);
             gridUrl += "&endsAt%3E=" + std::to_string(now);
@@ -3915,7 +4369,7 @@ bool PlexClient::fetchEPGGrid(std::vector<LiveTVChannel>& channelsWithPrograms,
     // episodes (4); sports, news, and talk-shows tagged with other
     // types would otherwise show up empty. Running this for every
     // channel ensures parity with the official app.
-    if (!skipPerChannel && !m_epgProviderKey.empty()) {
+    if (!skipPerChannel && !live.epgProviderKey.empty()) {
         // Build the list of calendar dates the lookahead window spans.
         // The per-channel grid is keyed by `date=YYYY-MM-DD`, so a 12h
         // window starting after noon will need both today *and*
@@ -3942,7 +4396,7 @@ bool PlexClient::fetchEPGGrid(std::vector<LiveTVChannel>& channelsWithPrograms,
             if (channel.key.empty()) continue;
 
             for (const std::string& date : dates) {
-                std::string url = buildApiUrl("/" + m_epgProviderKey + "/grid");
+                std::string url = buildApiUrl(*session, "/" + live.epgProviderKey + "/grid");
                 url += "&channelGridKey=" + HttpClient::urlEncode(channel.key);
                 url += "&date=" + date;
                 req.url = url;
@@ -4097,12 +4551,10 @@ bool PlexClient::tuneLiveTVChannel(const std::string& channelKey, std::string& s
     brls::Logger::info("tuneLiveTVChannel: channelKey={}, programMetadataKey={}", channelKey, programMetadataKey);
 
     // Ensure we have DVR ID
-    if (m_dvrId.empty()) {
-        checkLiveTVAvailability();
-        if (m_dvrId.empty()) {
-            brls::Logger::error("tuneLiveTVChannel: No DVR ID available");
-            return false;
-        }
+    const PlexSessionPtr session = liveTVSession();
+    if (session->liveTV.dvrId.empty()) {
+        brls::Logger::error("tuneLiveTVChannel: No DVR ID available");
+        return false;
     }
 
     HttpClient client;
@@ -4112,7 +4564,7 @@ bool PlexClient::tuneLiveTVChannel(const std::string& channelKey, std::string& s
     // device's channel map is keyed by; the VCN ("2.1") shown in the spec example
     // is not recognized by the grabber and yields "device does not tune" errors.
     // Returns Media with uuid (session ID) which can be used for HLS streaming
-    std::string tuneUrl = buildApiUrl("/livetv/dvrs/" + m_dvrId + "/channels/" + channelKey + "/tune");
+    std::string tuneUrl = buildApiUrl(*session, "/livetv/dvrs/" + session->liveTV.dvrId + "/channels/" + channelKey + "/tune");
 
     HttpRequest tuneReq;
     tuneReq.url = tuneUrl;
@@ -4166,7 +4618,7 @@ bool PlexClient::tuneLiveTVChannel(const std::string& channelKey, std::string& s
         // alive never resets the rolling-subscription stop-grab timer.
         // EPG/program ratingKeys are URL-encoded strings ("plex%3A%2F%2F..."),
         // so we skip non-numeric matches when scanning.
-        m_lastLiveRatingKey.clear();
+        std::string liveRatingKey;
         {
             size_t scan = 0;
             const std::string needle = "\"ratingKey\"";
@@ -4181,14 +4633,18 @@ bool PlexClient::tuneLiveTVChannel(const std::string& channelKey, std::string& s
                     size_t ve = vs;
                     while (ve < tuneResp.body.length() &&
                            tuneResp.body[ve] >= '0' && tuneResp.body[ve] <= '9') ve++;
-                    m_lastLiveRatingKey = tuneResp.body.substr(vs, ve - vs);
+                    liveRatingKey = tuneResp.body.substr(vs, ve - vs);
                     break;
                 }
                 scan = at + needle.length();
             }
         }
+        {
+            std::lock_guard<std::mutex> lock(m_playbackMutex);
+            m_lastLiveRatingKey = liveRatingKey;
+        }
         brls::Logger::debug("tuneLiveTVChannel: live ratingKey = {}",
-                            m_lastLiveRatingKey.empty() ? "(none)" : m_lastLiveRatingKey);
+                            liveRatingKey.empty() ? "(none)" : liveRatingKey);
     } else if (tuneResp.statusCode == 0 || tuneResp.statusCode == -1) {
         // Connection drop / partial read - try to recover the uuid if present.
         brls::Logger::warning("tuneLiveTVChannel: Connection dropped (status {}), body so far ({} bytes): {}",
@@ -4232,6 +4688,7 @@ bool PlexClient::buildLiveSessionStreamUrl(const std::string& liveSessionId, std
     // followed by start.m3u8, then plays the universal session segments.
     AppSettings& settings = Application::getInstance().getSettings();
     const auto& vc = platform::getVideoConstraints();
+    const PlexSessionPtr session = this->session();
 
     std::string encodedPath = HttpClient::urlEncode("/livetv/sessions/" + liveSessionId);
 
@@ -4239,7 +4696,10 @@ bool PlexClient::buildLiveSessionStreamUrl(const std::string& liveSessionId, std
     char sessionBuf[48];
     snprintf(sessionBuf, sizeof(sessionBuf), "vita-%lu", (unsigned long)time(nullptr));
     std::string sessionId = sessionBuf;
-    m_lastSessionId = sessionId;
+    {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        m_lastSessionId = sessionId;
+    }
 
     char buf[256];
     int bitrate = settings.maxBitrate > 0 ? settings.maxBitrate : vc.defaultBitrate;
@@ -4256,7 +4716,7 @@ bool PlexClient::buildLiveSessionStreamUrl(const std::string& liveSessionId, std
     q += "&videoQuality=100";
     q += settings.showSubtitles ? "&subtitles=auto" : "&subtitles=none";
     q += "&session=" + sessionId;
-    q += "&X-Plex-Token=" + m_authToken;
+    q += "&X-Plex-Token=" + session->authToken;
 
     // Profile augmentation matches getTranscodeUrl's video branch so the server
     // picks an h264/aac HLS target the player can handle.
@@ -4275,7 +4735,7 @@ bool PlexClient::buildLiveSessionStreamUrl(const std::string& liveSessionId, std
     // live grab's consumer (/livetv/sessions/{id}/{sessionIdentifier}/...).
     HttpClient decisionClient;
     HttpRequest dReq;
-    dReq.url = m_serverUrl + "/video/:/transcode/universal/decision?" + q;
+    dReq.url = session->serverUrl + "/video/:/transcode/universal/decision?" + q;
     dReq.method = "GET";
     dReq.headers["Accept"] = "application/json";
     dReq.headers["X-Plex-Client-Identifier"] = PLEX_CLIENT_ID;
@@ -4306,7 +4766,7 @@ bool PlexClient::buildLiveSessionStreamUrl(const std::string& liveSessionId, std
     startQuery += "&X-Plex-Client-Profile-Extra=" + HttpClient::urlEncode(profileExtra);
     startQuery += "&X-Plex-Session-Identifier=" + std::string(PLEX_CLIENT_ID);
 
-    url = m_serverUrl + "/video/:/transcode/universal/start.m3u8?" + startQuery;
+    url = session->serverUrl + "/video/:/transcode/universal/start.m3u8?" + startQuery;
     brls::Logger::info("buildLiveSessionStreamUrl: stream session={} path=/livetv/sessions/{}",
                        sessionId, liveSessionId);
     return true;
@@ -4517,7 +4977,7 @@ bool PlexClient::createPlaylistWithItems(const std::string& title, const std::ve
         keysStr += ratingKeys[i];
     }
 
-    std::string uri = "server://" + m_currentServer.machineIdentifier +
+    std::string uri = "server://" + getMachineIdentifier() +
                       "/com.plexapp.plugins.library/library/metadata/" + keysStr;
 
     // POST /playlists?type=15&title={title}&smart=0&playlistType=audio&uri={uri}
@@ -4575,6 +5035,7 @@ bool PlexClient::deletePlaylist(const std::string& playlistId) {
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("deletePlaylist: Deleted playlist {}", playlistId);
     return true;
 }
@@ -4591,6 +5052,7 @@ bool PlexClient::renamePlaylist(const std::string& playlistId, const std::string
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("renamePlaylist: Renamed playlist {} to '{}'", playlistId, newTitle);
     return true;
 }
@@ -4605,7 +5067,7 @@ bool PlexClient::addToPlaylist(const std::string& playlistId, const std::vector<
         keysStr += ratingKeys[i];
     }
 
-    std::string uri = "server://" + m_currentServer.machineIdentifier +
+    std::string uri = "server://" + getMachineIdentifier() +
                       "/com.plexapp.plugins.library/library/metadata/" + keysStr;
 
     // PUT /playlists/{playlistId}/items?uri={uri}
@@ -4619,6 +5081,7 @@ bool PlexClient::addToPlaylist(const std::string& playlistId, const std::vector<
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("addToPlaylist: Added {} items to playlist {}", ratingKeys.size(), playlistId);
     return true;
 }
@@ -4635,6 +5098,7 @@ bool PlexClient::removeFromPlaylist(const std::string& playlistId, const std::st
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("removeFromPlaylist: Removed item {} from playlist {}", playlistItemId, playlistId);
     return true;
 }
@@ -4651,6 +5115,7 @@ bool PlexClient::clearPlaylist(const std::string& playlistId) {
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("clearPlaylist: Cleared playlist {}", playlistId);
     return true;
 }
@@ -4670,6 +5135,7 @@ bool PlexClient::movePlaylistItem(const std::string& playlistId, const std::stri
         return false;
     }
 
+    MetadataCache::invalidate(playlistId);
     brls::Logger::info("movePlaylistItem: Moved item {} after {} in playlist {}", playlistItemId, afterItemId, playlistId);
     return true;
 }
@@ -4748,13 +5214,13 @@ static void parsePlayQueueItems(const std::string& json, PlexClient& client,
 
 std::string PlexClient::buildPlayQueueURI(const std::string& ratingKey) {
     // library://{machineId}/item/%2Flibrary%2Fmetadata%2F{ratingKey}
-    return "library://" + m_currentServer.machineIdentifier +
+    return "library://" + getMachineIdentifier() +
            "/item/%2Flibrary%2Fmetadata%2F" + ratingKey;
 }
 
 std::string PlexClient::buildPlayQueueDirectoryURI(const std::string& ratingKey) {
     // library://{machineId}/directory/%2Flibrary%2Fmetadata%2F{ratingKey}%2Fchildren
-    return "library://" + m_currentServer.machineIdentifier +
+    return "library://" + getMachineIdentifier() +
            "/directory/%2Flibrary%2Fmetadata%2F" + ratingKey + "%2Fchildren";
 }
 
@@ -371,9 +371,10 @@ void SyncLoungeClient::start(const Config& config, LogFn log) {
     Config  cfg = config;
     LogFn   cb  = std::move(log);
     EventFn ev  = m_eventCb;
-    // Larger stack: the mbedtls TLS handshake under HTTPS has a deep call
+    // Own thread for the session's lifetime (not a pool worker), with a
+    // 512 KB stack: the mbedtls TLS handshake under HTTPS has a deep call
     // chain that overflows the default console thread stacks.
-    asyncRunLargeStack([session, cfg, cb, ev]() {
+    asyncRunDedicated([session, cfg, cb, ev]() {
         SyncLoungeClient::runWorker(session, cfg, cb, ev);
     });
 }
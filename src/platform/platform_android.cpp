@@ -214,6 +214,18 @@ std::size_t maxConcurrentNetworkRequests() {
     return 16;
 }
 
+std::size_t metadataCacheBytes() {
+    return 16 * 1024 * 1024;
+}
+
+int64_t musicPrefetchBytes() {
+    return (int64_t)256 * 1024 * 1024;
+}
+
+WorkerPoolConfig workerPoolConfig() {
+    return {16, 4, true};
+}
+
 bool needsHardExit() {
     return false;
 }
@@ -203,6 +203,20 @@ std::size_t maxConcurrentNetworkRequests() {
     return 8;
 }
 
+std::size_t metadataCacheBytes() {
+    return 16 * 1024 * 1024;
+}
+
+int64_t musicPrefetchBytes() {
+    return (int64_t)512 * 1024 * 1024;
+}
+
+WorkerPoolConfig workerPoolConfig() {
+    // Matches the sceHttp headroom above; 7 CPU cores for the app, so
+    // stealing keeps a burst from piling up behind one busy worker.
+    return {8, 2, true};
+}
+
 void launchThread(std::function<void()> task, std::size_t stackSize) {
     // PS4 musl pthread — set explicit stack size for the same reason
     // Switch needs it: the default newlib-on-Orbis stack is small enough
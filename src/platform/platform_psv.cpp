@@ -312,6 +312,22 @@ std::size_t maxConcurrentNetworkRequests() {
     return 4;
 }
 
+std::size_t metadataCacheBytes() {
+    // ~115 MB of usable heap shared with decoded covers and mpv.
+    return 2 * 1024 * 1024;
+}
+
+int64_t musicPrefetchBytes() {
+    // On the memory card next to downloads: room for the next few tracks.
+    return (int64_t)64 * 1024 * 1024;
+}
+
+WorkerPoolConfig workerPoolConfig() {
+    // Small fixed pool: every 512 KB stack comes out of a tight budget,
+    // and a single shared queue is all four workers need.
+    return {4, 1, false};
+}
+
 void launchThread(std::function<void()> task, std::size_t stackSize) {
     // PSV: VITASDK's std::thread defaults to a 256 KB stack which
     // overflows on HLS / curl operations with deep call stacks. Use
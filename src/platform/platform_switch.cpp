@@ -232,6 +232,21 @@ std::size_t maxConcurrentNetworkRequests() {
     return 4;
 }
 
+std::size_t metadataCacheBytes() {
+    return 8 * 1024 * 1024;
+}
+
+int64_t musicPrefetchBytes() {
+    return (int64_t)256 * 1024 * 1024;
+}
+
+WorkerPoolConfig workerPoolConfig() {
+    // A couple more workers than the network gate, so quick non-network
+    // tasks (disk probes, JSON parsing) don't queue behind four stalled
+    // fetches. Three application cores — worth stealing across.
+    return {6, 2, true};
+}
+
 bool needsHardExit() {
     return false;
 }
@@ -8,6 +8,7 @@
 #include "app/application.hpp"
 #include "platform/platform.hpp"
 #include "utils/http_client.hpp"
+#include "utils/async.hpp"
 #ifdef __ANDROID__
 #include "platform/android_mpv_surface.hpp"
 #endif
@@ -73,6 +74,8 @@ static void* mpvSwitchGlGetProcAddress(void* ctx, const char* name) {
 #include <clocale>
 #include <mutex>
 #include <vector>
+#include <chrono>
+#include <thread>
 
 #ifdef __vita__
 // Defined in patches/psv_platform.cpp - throttles the borealis main loop
@@ -106,6 +109,7 @@ void MpvPlayer::flushGpu() {
 static const uint64_t CMD_LOADFILE = 1;
 static const uint64_t CMD_STOP = 2;
 static const uint64_t CMD_SEEK = 3;
+static const uint64_t CMD_APPEND = 4;
 
 MpvPlayer& MpvPlayer::getInstance() {
     static MpvPlayer instance;
@@ -159,6 +163,9 @@ bool MpvPlayer::init() {
     mpv_set_option_string(m_mpv, "terminal", "no");
     mpv_set_option_string(m_mpv, "ytdl", "no");  // Disable youtube-dl (like switchfin)
     mpv_set_option_string(m_mpv, "reset-on-next-file", "speed,pause");  // Reset state between files
+    // Open an appended entry (appendUrl) before the current one ends, so the
+    // switch between music tracks is gapless.
+    mpv_set_option_string(m_mpv, "prefetch-playlist", "yes");
 
 #ifdef __SWITCH__
     // libmpv resolves its config / cache / watch-later / font directories from
@@ -485,6 +492,10 @@ bool MpvPlayer::init() {
     mpv_observe_property(m_mpv, 9, "speed", MPV_FORMAT_DOUBLE);
     mpv_observe_property(m_mpv, 10, "volume", MPV_FORMAT_INT64);
 
+    m_events.clear();
+    m_live.reset();
+    startEventThread();
+
     brls::Logger::info("MpvPlayer: Initialized successfully");
     m_state = MpvPlayerState::IDLE;
     m_commandPending = false;
@@ -500,6 +511,9 @@ void MpvPlayer::shutdown() {
         vitaplex_set_audio_playback_active(false);
 #endif
 
+        // The event thread must be out of mpv_wait_event before the handle goes
+        stopEventThread();
+
         // Clean up render context first (locks m_renderMutex to wait for in-flight renders)
         cleanupRenderContext();
 
@@ -541,19 +555,9 @@ void MpvPlayer::setAudioOnly(bool audioOnly) {
     m_audioOnly = audioOnly;
 }
 
-bool MpvPlayer::loadUrl(const std::string& url, const std::string& title) {
-    if (!m_mpv) {
-        if (!init()) {
-            return false;
-        }
-    }
-
-    // Prevent concurrent load operations
-    if (m_commandPending) {
-        brls::Logger::debug("MpvPlayer: Command already pending, ignoring load request");
-        return false;
-    }
-
+// Lower-case the http(s) scheme and, on PS4, route HTTPS through the local
+// proxy. Shared by loadUrl() and appendUrl().
+static std::string normalizeUrl(const std::string& url) {
     std::string normalizedUrl = url;
 
     // Normalize URL scheme to lowercase for http/https (handles Http, HTTP, HtTp, etc.)
@@ -594,11 +598,34 @@ bool MpvPlayer::loadUrl(const std::string& url, const std::string& title) {
     }
 #endif
 
+    return normalizedUrl;
+}
+
+bool MpvPlayer::loadUrl(const std::string& url, const std::string& title) {
+    if (!m_mpv) {
+        if (!init()) {
+            return false;
+        }
+    }
+
+    // Prevent concurrent load operations
+    if (m_commandPending) {
+        brls::Logger::debug("MpvPlayer: Command already pending, ignoring load request");
+        return false;
+    }
+
+    std::string normalizedUrl = normalizeUrl(url);
+
     brls::Logger::info("MpvPlayer: Loading URL: {}", redactTokensInUrl(normalizedUrl));
 
     m_currentUrl = normalizedUrl;
     m_playbackInfo = MpvPlaybackInfo();
     m_playbackInfo.mediaTitle = title;
+    m_live.reset();
+    // "replace" clears mpv's playlist, appended entry included.
+    m_appendedUrl.clear();
+    m_appendedTitle.clear();
+    m_advancing = false;
 
     // Mark command as pending
     m_commandPending = true;
@@ -644,6 +671,47 @@ bool MpvPlayer::loadFile(const std::string& path) {
     return loadUrl(path, "");
 }
 
+bool MpvPlayer::appendUrl(const std::string& url, const std::string& title) {
+    if (!m_mpv || m_stopping) return false;
+
+    // Audio only: a video file change re-creates GXM / GL resources and
+    // needs the loadUrl() handshake.
+    if (!m_audioOnly) return false;
+    if (m_state != MpvPlayerState::PLAYING && m_state != MpvPlayerState::PAUSED &&
+        m_state != MpvPlayerState::BUFFERING) {
+        return false;
+    }
+
+    // One entry at most: replace whatever was appended before.
+    if (!m_appendedUrl.empty()) clearAppended();
+
+    std::string normalizedUrl = normalizeUrl(url);
+    brls::Logger::info("MpvPlayer: Appending URL: {}", redactTokensInUrl(normalizedUrl));
+
+    const char* cmd[] = {"loadfile", normalizedUrl.c_str(), "append", nullptr};
+    int result = mpv_command_async(m_mpv, CMD_APPEND, cmd);
+    if (result < 0) {
+        brls::Logger::error("MpvPlayer: Failed to queue append: {}", mpv_error_string(result));
+        return false;
+    }
+    m_appendedUrl = normalizedUrl;
+    m_appendedTitle = title;
+    return true;
+}
+
+void MpvPlayer::clearAppended() {
+    // Once the current file has ended the entry is already starting; the
+    // caller sees the advance and reconciles.
+    if (m_appendedUrl.empty() || m_advancing) return;
+    m_appendedUrl.clear();
+    m_appendedTitle.clear();
+    if (!m_mpv || m_stopping) return;
+
+    // Removes every entry but the one playing.
+    const char* cmd[] = {"playlist-clear", nullptr};
+    mpv_command_async(m_mpv, 0, cmd);
+}
+
 void MpvPlayer::play() {
     if (!m_mpv || m_stopping) return;
 
@@ -674,7 +742,11 @@ void MpvPlayer::stop() {
     mpv_command_async(m_mpv, CMD_STOP, cmd);
 
     m_currentUrl.clear();
+    m_appendedUrl.clear();     // "stop" clears the playlist too
+    m_appendedTitle.clear();
+    m_advancing = false;
     m_playbackInfo = MpvPlaybackInfo();
+    m_live.reset();
     setState(MpvPlayerState::IDLE);
 }
 
@@ -932,20 +1004,17 @@ void MpvPlayer::removeExternalSubtitles() {
     m_subtitlesVisible = false;
 }
 
+// Observed "playback-time" / "duration", kept current by the event reader.
+// Reading them here used to be a synchronous mpv_get_property per call —
+// several per frame, each contending for the core lock the decoder holds.
 double MpvPlayer::getPosition() const {
     if (!m_mpv) return 0.0;
-
-    double pos = 0.0;
-    mpv_get_property(m_mpv, "playback-time", MPV_FORMAT_DOUBLE, &pos);
-    return pos;
+    return m_live.position.load(std::memory_order_relaxed);
 }
 
 double MpvPlayer::getDuration() const {
     if (!m_mpv) return 0.0;
-
-    double dur = 0.0;
-    mpv_get_property(m_mpv, "duration", MPV_FORMAT_DOUBLE, &dur);
-    return dur;
+    return m_live.duration.load(std::memory_order_relaxed);
 }
 
 double MpvPlayer::getPercentPosition() const {
@@ -1065,8 +1134,25 @@ void MpvPlayer::setState(MpvPlayerState newState) {
 void MpvPlayer::update() {
     if (!m_mpv || m_stopping) return;
 
-    // Process events (matching switchfin's eventMainLoop)
-    eventMainLoop();
+    if (m_eventThread) {
+        // Apply the state transitions the event thread queued since last frame
+        PlayerEvent event;
+        while (m_events.tryPop(event)) {
+            applyEvent(event);
+            if (!m_mpv || m_stopping) return;
+        }
+    } else {
+        // No event thread could be started: read mpv's queue here instead
+        eventMainLoop();
+    }
+
+    // One consistent copy of the coalesced properties for this frame
+    m_playbackInfo.position = m_live.position.load(std::memory_order_relaxed);
+    m_playbackInfo.duration = m_live.duration.load(std::memory_order_relaxed);
+    m_playbackInfo.cacheUsed = m_live.cacheUsed.load(std::memory_order_relaxed);
+    m_playbackInfo.volume = m_live.volume.load(std::memory_order_relaxed);
+    m_playbackInfo.seeking = m_live.seeking.load(std::memory_order_relaxed);
+    m_playbackInfo.buffering = m_live.buffering.load(std::memory_order_relaxed);
 
     // Update playback info when playing
     if (m_state == MpvPlayerState::PLAYING || m_state == MpvPlayerState::PAUSED) {
@@ -1074,6 +1160,69 @@ void MpvPlayer::update() {
     }
 }
 
+void MpvPlayer::startEventThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_eventThreadMutex);
+        m_eventThreadRunning = true;
+    }
+    m_eventThread = true;
+
+    // launchThread() runs the body inline when it can't create a thread;
+    // blocking in mpv_wait_event on the UI thread would hang the app, so
+    // fall back to polling from update() instead.
+    const std::thread::id caller = std::this_thread::get_id();
+    mpv_handle* mpv = m_mpv;
+    asyncRunDedicated([this, caller, mpv]() {
+        if (std::this_thread::get_id() == caller) {
+            brls::Logger::warning("MpvPlayer: no event thread, polling from update()");
+            m_eventThread = false;
+            std::lock_guard<std::mutex> lock(m_eventThreadMutex);
+            m_eventThreadRunning = false;
+            return;
+        }
+        eventThreadLoop(mpv);
+    }, 256 * 1024);
+}
+
+void MpvPlayer::stopEventThread() {
+    if (!m_eventThread) return;
+
+    // m_stopping is already set; the wakeup gets the thread out of
+    // mpv_wait_event (or out of a push backoff) to notice it.
+    mpv_wakeup(m_mpv);
+    std::unique_lock<std::mutex> lock(m_eventThreadMutex);
+    m_eventThreadExit.wait(lock, [this] { return !m_eventThreadRunning; });
+    lock.unlock();
+
+    m_eventThread = false;
+    m_events.clear();
+}
+
+void MpvPlayer::eventThreadLoop(mpv_handle* mpv) {
+    brls::Logger::debug("MpvPlayer: event thread started");
+    while (!m_stopping.load()) {
+        mpv_event* event = mpv_wait_event(mpv, -1);
+        if (!event || event->event_id == MPV_EVENT_NONE) continue;
+
+        PlayerEvent out;
+        if (!translateEvent(event, out)) continue;
+
+        // Full ring means the UI thread is behind (loading screen, long
+        // frame). Wait for it rather than drop a state transition; mpv keeps
+        // buffering its own events meanwhile.
+        while (!m_events.tryPush(out)) {
+            if (m_stopping.load()) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        if (out.kind == PlayerEvent::Kind::SHUTDOWN) break;
+    }
+    brls::Logger::debug("MpvPlayer: event thread exiting");
+
+    std::lock_guard<std::mutex> lock(m_eventThreadMutex);
+    m_eventThreadRunning = false;
+    m_eventThreadExit.notify_all();
+}
+
 void MpvPlayer::eventMainLoop() {
     if (!m_mpv) return;
 
@@ -1085,201 +1234,288 @@ void MpvPlayer::eventMainLoop() {
             return;
         }
 
-        switch (event->event_id) {
-            case MPV_EVENT_LOG_MESSAGE: {
-                if (event->data) {
-                    mpv_event_log_message* msg = (mpv_event_log_message*)event->data;
-                    if (msg->log_level <= MPV_LOG_LEVEL_ERROR) {
-                        brls::Logger::error("mpv {}: {}", msg->prefix, msg->text);
-                    } else if (msg->log_level <= MPV_LOG_LEVEL_WARN) {
-                        brls::Logger::warning("mpv {}: {}", msg->prefix, msg->text);
+        PlayerEvent out;
+        if (translateEvent(event, out)) {
+            applyEvent(out);
+            if (out.kind == PlayerEvent::Kind::SHUTDOWN) return;
+        }
+    }
+}
+
+// Runs on the event thread (or in eventMainLoop). Logs, updates the
+// coalesced properties, and returns true with `out` filled for anything
+// that changes player state — that part is left to applyEvent() on the UI
+// thread, which owns m_state.
+bool MpvPlayer::translateEvent(mpv_event* event, PlayerEvent& out) {
+    switch (event->event_id) {
+        case MPV_EVENT_LOG_MESSAGE: {
+            if (event->data) {
+                mpv_event_log_message* msg = (mpv_event_log_message*)event->data;
+                if (msg->log_level <= MPV_LOG_LEVEL_ERROR) {
+                    brls::Logger::error("mpv {}: {}", msg->prefix, msg->text);
+                } else if (msg->log_level <= MPV_LOG_LEVEL_WARN) {
+                    brls::Logger::warning("mpv {}: {}", msg->prefix, msg->text);
 #if defined(__PS4__) || defined(__ANDROID__)
-                    } else {
-                        // Pipe info/verbose through borealis::Logger::info on
-                        // PS4 and Android so the diagnostic level we asked
-                        // mpv for actually surfaces in adb logcat. Removable
-                        // once the Android direct-surface path is verified
-                        // stable.
-                        brls::Logger::info("mpv {}: {}", msg->prefix, msg->text);
+                } else {
+                    // Pipe info/verbose through borealis::Logger::info on
+                    // PS4 and Android so the diagnostic level we asked
+                    // mpv for actually surfaces in adb logcat. Removable
+                    // once the Android direct-surface path is verified
+                    // stable.
+                    brls::Logger::info("mpv {}: {}", msg->prefix, msg->text);
 #endif
-                    }
                 }
-                break;
             }
+            return false;
+        }
 
-            case MPV_EVENT_SHUTDOWN:
-                brls::Logger::debug("MpvPlayer: EVENT_SHUTDOWN");
-                setState(MpvPlayerState::IDLE);
-                return;
-
-            case MPV_EVENT_START_FILE:
-                brls::Logger::debug("MpvPlayer: EVENT_START_FILE");
-                setState(MpvPlayerState::LOADING);
-                break;
-
-            case MPV_EVENT_FILE_LOADED:
-                brls::Logger::info("MpvPlayer: EVENT_FILE_LOADED");
-                m_commandPending = false;
-                // Don't transition to PLAYING yet - wait for PLAYBACK_RESTART
-                break;
-
-            case MPV_EVENT_PLAYBACK_RESTART:
-                brls::Logger::debug("MpvPlayer: EVENT_PLAYBACK_RESTART");
-                m_commandPending = false;
-                // Now safe to say we're playing
-                if (m_state == MpvPlayerState::LOADING || m_state == MpvPlayerState::BUFFERING) {
-                    int paused = 0;
-                    if (mpv_get_property(m_mpv, "pause", MPV_FORMAT_FLAG, &paused) >= 0) {
-                        setState(paused ? MpvPlayerState::PAUSED : MpvPlayerState::PLAYING);
-                    } else {
-                        setState(MpvPlayerState::PLAYING);
-                    }
-                }
-                break;
-
-            case MPV_EVENT_END_FILE: {
-                if (event->data) {
-                    mpv_event_end_file* end = (mpv_event_end_file*)event->data;
-                    brls::Logger::debug("MpvPlayer: EVENT_END_FILE reason={} error={}",
-                                       (int)end->reason, end->error);
-
-                    m_commandPending = false;
-
-                    // MPV_END_FILE_REASON_EOF = 0
-                    // MPV_END_FILE_REASON_STOP = 2
-                    // MPV_END_FILE_REASON_ERROR = 4
-                    if (end->reason == 0) {
-                        setState(MpvPlayerState::ENDED);
-                    } else if (end->reason == 4 || end->error < 0) {
-                        if (end->error < 0) {
-                            m_errorMessage = std::string("Playback error: ") + mpv_error_string(end->error);
-                        } else {
-                            m_errorMessage = "Playback failed";
-                        }
-                        brls::Logger::error("MpvPlayer: {} (reason={}, error={}, url={})",
-                                           m_errorMessage, (int)end->reason, end->error,
-                                           m_currentUrl.substr(0, 120));
-                        setState(MpvPlayerState::ERROR);
-                    } else {
-                        setState(MpvPlayerState::IDLE);
-                    }
-                }
-                break;
+        case MPV_EVENT_SHUTDOWN:
+            brls::Logger::debug("MpvPlayer: EVENT_SHUTDOWN");
+            out.kind = PlayerEvent::Kind::SHUTDOWN;
+            return true;
+
+        case MPV_EVENT_START_FILE:
+            brls::Logger::debug("MpvPlayer: EVENT_START_FILE");
+            out.kind = PlayerEvent::Kind::START_FILE;
+            return true;
+
+        case MPV_EVENT_FILE_LOADED:
+            brls::Logger::info("MpvPlayer: EVENT_FILE_LOADED");
+            out.kind = PlayerEvent::Kind::FILE_LOADED;
+            return true;
+
+        case MPV_EVENT_PLAYBACK_RESTART: {
+            brls::Logger::debug("MpvPlayer: EVENT_PLAYBACK_RESTART");
+            // Ask for "pause" here, next to the event, rather than on the UI
+            // thread a frame later.
+            int paused = 0;
+            if (mpv_get_property(m_mpv, "pause", MPV_FORMAT_FLAG, &paused) < 0) {
+                paused = 0;
             }
+            out.kind = PlayerEvent::Kind::PLAYBACK_RESTART;
+            out.flag = paused != 0;
+            return true;
+        }
 
-            case MPV_EVENT_IDLE:
-                brls::Logger::debug("MpvPlayer: EVENT_IDLE");
-                m_commandPending = false;
-                if (m_state != MpvPlayerState::ERROR && m_state != MpvPlayerState::ENDED) {
-                    setState(MpvPlayerState::IDLE);
-                }
-                break;
-
-            case MPV_EVENT_COMMAND_REPLY:
-                brls::Logger::debug("MpvPlayer: EVENT_COMMAND_REPLY id={} error={}",
-                                   event->reply_userdata, event->error);
-                if (event->reply_userdata == CMD_LOADFILE && event->error < 0) {
-                    m_errorMessage = std::string("Load failed: ") + mpv_error_string(event->error);
-                    brls::Logger::error("MpvPlayer: {}", m_errorMessage);
-                    m_commandPending = false;
-                    setState(MpvPlayerState::ERROR);
-                }
-                break;
+        case MPV_EVENT_END_FILE: {
+            if (!event->data) return false;
+            mpv_event_end_file* end = (mpv_event_end_file*)event->data;
+            brls::Logger::debug("MpvPlayer: EVENT_END_FILE reason={} error={}",
+                               (int)end->reason, end->error);
+            out.kind = PlayerEvent::Kind::END_FILE;
+            out.reason = (int)end->reason;
+            out.error = end->error;
+            return true;
+        }
 
-            case MPV_EVENT_PROPERTY_CHANGE:
-                if (event->data) {
-                    handlePropertyChange((mpv_event_property*)event->data, event->reply_userdata);
-                }
-                break;
+        case MPV_EVENT_IDLE:
+            brls::Logger::debug("MpvPlayer: EVENT_IDLE");
+            out.kind = PlayerEvent::Kind::IDLE;
+            return true;
+
+        case MPV_EVENT_COMMAND_REPLY:
+            brls::Logger::debug("MpvPlayer: EVENT_COMMAND_REPLY id={} error={}",
+                               event->reply_userdata, event->error);
+            if (event->reply_userdata == CMD_LOADFILE && event->error < 0) {
+                out.kind = PlayerEvent::Kind::LOAD_FAILED;
+                out.error = event->error;
+                return true;
+            }
+            if (event->reply_userdata == CMD_APPEND && event->error < 0) {
+                out.kind = PlayerEvent::Kind::APPEND_FAILED;
+                out.error = event->error;
+                return true;
+            }
+            return false;
 
-            default:
-                break;
-        }
+        case MPV_EVENT_PROPERTY_CHANGE:
+            if (!event->data) return false;
+            return translatePropertyChange((mpv_event_property*)event->data,
+                                           event->reply_userdata, out);
+
+        default:
+            return false;
     }
 }
 
-void MpvPlayer::handlePropertyChange(mpv_event_property* prop, uint64_t id) {
-    if (!prop || !prop->name) return;
+bool MpvPlayer::translatePropertyChange(mpv_event_property* prop, uint64_t id, PlayerEvent& out) {
+    if (!prop || !prop->name || !prop->data) return false;
 
     // Handle property changes based on observer ID (matching switchfin)
     switch (id) {
         case 1: // core-idle
-            if (prop->format == MPV_FORMAT_FLAG && prop->data) {
+            if (prop->format == MPV_FORMAT_FLAG) {
                 bool idle = *(int*)prop->data != 0;
                 brls::Logger::debug("MpvPlayer: core-idle = {}", idle);
             }
-            break;
+            return false;
 
         case 2: // pause
-            if (prop->format == MPV_FORMAT_FLAG && prop->data) {
-                bool paused = *(int*)prop->data != 0;
-                if (m_state == MpvPlayerState::PLAYING || m_state == MpvPlayerState::PAUSED) {
-                    setState(paused ? MpvPlayerState::PAUSED : MpvPlayerState::PLAYING);
-                }
-            }
-            break;
+            if (prop->format != MPV_FORMAT_FLAG) return false;
+            out.kind = PlayerEvent::Kind::PAUSE;
+            out.flag = *(int*)prop->data != 0;
+            return true;
 
         case 3: // duration
-            if (prop->format == MPV_FORMAT_DOUBLE && prop->data) {
-                m_playbackInfo.duration = *(double*)prop->data;
+            if (prop->format == MPV_FORMAT_DOUBLE) {
+                m_live.duration.store(*(double*)prop->data, std::memory_order_relaxed);
             }
-            break;
+            return false;
 
         case 4: // playback-time
-            if (prop->format == MPV_FORMAT_DOUBLE && prop->data) {
-                m_playbackInfo.position = *(double*)prop->data;
+            if (prop->format == MPV_FORMAT_DOUBLE) {
+                m_live.position.store(*(double*)prop->data, std::memory_order_relaxed);
             }
-            break;
+            return false;
 
         case 5: // cache-speed
-            if (prop->format == MPV_FORMAT_INT64 && prop->data) {
-                m_playbackInfo.cacheUsed = (double)(*(int64_t*)prop->data);
+            if (prop->format == MPV_FORMAT_INT64) {
+                m_live.cacheUsed.store((double)(*(int64_t*)prop->data), std::memory_order_relaxed);
             }
+            return false;
+
+        case 6: { // paused-for-cache
+            if (prop->format != MPV_FORMAT_FLAG) return false;
+            bool buffering = *(int*)prop->data != 0;
+            m_live.buffering.store(buffering, std::memory_order_relaxed);
+            out.kind = PlayerEvent::Kind::PAUSED_FOR_CACHE;
+            out.flag = buffering;
+            return true;
+        }
+
+        case 7: // eof-reached
+            if (prop->format != MPV_FORMAT_FLAG || *(int*)prop->data == 0) return false;
+            brls::Logger::debug("MpvPlayer: EOF reached");
+            out.kind = PlayerEvent::Kind::EOF_REACHED;
+            return true;
+
+        case 8: // seeking
+            if (prop->format == MPV_FORMAT_FLAG) {
+                m_live.seeking.store(*(int*)prop->data != 0, std::memory_order_relaxed);
+            }
+            return false;
+
+        case 9: // speed
+            // Could store playback speed if needed
+            return false;
+
+        case 10: // volume
+            if (prop->format == MPV_FORMAT_INT64) {
+                m_live.volume.store((int)(*(int64_t*)prop->data), std::memory_order_relaxed);
+            }
+            return false;
+    }
+    return false;
+}
+
+// UI thread. The state machine that used to live inline in eventMainLoop.
+void MpvPlayer::applyEvent(const PlayerEvent& event) {
+    using Kind = PlayerEvent::Kind;
+    switch (event.kind) {
+        case Kind::SHUTDOWN:
+            setState(MpvPlayerState::IDLE);
             break;
 
-        case 6: // paused-for-cache
-            if (prop->format == MPV_FORMAT_FLAG && prop->data) {
-                bool buffering = *(int*)prop->data != 0;
-                m_playbackInfo.buffering = buffering;
-                if (buffering && m_state == MpvPlayerState::PLAYING) {
-                    setState(MpvPlayerState::BUFFERING);
-                } else if (!buffering && m_state == MpvPlayerState::BUFFERING) {
-                    setState(MpvPlayerState::PLAYING);
-                }
+        case Kind::START_FILE:
+            if (m_advancing) {
+                // mpv moved on to the appended entry by itself. Position and
+                // duration are left alone: mpv is already reporting the new
+                // file's, and resetting them here could clobber those.
+                m_advancing = false;
+                m_currentUrl = m_appendedUrl;
+                m_playbackInfo = MpvPlaybackInfo();
+                m_playbackInfo.mediaTitle = m_appendedTitle;
+                m_appendedUrl.clear();
+                m_appendedTitle.clear();
+                m_advanceCount++;
+                brls::Logger::info("MpvPlayer: Advanced to appended entry");
             }
+            setState(MpvPlayerState::LOADING);
             break;
 
-        case 7: // eof-reached
-            if (prop->format == MPV_FORMAT_FLAG && prop->data) {
-                bool eof = *(int*)prop->data != 0;
-                if (eof) {
-                    brls::Logger::debug("MpvPlayer: EOF reached");
-                    // In audio-only mode on Vita, EVENT_END_FILE may not fire,
-                    // so transition to ENDED here to trigger auto-advance
-                    if (m_state == MpvPlayerState::PLAYING || m_state == MpvPlayerState::PAUSED) {
-                        setState(MpvPlayerState::ENDED);
-                    }
+        case Kind::FILE_LOADED:
+            m_commandPending = false;
+            // Don't transition to PLAYING yet - wait for PLAYBACK_RESTART
+            break;
+
+        case Kind::PLAYBACK_RESTART:
+            m_commandPending = false;
+            // Now safe to say we're playing
+            if (m_state == MpvPlayerState::LOADING || m_state == MpvPlayerState::BUFFERING) {
+                setState(event.flag ? MpvPlayerState::PAUSED : MpvPlayerState::PLAYING);
+            }
+            break;
+
+        case Kind::END_FILE:
+            m_commandPending = false;
+
+            // MPV_END_FILE_REASON_EOF = 0
+            // MPV_END_FILE_REASON_STOP = 2
+            // MPV_END_FILE_REASON_ERROR = 4
+            if (event.reason == 0 && !m_appendedUrl.empty()) {
+                // The appended entry starts next; this isn't the end.
+                m_advancing = true;
+            } else if (event.reason == 0) {
+                setState(MpvPlayerState::ENDED);
+            } else if (event.reason == 4 || event.error < 0) {
+                if (event.error < 0) {
+                    m_errorMessage = std::string("Playback error: ") + mpv_error_string(event.error);
+                } else {
+                    m_errorMessage = "Playback failed";
                 }
+                brls::Logger::error("MpvPlayer: {} (reason={}, error={}, url={})",
+                                   m_errorMessage, event.reason, event.error,
+                                   m_currentUrl.substr(0, 120));
+                setState(MpvPlayerState::ERROR);
+            } else {
+                setState(MpvPlayerState::IDLE);
             }
             break;
 
-        case 8: // seeking
-            if (prop->format == MPV_FORMAT_FLAG && prop->data) {
-                m_playbackInfo.seeking = *(int*)prop->data != 0;
+        case Kind::IDLE:
+            m_commandPending = false;
+            if (m_state != MpvPlayerState::ERROR && m_state != MpvPlayerState::ENDED) {
+                setState(MpvPlayerState::IDLE);
             }
             break;
 
-        case 9: // speed
-            if (prop->format == MPV_FORMAT_DOUBLE && prop->data) {
-                // Could store playback speed if needed
+        case Kind::APPEND_FAILED:
+            brls::Logger::warning("MpvPlayer: Append failed: {}", mpv_error_string(event.error));
+            m_appendedUrl.clear();
+            m_appendedTitle.clear();
+            break;
+
+        case Kind::LOAD_FAILED:
+            m_errorMessage = std::string("Load failed: ") + mpv_error_string(event.error);
+            brls::Logger::error("MpvPlayer: {}", m_errorMessage);
+            m_commandPending = false;
+            setState(MpvPlayerState::ERROR);
+            break;
+
+        case Kind::PAUSE:
+            if (m_state == MpvPlayerState::PLAYING || m_state == MpvPlayerState::PAUSED) {
+                setState(event.flag ? MpvPlayerState::PAUSED : MpvPlayerState::PLAYING);
             }
             break;
 
-        case 10: // volume
-            if (prop->format == MPV_FORMAT_INT64 && prop->data) {
-                m_playbackInfo.volume = (int)(*(int64_t*)prop->data);
+        case Kind::PAUSED_FOR_CACHE:
+            if (event.flag && m_state == MpvPlayerState::PLAYING) {
+                setState(MpvPlayerState::BUFFERING);
+            } else if (!event.flag && m_state == MpvPlayerState::BUFFERING) {
+                setState(MpvPlayerState::PLAYING);
+            }
+            break;
+
+        case Kind::EOF_REACHED:
+            // In audio-only mode on Vita, EVENT_END_FILE may not fire,
+            // so transition to ENDED here to trigger auto-advance
+            if (m_state == MpvPlayerState::PLAYING || m_state == MpvPlayerState::PAUSED) {
+                setState(MpvPlayerState::ENDED);
             }
             break;
+
+        case Kind::NONE:
+            break;
     }
 }
 
@@ -1351,6 +1587,18 @@ void MpvPlayer::onRenderUpdate(void* ctx) {
 
         uint64_t flags = mpv_render_context_update(player->m_mpvRenderCtx);
         if (flags & MPV_RENDER_UPDATE_FRAME) {
+            // New video frame: VideoView needs a redraw even though no view
+            // changed (redraw-on-demand would otherwise skip it).
+            brls::Application::markDirty();
+            // Credit the render to the profiler's MPV phase on every exit
+            // path below (the Android branch returns early).
+            struct RenderTimer {
+                brls::Time t0 = brls::getCPUTimeUsec();
+                ~RenderTimer() {
+                    brls::Application::addFramePhaseTime(
+                        brls::Application::FramePhase::MPV, brls::getCPUTimeUsec() - t0);
+                }
+            } renderTimer;
 #ifdef __vita__
             mpv_render_context_render(player->m_mpvRenderCtx, player->m_mpvParams);
             mpv_render_context_report_swap(player->m_mpvRenderCtx);
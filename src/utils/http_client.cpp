@@ -38,6 +38,29 @@ std::string redactTokensInUrl(const std::string& url) {
     return out;
 }
 
+// Ambient cancellation for this thread (see HttpCancelScope).
+static thread_local HttpCancelFlag t_cancelFlag;
+
+HttpCancelScope::HttpCancelScope(HttpCancelFlag flag) : m_previous(t_cancelFlag) {
+    t_cancelFlag = std::move(flag);
+}
+
+HttpCancelScope::~HttpCancelScope() {
+    t_cancelFlag = std::move(m_previous);
+}
+
+HttpCancelFlag HttpCancelScope::current() {
+    return t_cancelFlag;
+}
+
+// Progress hook used only when a request carries a cancel flag: a non-zero
+// return makes curl abort with CURLE_ABORTED_BY_CALLBACK. Ticks roughly once
+// a second while idle and on every chunk while data flows.
+static int cancelXferInfo(void* clientp, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+    auto* flag = static_cast<std::atomic<bool>*>(clientp);
+    return (flag && flag->load()) ? 1 : 0;
+}
+
 // Process-wide curl share: DNS results, TLS session IDs and the connection
 // cache are shared across every HttpClient instance. Subsystems each own a
 // client (guide fetch, channel list, DVR checks, image loader, downloads),
@@ -299,6 +322,14 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
         return response;
     }
 
+    // Cancelled before it started (the owning task was dropped while this
+    // request was still queued behind others): don't touch the network.
+    HttpCancelFlag cancel = req.cancel ? req.cancel : HttpCancelScope::current();
+    if (cancel && cancel->load()) {
+        response.error = "cancelled";
+        return response;
+    }
+
     CURL* curl = (CURL*)m_curl;
 
     // Reset curl handle
@@ -352,6 +383,12 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
     curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
     curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
 
+    if (cancel) {
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, cancelXferInfo);
+        curl_easy_setopt(curl, CURLOPT_XFERINFODATA, cancel.get());
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    }
+
     // Build headers list
     struct curl_slist* headerList = nullptr;
 
@@ -411,6 +448,9 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
 
         brls::Logger::debug("HTTP response: {} ({} bytes{})", response.statusCode,
                             response.body.length(), writeData.stopped ? ", stopped at JSON close" : "");
+    } else if (res == CURLE_ABORTED_BY_CALLBACK && cancel && cancel->load()) {
+        response.error = "cancelled";
+        brls::Logger::debug("HTTP cancelled: {}", redactTokensInUrl(req.url));
     } else {
         response.error = curl_easy_strerror(res);
         brls::Logger::error("HTTP error: {}", response.error);
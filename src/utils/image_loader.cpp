@@ -39,6 +39,33 @@ size_t ImageLoader::getCacheSize() {
     return s_cache.size();
 }
 
+void ImageLoader::storeInCache(const std::string& url, const std::vector<uint8_t>& data) {
+    std::lock_guard<std::mutex> lock(s_cacheMutex);
+
+    // Two loads of the same URL can race; keep the first and just promote it.
+    auto it = s_cache.find(url);
+    if (it != s_cache.end()) {
+        s_lruOrder.erase(it->second.lruIt);
+        s_lruOrder.push_front(url);
+        it->second.lruIt = s_lruOrder.begin();
+        return;
+    }
+
+    // LRU eviction: remove oldest entries until we're under the limit
+    while (s_cache.size() >= getMaxCacheSize() && !s_lruOrder.empty()) {
+        const std::string& oldest = s_lruOrder.back();
+        s_cache.erase(oldest);
+        s_lruOrder.pop_back();
+    }
+
+    // Insert new entry at front of LRU
+    s_lruOrder.push_front(url);
+    CacheEntry entry;
+    entry.data = data;
+    entry.lruIt = s_lruOrder.begin();
+    s_cache[url] = std::move(entry);
+}
+
 void ImageLoader::loadAsync(const std::string& url, LoadCallback callback,
                             brls::Image* target, std::shared_ptr<std::atomic<bool>> alive) {
     if (url.empty() || !target || !alive) return;
@@ -77,33 +104,18 @@ void ImageLoader::loadAsync(const std::string& url, LoadCallback callback,
         if (resp.success && !resp.body.empty()) {
             // Cache the image data
             std::vector<uint8_t> imageData(resp.body.begin(), resp.body.end());
-
-            {
-                std::lock_guard<std::mutex> lock(s_cacheMutex);
-
-                // LRU eviction: remove oldest entries until we're under the limit
-                while (s_cache.size() >= getMaxCacheSize() && !s_lruOrder.empty()) {
-                    const std::string& oldest = s_lruOrder.back();
-                    s_cache.erase(oldest);
-                    s_lruOrder.pop_back();
-                }
-
-                // Insert new entry at front of LRU
-                s_lruOrder.push_front(url);
-                CacheEntry entry;
-                entry.data = imageData;
-                entry.lruIt = s_lruOrder.begin();
-                s_cache[url] = std::move(entry);
-            }
+            storeInCache(url, imageData);
 
             // Update UI on main thread - check alive flag AND generation to prevent
-            // use-after-free when the target view has been destroyed
-            brls::sync([imageData, callback, target, alive, gen]() {
+            // use-after-free when the target view has been destroyed. Low
+            // priority: a page of covers decoding at once is the classic
+            // burst, so let the frame budget spread it out.
+            brls::Application::post([imageData, callback, target, alive, gen]() {
                 if (!alive->load()) return;        // Target was destroyed
                 if (gen != s_generation.load()) return;  // cancelAll() was called
                 target->setImageFromMem(imageData.data(), imageData.size());
                 if (callback) callback(target);
-            });
+            }, brls::Application::TaskPriority::LOW);
         }
     });
 }
@@ -119,6 +131,10 @@ static void dispatchCoverFromBytes(const std::vector<uint8_t>& bytes,
                                    std::atomic<uint64_t>& generationRef) {
     if (!alive->load() || gen != generationRef.load()) return;
 
+    // Covers are painted from a raw NVG handle in draw(), not through a
+    // view property, so nothing relayouts — request the frame explicitly.
+    brls::Application::markDirty();
+
     NVGcontext* vg = brls::Application::getNVGContext();
     if (!vg) return;
 
@@ -182,26 +198,31 @@ void ImageLoader::loadCoverAsync(const std::string& url, CoverCallback callback,
         if (!resp.success || resp.body.empty()) return;
 
         std::vector<uint8_t> imageData(resp.body.begin(), resp.body.end());
-        {
-            std::lock_guard<std::mutex> lock(s_cacheMutex);
-            while (s_cache.size() >= getMaxCacheSize() && !s_lruOrder.empty()) {
-                const std::string& oldest = s_lruOrder.back();
-                s_cache.erase(oldest);
-                s_lruOrder.pop_back();
-            }
-            s_lruOrder.push_front(url);
-            CacheEntry entry;
-            entry.data = imageData;
-            entry.lruIt = s_lruOrder.begin();
-            s_cache[url] = std::move(entry);
-        }
+        storeInCache(url, imageData);
 
-        brls::sync([imageData, callback, alive, gen]() {
+        brls::Application::post([imageData, callback, alive, gen]() {
             dispatchCoverFromBytes(imageData, callback, alive, gen, s_generation);
-        });
+        }, brls::Application::TaskPriority::LOW);
     });
 }
 
+void ImageLoader::prefetch(const std::string& url) {
+    if (url.empty() || s_paused.load()) return;
+    {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+        if (s_cache.count(url)) return;
+    }
+
+    // Plain blocking GET on the caller's worker, so the caller's
+    // HttpCancelScope (if any) can abort it.
+    HttpClient client;
+    HttpResponse resp = client.get(url);
+    if (!resp.success || resp.body.empty()) return;
+
+    std::vector<uint8_t> imageData(resp.body.begin(), resp.body.end());
+    storeInCache(url, imageData);
+}
+
 bool ImageLoader::loadFromFile(const std::string& path, brls::Image* target) {
     if (path.empty() || !target) return false;
 
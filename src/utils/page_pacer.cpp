@@ -0,0 +1,77 @@
+/**
+ * Adaptive page sizing implementation
+ */
+
+#include "utils/page_pacer.hpp"
+
+#include <algorithm>
+
+namespace vitaplex {
+
+namespace {
+// A page should land within a second of being asked for...
+constexpr double kTargetFetchUsec = 1000000.0;
+// ...and cost no more than a few frames to append. About what a 60-item
+// page costs on Vita, so the device the defaults were tuned on keeps them.
+constexpr double kBuildBudgetUsec = 80000.0;
+// Before the first page is timed.
+constexpr int64_t kDefaultFetchUsec = 500000;
+// Weight of the newest sample: a changed link shows within three pages.
+constexpr double kAlpha = 0.35;
+
+// Running averages of time and items per page, kept separately so the
+// per-item cost is their ratio. A short trailing page then counts for
+// little instead of reading as a very slow one.
+struct Average {
+    double usec = 0.0;
+    double items = 0.0;
+    bool seeded = false;
+
+    void add(size_t n, int64_t us) {
+        if (n == 0 || us <= 0) return;
+        if (!seeded) {
+            usec = (double)us;
+            items = (double)n;
+            seeded = true;
+            return;
+        }
+        usec += ((double)us - usec) * kAlpha;
+        items += ((double)n - items) * kAlpha;
+    }
+    double perItem() const { return seeded && items > 0.0 ? usec / items : 0.0; }
+};
+
+Average s_fetch;
+Average s_build;
+}  // namespace
+
+void PagePacer::recordFetch(size_t items, int64_t usec) {
+    s_fetch.add(items, usec);
+}
+
+void PagePacer::recordBuild(size_t items, int64_t usec) {
+    s_build.add(items, usec);
+}
+
+size_t PagePacer::pageSize(size_t baseSize, size_t columns) {
+    if (columns == 0) columns = 1;
+    double n = (double)baseSize;
+    if (s_fetch.perItem() > 0.0) n = kTargetFetchUsec / s_fetch.perItem();
+    if (s_build.perItem() > 0.0) n = std::min(n, kBuildBudgetUsec / s_build.perItem());
+
+    const double lo = std::max((double)columns, (double)baseSize / 2.0);
+    const double hi = std::max(lo, (double)baseSize * 2.0);
+    n = std::min(std::max(n, lo), hi);
+    return std::max(columns, (size_t)n / columns * columns);
+}
+
+int64_t PagePacer::fetchUsec(size_t items) {
+    if (s_fetch.perItem() <= 0.0) return kDefaultFetchUsec;
+    return (int64_t)(s_fetch.perItem() * (double)items);
+}
+
+int64_t PagePacer::buildUsec(size_t items) {
+    return (int64_t)(s_build.perItem() * (double)items);
+}
+
+} // namespace vitaplex
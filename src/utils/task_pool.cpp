@@ -0,0 +1,184 @@
+/**
+ * VitaPlex - Background task pool implementation
+ */
+
+#include "utils/task_pool.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace vitaplex {
+
+namespace {
+
+constexpr std::size_t kStandardStack = 512 * 1024;
+constexpr std::size_t kLargeStack    = 1024 * 1024;
+
+class WorkerPool;
+
+// Which pool (if any) the current thread works for, and its home queue.
+// Lets a task submitted from inside a worker stay on that worker's queue.
+thread_local WorkerPool* t_pool   = nullptr;
+thread_local std::size_t t_worker = 0;
+
+// Set on the submitting thread across launchThread(). launchThread() runs
+// the body inline when pthread_create fails; a worker that starts with
+// this still set is on the caller's thread and must not enter its loop.
+thread_local bool t_spawning = false;
+
+class WorkerPool {
+public:
+    WorkerPool(const char* name, std::size_t stackSize, std::size_t maxWorkers, bool stealing)
+        : m_name(name),
+          m_stackSize(stackSize),
+          m_maxWorkers(std::max<std::size_t>(1, maxWorkers)),
+          m_queues(stealing ? m_maxWorkers : 1) {}
+
+    void submit(std::function<void()> task) {
+        const std::size_t n = m_queues.size();
+        bool spawn = false;
+        std::size_t spawnIndex = 0;
+        std::size_t target;
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            // One of our own workers submitting: keep it on its home queue
+            // (no cross-core traffic unless someone idle steals it).
+            // Otherwise spread round-robin over the workers that exist.
+            if (t_pool == this) target = t_worker % n;
+            else target = m_nextQueue++ % std::max<std::size_t>(1, std::min(n, m_workers));
+            {
+                std::lock_guard<std::mutex> qlock(m_queues[target].mutex);
+                m_queues[target].tasks.push_back(std::move(task));
+            }
+            // Incremented under m_sleepMutex so a worker between its
+            // predicate check and wait() can't miss the wakeup.
+            m_pending++;
+            // Grow only while queued work outnumbers idle workers.
+            if ((std::size_t)m_pending > m_idle && m_workers < m_maxWorkers) {
+                spawnIndex = m_workers++;
+                spawn = true;
+            }
+        }
+        m_wake.notify_one();
+        if (spawn) spawnWorker(spawnIndex);
+    }
+
+    std::size_t pending() const { return (std::size_t)std::max(0, m_pending.load()); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void spawnWorker(std::size_t index) {
+        t_spawning = true;
+        bool ranInline = false;
+        platform::launchThread([this, index, &ranInline]() {
+            if (t_spawning) {
+                ranInline = true;
+                return;
+            }
+            run(index);
+        }, m_stackSize);
+        t_spawning = false;
+
+        if (ranInline) {
+            // No thread to be had. Give the slot back, and if the pool has
+            // no worker at all, run what's queued here — the same inline
+            // fallback launchThread() itself uses.
+            bool none;
+            {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                m_workers--;
+                none = (m_workers == 0);
+            }
+            brls::Logger::error("TaskPool[{}]: worker start failed", m_name);
+            std::function<void()> task;
+            while (none && take(0, task)) task();
+        } else {
+            brls::Logger::debug("TaskPool[{}]: started worker {} ({} KB stack)",
+                                m_name, index, m_stackSize / 1024);
+        }
+    }
+
+    void run(std::size_t self) {
+        t_pool   = this;
+        t_worker = self;
+        for (;;) {
+            std::function<void()> task;
+            if (take(self, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_idle++;
+            m_wake.wait(lock, [this] { return m_pending.load() > 0; });
+            m_idle--;
+        }
+    }
+
+    // Oldest task from the home queue, else steal the oldest from a sibling
+    // (walking outward from home so thieves don't all hit queue 0).
+    bool take(std::size_t self, std::function<void()>& out) {
+        const std::size_t n = m_queues.size();
+        for (std::size_t k = 0; k < n; k++) {
+            Queue& q = m_queues[(self + k) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.tasks.empty()) continue;
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            m_pending--;
+            return true;
+        }
+        return false;
+    }
+
+    const char* m_name;
+    const std::size_t m_stackSize;
+    const std::size_t m_maxWorkers;
+    std::vector<Queue> m_queues;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<int> m_pending{0};
+    std::size_t m_idle = 0;        // guarded by m_sleepMutex
+    std::size_t m_workers = 0;     // guarded by m_sleepMutex
+    std::size_t m_nextQueue = 0;   // guarded by m_sleepMutex
+};
+
+// Intentionally leaked: workers are detached and outlive static
+// destruction at exit, so the pools must never be torn down under them.
+WorkerPool& poolFor(StackClass cls) {
+    static WorkerPool* standard = nullptr;
+    static WorkerPool* large = nullptr;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        const platform::WorkerPoolConfig cfg = platform::workerPoolConfig();
+        standard = new WorkerPool("standard", kStandardStack, cfg.maxWorkers, cfg.workStealing);
+        large    = new WorkerPool("large", kLargeStack, cfg.maxLargeStackWorkers, cfg.workStealing);
+    });
+    return cls == StackClass::LARGE ? *large : *standard;
+}
+
+} // namespace
+
+std::size_t TaskPool::stackBytes(StackClass cls) {
+    return cls == StackClass::LARGE ? kLargeStack : kStandardStack;
+}
+
+void TaskPool::submit(std::function<void()> task, StackClass cls) {
+    poolFor(cls).submit(std::move(task));
+}
+
+std::size_t TaskPool::pendingCount() {
+    return poolFor(StackClass::STANDARD).pending() + poolFor(StackClass::LARGE).pending();
+}
+
+} // namespace vitaplex
@@ -0,0 +1,97 @@
+/**
+ * VitaPlex - Detail prefetcher implementation
+ */
+
+#include "view/detail_prefetcher.hpp"
+#include "view/media_detail_view.hpp"
+#include "utils/async.hpp"
+#include "utils/image_loader.hpp"
+#include "utils/task_pool.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+
+namespace vitaplex {
+
+namespace {
+// Long enough that D-pad repeat (and a flick through a row) never fires,
+// short enough to finish well before a deliberate press opens the page.
+constexpr int kDwellMs = 350;
+// Token bucket: a burst of three prefetches, then one every two seconds.
+constexpr double kBucketSize = 3.0;
+constexpr int64_t kRefillUsec = 2000000;
+
+uint64_t s_generation = 0;   // bumped on every focus change
+double s_tokens = kBucketSize;
+int64_t s_lastRefill = 0;
+
+TaskScope& scope() {
+    // Never destroyed: the pool may still be finishing a prefetch at exit.
+    static TaskScope* s_scope = new TaskScope();
+    return *s_scope;
+}
+
+bool opensDetailPage(const MediaItem& item) {
+    switch (item.mediaType) {
+        case MediaType::MOVIE:
+        case MediaType::SHOW:
+        case MediaType::SEASON:
+        case MediaType::MUSIC_ARTIST:
+        case MediaType::MUSIC_ALBUM:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool takeToken() {
+    const int64_t now = brls::getCPUTimeUsec();
+    if (s_lastRefill > 0)
+        s_tokens = std::min(kBucketSize,
+                            s_tokens + (double)(now - s_lastRefill) / (double)kRefillUsec);
+    s_lastRefill = now;
+    if (s_tokens < 1.0) return false;
+    s_tokens -= 1.0;
+    return true;
+}
+
+void start(const MediaItem& item) {
+    // The pool has no priorities; stand back while it has anything queued
+    // (a page of the grid, Home rails, a detail page's rows) instead.
+    if (ImageLoader::isPaused() || TaskPool::pendingCount() > 0) return;
+
+    MediaItem cached;
+    if (PlexClient::getInstance().cachedMediaDetails(item.ratingKey, cached)) return;
+    if (!takeToken()) return;
+
+    const std::string ratingKey = item.ratingKey;
+    const MediaItem fallback = item;
+    scope().run([ratingKey, fallback]() {
+        MediaItem details;
+        const bool loaded = PlexClient::getInstance().fetchMediaDetails(ratingKey, details);
+        ImageLoader::prefetch(MediaDetailView::posterUrl(loaded ? details : fallback));
+        return loaded;
+    });
+}
+}  // namespace
+
+void DetailPrefetcher::onFocus(const MediaItem& item) {
+    // Resting on another cell: the previous prefetch is no longer wanted.
+    onBlur();
+    scope().cancelAll();
+    if (item.ratingKey.empty() || !opensDetailPage(item)) return;
+
+    const uint64_t gen = s_generation;
+    brls::delay(kDwellMs, [gen, item]() {
+        if (gen != s_generation) return;   // focus has moved on
+        start(item);
+    });
+}
+
+void DetailPrefetcher::onBlur() {
+    // Only the timer: opening the item also takes focus from its cell, and
+    // that's exactly when an in-flight prefetch pays off.
+    s_generation++;
+}
+
+} // namespace vitaplex
@@ -663,7 +663,7 @@ void DownloadsTab::startAutoRefresh() {
 
     auto aliveWeak = std::weak_ptr<bool>(m_alive);
 
-    asyncRun([this, aliveWeak]() {
+    asyncRunDedicated([this, aliveWeak]() {
         while (m_autoRefreshEnabled.load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(REFRESH_INTERVAL_MS));
 
@@ -1936,8 +1936,8 @@ void DownloadsTab::showGroupDetail(DownloadGroupType groupType, const std::strin
     // PlayerActivity is on top of us would pop the player by mistake.
     auto* detailActivity = new brls::Activity(mainBox);
 
-    asyncRun([viewAlive, rowHandles, captGroupType, captGroupKey,
-              captTypeStr, captIsMusic, captTypeLabel, detailActivity]() {
+    asyncRunDedicated([viewAlive, rowHandles, captGroupType, captGroupKey,
+                       captTypeStr, captIsMusic, captTypeLabel, detailActivity]() {
         while (viewAlive->load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
             if (!viewAlive->load()) break;
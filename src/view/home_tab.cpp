@@ -10,10 +10,12 @@
 #include "view/media_detail_view.hpp"
 #include "view/long_press_gesture.hpp"
 #include "app/application.hpp"
+#include "app/home_snapshot.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/async.hpp"
 #include "platform/platform.hpp"
 
+#include <algorithm>
 #include <ctime>
 #include <mutex>
 
@@ -87,6 +89,10 @@ HomeTab::HomeTab() {
     m_scrollView->setContentView(m_scrollContent);
     this->addView(m_scrollView);
 
+    // Last session's rails first, so the tab has content before the server
+    // has answered anything; loadContent() then swaps in fresh data.
+    showSnapshot();
+
     // Load content immediately
     brls::Logger::debug("HomeTab: Loading content...");
     loadContent();
@@ -98,6 +104,48 @@ static bool homeIsDescendantOf(brls::View* view, brls::View* ancestor) {
     return false;
 }
 
+// Whether two rails would render the same cells.
+static bool sameRail(const std::vector<MediaItem>& a, const std::vector<MediaItem>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].ratingKey != b[i].ratingKey || a[i].viewOffset != b[i].viewOffset ||
+            a[i].watched != b[i].watched || a[i].title != b[i].title || a[i].thumb != b[i].thumb)
+            return false;
+    }
+    return true;
+}
+
+void HomeTab::showSnapshot() {
+    HomeSnapshot::Ptr snap = HomeSnapshot::current();
+    if (!snap) return;
+    brls::Logger::debug("HomeTab: showing snapshot from {}", (long long)snap->savedAt);
+    updateRow(m_continueWatchingRow, m_continueWatching, snap->continueWatching, true);
+    updateRow(m_moviesRow, m_recentMovies, snap->recentMovies);
+    updateRow(m_showsRow, m_recentShows, snap->recentShows);
+    updateRow(m_musicRow, m_recentMusic, snap->recentMusic);
+}
+
+void HomeTab::updateRow(HorizontalScrollRow* row, std::vector<MediaItem>& shown,
+                        const std::vector<MediaItem>& items, bool directPlay) {
+    if (!row) return;
+    if (!row->getChildren().empty() && sameRail(shown, items)) return;
+    shown = items;
+    populateRow(row, shown, directPlay);
+}
+
+void HomeTab::markRailFresh(unsigned rail) {
+    m_freshRails |= rail;
+    if (m_freshRails != kRailsAll) return;
+    m_freshRails = 0;
+
+    HomeSnapshot snap;
+    snap.continueWatching = m_continueWatching;
+    snap.recentMovies = m_recentMovies;
+    snap.recentShows = m_recentShows;
+    snap.recentMusic = m_recentMusic;
+    HomeSnapshot::store(std::move(snap));
+}
+
 void HomeTab::draw(NVGcontext* vg, float x, float y, float width, float height,
                    brls::Style style, brls::FrameContext* ctx) {
     // Vertical culling: mark rails/headers outside the page viewport
@@ -173,7 +221,23 @@ HorizontalScrollRow* HomeTab::createMediaRow() {
 void HomeTab::populateRow(HorizontalScrollRow* row, const std::vector<MediaItem>& items, bool directPlay) {
     if (!row) return;
 
-    row->clearViews();
+    // A refresh can land while the user is on one of this row's cells.
+    // Deleting the focused cell mid-dispatch crashes, so the old cells stay
+    // until focus has moved to the new cell at the same position.
+    brls::View* focus = brls::Application::getCurrentFocus();
+    std::vector<brls::View*> oldViews = row->getChildren();
+    size_t focusIndex = SIZE_MAX;
+    for (size_t i = 0; i < oldViews.size(); i++) {
+        if (focus && homeIsDescendantOf(focus, oldViews[i])) {
+            focusIndex = i;
+            break;
+        }
+    }
+    if (focusIndex == SIZE_MAX) {
+        row->clearViews();
+        oldViews.clear();
+    }
+    std::vector<brls::View*> newCells;
 
     for (const auto& item : items) {
         auto* cell = new MediaItemCell();
@@ -254,6 +318,7 @@ void HomeTab::populateRow(HorizontalScrollRow* row, const std::vector<MediaItem>
             }));
 
         row->addView(cell);
+        newCells.push_back(cell);
     }
 
     // Add placeholder if empty
@@ -264,6 +329,18 @@ void HomeTab::populateRow(HorizontalScrollRow* row, const std::vector<MediaItem>
         placeholder->setMarginLeft(10);
         row->addView(placeholder);
     }
+
+    if (focusIndex != SIZE_MAX) {
+        if (!newCells.empty()) {
+            brls::Application::giveFocus(newCells[std::min(focusIndex, newCells.size() - 1)]);
+        } else {
+            brls::Application::giveFocus(this);
+        }
+        // Box only forgets its remembered child in clearViews(); see
+        // RecyclingGrid::rebuildGrid().
+        row->setLastFocusedView(nullptr);
+        for (brls::View* v : oldViews) row->removeView(v, true);
+    }
 }
 
 void HomeTab::populateChannelRow() {
@@ -421,6 +498,7 @@ void HomeTab::willDisappear(bool resetState) {
     // Invalidate alive flag so pending async callbacks bail out
     if (m_alive) *m_alive = false;
     if (m_channelImgAlive) *m_channelImgAlive = false;
+    m_tasks.cancelAll();
     ImageLoader::cancelAll();
     // Free image cache when leaving home tab to reclaim memory
     ImageLoader::clearCache();
@@ -436,6 +514,8 @@ void HomeTab::willDisappear(bool resetState) {
     m_recentMusic.shrink_to_fit();
     m_recentChannels.clear();
     m_recentChannels.shrink_to_fit();
+    m_sectionFetches.clear();
+    m_sectionFetches.shrink_to_fit();
 
     // Mark as not loaded so data is re-fetched when returning
     m_loaded = false;
@@ -451,54 +531,68 @@ void HomeTab::onFocusGained() {
     }
 }
 
+namespace {
+struct ItemsResult {
+    bool ok = false;
+    std::vector<MediaItem> items;
+};
+
+struct SectionsResult {
+    bool ok = false;
+    std::vector<LibrarySection> sections;
+};
+
+// Per-type cap for each Recently Added rail.
+constexpr size_t kRecentRailItems = 8;
+}  // namespace
+
 void HomeTab::loadContent() {
     brls::Logger::debug("HomeTab::loadContent - Starting async load");
+    m_tasks.cancelAll();   // a reload supersedes anything still in flight
+    m_freshRails = 0;
 
     // Load continue watching asynchronously
-    asyncRun([this, aliveWeak = std::weak_ptr<bool>(m_alive)]() {
+    m_tasks.run([]() {
         brls::Logger::debug("HomeTab: Fetching continue watching (async)...");
-        PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> items;
-
-        if (client.fetchContinueWatching(items)) {
-            brls::Logger::info("HomeTab: Got {} continue watching items", items.size());
-
-            // Trim heavy fields to reduce memory
-            for (auto& item : items) item.trimForGrid();
-
-            brls::sync([this, items, aliveWeak]() {
-                auto alive = aliveWeak.lock();
-                if (!alive || !*alive) return;
-                m_continueWatching = items;
-                populateRow(m_continueWatchingRow, m_continueWatching, true);
-            });
-        } else {
+        ItemsResult r;
+        r.ok = PlexClient::getInstance().fetchContinueWatching(r.items);
+        // Trim heavy fields to reduce memory
+        for (auto& item : r.items) item.trimForGrid();
+        return r;
+    }).onUI([this](const ItemsResult& r) {
+        if (!r.ok) {
             brls::Logger::error("HomeTab: Failed to fetch continue watching");
+            return;
         }
-    });
+        brls::Logger::info("HomeTab: Got {} continue watching items", r.items.size());
+        updateRow(m_continueWatchingRow, m_continueWatching, r.items, true);
+        markRailFresh(kRailContinue);
+    }, brls::Application::TaskPriority::HIGH);
 
     // Load the Live TV "Recent Channels" rail (hides itself if empty).
     loadRecentChannels();
 
-    // Load recently added by fetching from library sections
-    asyncRun([this, aliveWeak = std::weak_ptr<bool>(m_alive)]() {
-        brls::Logger::debug("HomeTab: Fetching library sections for recently added...");
-        PlexClient& client = PlexClient::getInstance();
+    loadRecentlyAdded();
 
-        // First get all library sections
+    m_loaded = true;
+    brls::Logger::debug("HomeTab: Async content loading started");
+}
+
+void HomeTab::loadRecentlyAdded() {
+    m_sectionFetches.clear();
+    m_nextSectionFetch = 0;
+    m_sectionFetchesInFlight = 0;
+
+    m_tasks.run([]() {
+        brls::Logger::debug("HomeTab: Fetching library sections for recently added...");
+        SectionsResult r;
         std::vector<LibrarySection> sections;
-        if (!client.fetchLibrarySections(sections)) {
-            brls::Logger::error("HomeTab: Failed to fetch library sections");
-            return;
-        }
+        if (!PlexClient::getInstance().fetchLibrarySections(sections)) return r;
+        r.ok = true;
 
         // Get hidden libraries setting
         std::string hiddenLibraries = Application::getInstance().getSettings().hiddenLibraries;
 
-        std::vector<MediaItem> movies;
-        std::vector<MediaItem> shows;
-        std::vector<MediaItem> music;
-
         // Helper to check if library is hidden
         auto isHidden = [&hiddenLibraries](const std::string& key) -> bool {
             if (hiddenLibraries.empty()) return false;
@@ -511,56 +605,90 @@ void HomeTab::loadContent() {
             return (hidden == key);
         };
 
-        // Fetch recently added from each section by type
-        for (const auto& section : sections) {
+        for (auto& section : sections) {
             // Skip hidden libraries
             if (isHidden(section.key)) {
                 brls::Logger::debug("HomeTab: Skipping hidden library: {}", section.title);
                 continue;
             }
-
-            std::vector<MediaItem> sectionItems;
-
-            // Fetch recently added using the correct API endpoint
-            if (client.fetchSectionRecentlyAdded(section.key, sectionItems)) {
-                // Sort items by type
-                for (auto& item : sectionItems) {
-                    if (section.type == "movie") {
-                        if (movies.size() < 8) movies.push_back(item);
-                    } else if (section.type == "show") {
-                        if (shows.size() < 8) shows.push_back(item);
-                    } else if (section.type == "artist") {
-                        if (music.size() < 8) music.push_back(item);
-                    }
-                }
-            }
+            if (section.type == "movie" || section.type == "show" || section.type == "artist")
+                r.sections.push_back(std::move(section));
         }
+        return r;
+    }).onUI([this](const SectionsResult& r) {
+        if (!r.ok) {
+            brls::Logger::error("HomeTab: Failed to fetch library sections");
+            return;
+        }
+        for (const auto& section : r.sections) {
+            SectionFetch fetch;
+            fetch.section = section;
+            m_sectionFetches.push_back(std::move(fetch));
+        }
+        // A type with no sections shows its "No items" placeholder now.
+        for (const char* type : {"movie", "show", "artist"}) populateRecentRail(type);
+        startSectionFetches();
+    }, brls::Application::TaskPriority::HIGH);
+}
 
-        brls::Logger::info("HomeTab: Got {} movies, {} shows, {} music items",
-                           movies.size(), shows.size(), music.size());
+void HomeTab::startSectionFetches() {
+    const size_t maxInFlight = std::max<size_t>(1, platform::maxConcurrentNetworkRequests());
+    while (m_sectionFetchesInFlight < maxInFlight &&
+           m_nextSectionFetch < m_sectionFetches.size()) {
+        const size_t index = m_nextSectionFetch++;
+        const std::string key = m_sectionFetches[index].section.key;
+        m_sectionFetchesInFlight++;
 
-        // Trim heavy fields to reduce memory for grid display
-        for (auto& item : movies) item.trimForGrid();
-        for (auto& item : shows) item.trimForGrid();
-        for (auto& item : music) item.trimForGrid();
+        m_tasks.run([key]() {
+            // Fetch recently added using the correct API endpoint
+            ItemsResult r;
+            r.ok = PlexClient::getInstance().fetchSectionRecentlyAdded(key, r.items);
+            if (r.items.size() > kRecentRailItems) r.items.resize(kRecentRailItems);
+            // Trim heavy fields to reduce memory for grid display
+            for (auto& item : r.items) item.trimForGrid();
+            return r;
+        }).onUI([this, index](const ItemsResult& r) {
+            // A failed section just contributes nothing to its rail.
+            onSectionFetched(index, r.items);
+        }, brls::Application::TaskPriority::HIGH);
+    }
+}
 
-        // Update UI on main thread
-        brls::sync([this, movies, shows, music, aliveWeak]() {
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) return;
+void HomeTab::onSectionFetched(size_t index, const std::vector<MediaItem>& items) {
+    if (index >= m_sectionFetches.size()) return;
+    SectionFetch& fetch = m_sectionFetches[index];
+    fetch.done = true;
+    fetch.items = items;
+    m_sectionFetchesInFlight--;
 
-            m_recentMovies = movies;
-            m_recentShows = shows;
-            m_recentMusic = music;
+    startSectionFetches();
+    populateRecentRail(fetch.section.type);
+}
 
-            populateRow(m_moviesRow, m_recentMovies);
-            populateRow(m_showsRow, m_recentShows);
-            populateRow(m_musicRow, m_recentMusic);
-        });
-    });
+// Fill one Recently Added rail from its sections in server order, once none
+// of them is still pending.
+void HomeTab::populateRecentRail(const std::string& sectionType) {
+    std::vector<MediaItem> items;
+    for (const auto& fetch : m_sectionFetches) {
+        if (fetch.section.type != sectionType) continue;
+        if (!fetch.done) return;
+        for (const auto& item : fetch.items) {
+            if (items.size() >= kRecentRailItems) break;
+            items.push_back(item);
+        }
+    }
 
-    m_loaded = true;
-    brls::Logger::debug("HomeTab: Async content loading started");
+    brls::Logger::info("HomeTab: Got {} recently added {} items", items.size(), sectionType);
+    if (sectionType == "movie") {
+        updateRow(m_moviesRow, m_recentMovies, items);
+        markRailFresh(kRailMovies);
+    } else if (sectionType == "show") {
+        updateRow(m_showsRow, m_recentShows, items);
+        markRailFresh(kRailShows);
+    } else if (sectionType == "artist") {
+        updateRow(m_musicRow, m_recentMusic, items);
+        markRailFresh(kRailMusic);
+    }
 }
 
 // The channel rail's EPG snapshot outlives the tab instance (HomeTab is
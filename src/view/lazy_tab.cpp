@@ -0,0 +1,49 @@
+/**
+ * VitaPlex - Lazy Tab implementation
+ */
+
+#include "view/lazy_tab.hpp"
+
+namespace vitaplex {
+
+LazyTab::LazyTab(Creator creator) : m_creator(std::move(creator)) {
+    // Same shape the tab content had when TabFrame held it directly: one
+    // stretched, growing child filling both axes.
+    this->setAxis(brls::Axis::COLUMN);
+    this->setGrow(1.0f);
+    this->setAlignItems(brls::AlignItems::STRETCH);
+
+    // brls::delay runs on the UI thread; the weak flag covers the user
+    // moving on (TabFrame frees this placeholder) before the dwell expires.
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    brls::delay(DWELL_MS, [this, aliveWeak]() {
+        auto alive = aliveWeak.lock();
+        if (!alive || !*alive) return;
+        materialize();
+    });
+}
+
+LazyTab::~LazyTab() {
+    if (m_alive) *m_alive = false;
+}
+
+brls::View* LazyTab::getDefaultFocus() {
+    // RIGHT from the sidebar before the dwell expired: build now so focus
+    // has somewhere to land instead of dead-ending on an empty box.
+    materialize();
+    return brls::Box::getDefaultFocus();
+}
+
+void LazyTab::materialize() {
+    if (m_content || !m_creator) return;
+    const int64_t t0 = brls::getCPUTimeUsec();
+    m_content = m_creator();
+    m_creator = nullptr;  // drop captured strings; the creator runs once
+    if (!m_content) return;
+    m_content->setGrow(1.0f);
+    this->addView(m_content);
+    brls::Logger::debug("LazyTab: built tab content in {}ms",
+                        (brls::getCPUTimeUsec() - t0) / 1000);
+}
+
+} // namespace vitaplex
@@ -8,14 +8,18 @@
 #include "view/filter_chip.hpp"
 #include "activity/player_activity.hpp"
 #include "app/application.hpp"
+#include "app/library_search.hpp"
 #include "app/plex_palette.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/async.hpp"
 #include "utils/http_client.hpp"
+#include "utils/page_pacer.hpp"
 #include "app/music_queue.hpp"
 #include "app/downloads_manager.hpp"
 #include "platform/platform.hpp"
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 
 namespace vitaplex {
 
@@ -28,6 +32,20 @@ size_t LibrarySectionTab::libraryPageSize() {
     return v > 0 ? static_cast<size_t>(v) : 60;
 }
 
+// The platform size adjusted to the measured link and build speed, in whole
+// rows of the current grid.
+size_t LibrarySectionTab::nextPageSize() const {
+    return PagePacer::pageSize(libraryPageSize(), (size_t)std::max(1, m_contentGrid->columns()));
+}
+
+// Tell the grid how early to ask for the next page: its expected fetch (none
+// when it's sliced from the local index) plus the time to build its cells.
+void LibrarySectionTab::updatePrefetchLead() {
+    const size_t next = nextPageSize();
+    m_contentGrid->setPrefetchLead((m_servingLocal ? 0 : PagePacer::fetchUsec(next)) +
+                                   PagePacer::buildUsec(next));
+}
+
 size_t LibrarySectionTab::playlistTrackPageSize() {
     int v = platform::getImageConstraints().playlistTrackPageSize;
     return v > 0 ? static_cast<size_t>(v) : 50;
@@ -97,6 +115,14 @@ LibrarySectionTab::LibrarySectionTab(const std::string& sectionKey, const std::s
         m_sortLabel = savedSort->second.second;
     }
 
+    // Coming back to a section left recently: pick up its filters and where
+    // the grid was scrolled (see willDisappear). Also ahead of loadContent.
+    TabSnapshot snapshot;
+    if (s_snapshots.take(sectionKey, snapshot)) {
+        m_activeFilters  = std::move(snapshot.filters);
+        m_restoreTopItem = snapshot.topItem;
+    }
+
     this->setAxis(brls::Axis::COLUMN);
     this->setJustifyContent(brls::JustifyContent::FLEX_START);
     this->setAlignItems(brls::AlignItems::STRETCH);
@@ -282,6 +308,10 @@ LibrarySectionTab::LibrarySectionTab(const std::string& sectionKey, const std::s
     m_contentGrid->setOnLoadMore([this]() {
         loadNextPage();
     });
+    // ...and the rows above a window opened partway in
+    m_contentGrid->setOnLoadPrevious([this]() {
+        loadPreviousPage();
+    });
     m_contentGrid->setOnItemStartAction([this](const MediaItem& item) {
         if (item.type == "playlist") {
             // Find the matching Playlist struct for full metadata
@@ -361,6 +391,8 @@ LibrarySectionTab::LibrarySectionTab(const std::string& sectionKey, const std::s
     // it only while the all-items grid is sorted Title A-Z.
     buildAzRail();
 
+    if (!m_activeFilters.empty()) updateFilterChrome();
+
     // Load content immediately
     brls::Logger::debug("LibrarySectionTab: Created for section {} ({}) type={}", m_sectionKey, m_title, m_sectionType);
     loadContent();
@@ -374,7 +406,22 @@ LibrarySectionTab::~LibrarySectionTab() {
     brls::Logger::debug("LibrarySectionTab: Destroyed for section {}", m_sectionKey);
 }
 
+// Filters + scroll position of recently left sections. TabFrame frees the
+// whole tab (grid, cells, item vectors) when another tab is picked; this is
+// all that survives it.
+TabStateCache<LibrarySectionTab::TabSnapshot> LibrarySectionTab::s_snapshots;
+
 void LibrarySectionTab::willDisappear(bool resetState) {
+    // Snapshot while the tree is still laid out. Before the first page has
+    // arrived there is no scroll to read, so carry the pending one over.
+    TabSnapshot snapshot;
+    snapshot.filters = m_activeFilters;
+    if (!m_loaded)
+        snapshot.topItem = m_restoreTopItem;
+    else if (m_viewMode == LibraryViewMode::ALL_ITEMS && m_contentGrid)
+        snapshot.topItem = m_windowStart + m_contentGrid->firstVisibleItemIndex();
+    s_snapshots.put(m_sectionKey, std::move(snapshot));
+
     brls::Box::willDisappear(resetState);
     if (m_alive) *m_alive = false;
     ImageLoader::cancelAll();
@@ -397,57 +444,91 @@ void LibrarySectionTab::loadContent() {
     std::string key = m_sectionKey;
     std::weak_ptr<bool> aliveWeak = m_alive;  // Capture weak_ptr for async safety
 
+    m_windowStart = 0;
     m_pageOffset = 0;
     m_totalItemCount = 0;
+    m_servingLocal = false;
 
     std::string sectionType = m_sectionType;
     std::string params = buildListParams();   // current sort + filter fragment
-    asyncRun([this, key, sectionType, params, aliveWeak]() {
+    const bool tryLocal = canServeLocally();
+
+    // A restored scroll position past the first page opens the grid at that
+    // position's page; the rows above it load as the user scrolls up.
+    const size_t topItem = m_restoreTopItem;
+    const size_t firstOffset = windowStartFor(topItem);
+    // Long enough to reach past the restored item, as showLocalWindow does.
+    const size_t pageSize = std::max(nextPageSize(), topItem - firstOffset + libraryPageSize() / 2);
+    asyncRun([this, key, sectionType, params, tryLocal, topItem, firstOffset, pageSize, aliveWeak]() {
         PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> items;
-        int totalCount = 0;
+        const int metadataType = LibraryIndex::metadataTypeFor(sectionType);
+
+        // A section synced before opens from its local index without waiting
+        // on the network (and still opens when the server is unreachable).
+        // The query itself runs on the UI thread against whatever sort and
+        // filters are current by then.
+        LibraryIndex::Ptr index = LibraryIndex::load(key);
+        LibraryQuery::Ptr query = LibraryQuery::build(index);
+        if (tryLocal && query && index->size() > 0) {
+            brls::Application::post([this, query, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
 
-        // Plex type codes: 1=movie, 2=show, 8=artist, 9=album, 10=track
-        int metadataType = 0;
-        if (sectionType == "movie") metadataType = 1;
-        else if (sectionType == "show") metadataType = 2;
-        else if (sectionType == "artist") metadataType = 8;
+                m_query = query;
+                if (canServeLocally())
+                    showLocalIndex(query, query->run(m_sortParam, m_activeFilters), m_restoreTopItem);
+                m_restoreTopItem = 0;
+                m_loaded = true;
+            }, brls::Application::TaskPriority::HIGH);
+            syncLocalIndex(key, metadataType, index, aliveWeak);
+            return;
+        }
 
-        if (client.fetchLibraryContent(key, items, metadataType, libraryPageSize(), 0, &totalCount, params)) {
+        std::vector<MediaItem> items;
+        int totalCount = 0;
+        const int64_t t0 = brls::getCPUTimeUsec();
+        if (client.fetchLibraryContent(key, items, metadataType, (int)pageSize, (int)firstOffset,
+                                       &totalCount, params)) {
             brls::Logger::info("LibrarySectionTab: Got {} of {} items for section {}", items.size(), totalCount, key);
 
             // Trim heavy fields to reduce per-item memory in large libraries
             for (auto& item : items) {
                 item.trimForGrid();
             }
+            const int64_t fetchUsec = brls::getCPUTimeUsec() - t0;
 
-            brls::sync([this, items, totalCount, aliveWeak]() {
+            // First page of the section the user just opened: run it ahead
+            // of the cover callbacks that a previous page may still be draining.
+            brls::Application::post([this, items, totalCount, topItem, firstOffset, query, params,
+                                     fetchUsec, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) {
                     brls::Logger::debug("LibrarySectionTab: Tab destroyed, skipping UI update");
                     return;
                 }
 
-                m_items = items;
-                m_pageOffset = items.size();
-                m_totalItemCount = totalCount;
-
-                if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
-                    m_contentGrid->setDataSource(m_items);
-                    m_contentGrid->setHasMore(m_pageOffset < (size_t)m_totalItemCount);
-                }
-                updateCountLabel();
-                refreshAzRail();
+                PagePacer::recordFetch(items.size(), fetchUsec);
+                if (query) m_query = query;   // serves later re-sorts
                 m_loaded = true;
-            });
+                m_restoreTopItem = 0;
+                if (m_servingLocal || params != buildListParams()) return;   // re-sorted meanwhile
+                const int64_t t1 = brls::getCPUTimeUsec();
+                showServerWindow(items, firstOffset, totalCount, topItem);
+                PagePacer::recordBuild(items.size(), brls::getCPUTimeUsec() - t1);
+            }, brls::Application::TaskPriority::HIGH);
         } else {
             brls::Logger::error("LibrarySectionTab: Failed to load content for section {}", key);
-            brls::sync([this, aliveWeak]() {
+            brls::Application::post([this, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
                 m_loaded = true;
-            });
+            }, brls::Application::TaskPriority::HIGH);
+            return;
         }
+
+        // First visit (or a filtered one): the grid came from the server, so
+        // build / refresh the index for next time.
+        syncLocalIndex(key, metadataType, index, aliveWeak);
     });
 
     // Preload collections and genres for quick switching
@@ -540,43 +621,281 @@ void LibrarySectionTab::loadNextPage() {
         return;
     }
 
+    // Sized from the measured link and build speed; the grid usually asks
+    // for it well before the last row is reached (RecyclingGrid prefetch).
+    const size_t pageSize = nextPageSize();
+
+    if (m_servingLocal) {
+        const size_t before = m_pageOffset;
+        const int64_t t0 = brls::getCPUTimeUsec();
+        appendLocalItems(m_pageOffset + pageSize);
+        PagePacer::recordBuild(m_pageOffset - before, brls::getCPUTimeUsec() - t0);
+        updatePrefetchLead();
+        return;
+    }
+
     std::string key = m_sectionKey;
     std::string sectionType = m_sectionType;
     size_t offset = m_pageOffset;
     std::string params = buildListParams();   // keep pages consistent with the current sort/filter
     std::weak_ptr<bool> aliveWeak = m_alive;
 
-    asyncRun([this, key, sectionType, offset, params, aliveWeak]() {
+    asyncRun([this, key, sectionType, offset, pageSize, params, aliveWeak]() {
         PlexClient& client = PlexClient::getInstance();
         std::vector<MediaItem> items;
 
-        int metadataType = 0;
-        if (sectionType == "movie") metadataType = 1;
-        else if (sectionType == "show") metadataType = 2;
-        else if (sectionType == "artist") metadataType = 8;
-
-        if (client.fetchLibraryContent(key, items, metadataType, libraryPageSize(), (int)offset, nullptr, params)) {
+        const int64_t t0 = brls::getCPUTimeUsec();
+        if (client.fetchLibraryContent(key, items, LibraryIndex::metadataTypeFor(sectionType), (int)pageSize, (int)offset, nullptr, params)) {
             for (auto& item : items) {
                 item.trimForGrid();
             }
+            const int64_t fetchUsec = brls::getCPUTimeUsec() - t0;
 
-            brls::sync([this, items, offset, aliveWeak]() {
+            // Budgeted: a page append builds a whole page of cells; let it
+            // queue behind anything the user is actively waiting on.
+            brls::Application::post([this, items, offset, params, fetchUsec, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
+                PagePacer::recordFetch(items.size(), fetchUsec);
+                // A jump or re-sort replaced the window while this was in flight.
+                if (m_servingLocal || offset != m_pageOffset || params != buildListParams()) return;
 
                 m_pageOffset = offset + items.size();
                 // Append to our stored items too
                 m_items.insert(m_items.end(), items.begin(), items.end());
+                const int64_t t1 = brls::getCPUTimeUsec();
                 m_contentGrid->appendItems(items);
+                PagePacer::recordBuild(items.size(), brls::getCPUTimeUsec() - t1);
                 m_contentGrid->setHasMore(m_pageOffset < (size_t)m_totalItemCount);
-            });
+                updatePrefetchLead();
+            }, brls::Application::TaskPriority::NORMAL);
         } else {
-            brls::sync([this, aliveWeak]() {
+            brls::Application::post([this, offset, params, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
+                // A newer window's pages aren't this request's to stop.
+                if (m_servingLocal || offset != m_pageOffset || params != buildListParams()) return;
                 m_contentGrid->setHasMore(false);
-            });
+            }, brls::Application::TaskPriority::NORMAL);
+        }
+    });
+}
+
+void LibrarySectionTab::loadPreviousPage() {
+    if (m_windowStart == 0) {
+        m_contentGrid->setHasLess(false);
+        return;
+    }
+
+    // Whole rows only, so the grid can slot them in above without reflowing
+    // what's on screen (m_windowStart is always a row start).
+    const size_t cols = (size_t)std::max(1, m_contentGrid->columns());
+    const size_t chunk = std::max(cols, libraryPageSize() / cols * cols);
+    const size_t end = m_windowStart;
+    const size_t start = end > chunk ? end - chunk : 0;
+
+    if (m_servingLocal) {
+        if (!m_query) {
+            m_contentGrid->setHasLess(false);   // nothing to slice; unwedge the grid
+            return;
+        }
+        const auto& entries = m_query->index()->entries();
+        std::vector<MediaItem> items;
+        items.reserve(end - start);
+        for (size_t i = start; i < end; i++)
+            items.push_back(entries[m_localOrder[i]].toMediaItem());
+        prependWindow(items, start);
+        return;
+    }
+
+    std::string key = m_sectionKey;
+    std::string sectionType = m_sectionType;
+    std::string params = buildListParams();
+    std::weak_ptr<bool> aliveWeak = m_alive;
+
+    asyncRun([this, key, sectionType, start, end, params, aliveWeak]() {
+        PlexClient& client = PlexClient::getInstance();
+        std::vector<MediaItem> items;
+
+        if (client.fetchLibraryContent(key, items, LibraryIndex::metadataTypeFor(sectionType),
+                                       (int)(end - start), (int)start, nullptr, params)) {
+            for (auto& item : items) item.trimForGrid();
+            brls::Application::post([this, items, start, end, params, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (m_servingLocal || end != m_windowStart || params != buildListParams()) return;
+                prependWindow(items, start);
+            }, brls::Application::TaskPriority::NORMAL);
+        } else {
+            brls::Application::post([this, end, params, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (m_servingLocal || end != m_windowStart || params != buildListParams()) return;
+                m_contentGrid->setHasLess(m_windowStart > 0);   // let the next UP retry
+            }, brls::Application::TaskPriority::NORMAL);
+        }
+    });
+}
+
+void LibrarySectionTab::prependWindow(const std::vector<MediaItem>& items, size_t start) {
+    m_windowStart = start;
+    m_items.insert(m_items.begin(), items.begin(), items.end());
+    m_contentGrid->prependItems(items);
+    m_contentGrid->setHasLess(m_windowStart > 0);
+}
+
+// Where a window showing listing item `pos` starts: 0 while the first page
+// reaches it anyway, else the first item of its row, so the pages filled in
+// above it later come in whole rows.
+size_t LibrarySectionTab::windowStartFor(size_t pos) const {
+    if (pos < libraryPageSize()) return 0;
+    const size_t cols = (size_t)std::max(1, m_contentGrid->columns());
+    return pos / cols * cols;
+}
+
+void LibrarySectionTab::openWindowAt(size_t pos) {
+    if (m_servingLocal) {
+        showLocalWindow(pos);
+        return;
+    }
+
+    const size_t start = windowStartFor(pos);
+    std::string key = m_sectionKey;
+    std::string sectionType = m_sectionType;
+    std::string params = buildListParams();
+    std::weak_ptr<bool> aliveWeak = m_alive;
+
+    asyncRun([this, key, sectionType, start, pos, params, aliveWeak]() {
+        PlexClient& client = PlexClient::getInstance();
+        std::vector<MediaItem> items;
+        int totalCount = 0;
+        if (!client.fetchLibraryContent(key, items, LibraryIndex::metadataTypeFor(sectionType),
+                                        libraryPageSize(), (int)start, &totalCount, params))
+            return;
+        for (auto& item : items) item.trimForGrid();
+
+        brls::Application::post([this, items, totalCount, start, pos, params, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
+            if (m_servingLocal || params != buildListParams()) return;   // re-sorted meanwhile
+            showServerWindow(items, start, totalCount, pos);
+        }, brls::Application::TaskPriority::HIGH);
+    });
+}
+
+// Point the ALL_ITEMS grid at one server page: `items` sit at listing offset
+// `start` of `total`, and listing item `topItem` is scrolled to (and gets
+// focus when the grid is entered) if it isn't the first.
+void LibrarySectionTab::showServerWindow(const std::vector<MediaItem>& items, size_t start,
+                                         int total, size_t topItem) {
+    m_servingLocal = false;
+    m_localOrder.clear();
+    m_items = items;
+    m_windowStart = start;
+    m_pageOffset = start + items.size();
+    m_totalItemCount = total;
+
+    if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
+        m_contentGrid->setDataSource(m_items);
+        m_contentGrid->setHasMore(m_pageOffset < (size_t)m_totalItemCount);
+        m_contentGrid->setHasLess(m_windowStart > 0);
+        if (topItem > start && !m_items.empty()) {
+            size_t top = std::min(topItem - start, m_items.size() - 1);
+            m_contentGrid->scrollToItemIndex(top, false);
+            m_contentGrid->setDefaultFocusIndex(top);
         }
+    }
+    updatePrefetchLead();
+    updateCountLabel();
+    refreshAzRail();
+}
+
+bool LibrarySectionTab::canServeLocally() const {
+    return LibraryQuery::canRun(m_sortParam, m_activeFilters);
+}
+
+// Point the ALL_ITEMS grid at `query`'s index in `order`, materialising just
+// the window that shows `topItem` (the rest is sliced in as the user scrolls).
+void LibrarySectionTab::showLocalIndex(LibraryQuery::Ptr query, std::vector<uint32_t> order,
+                                       size_t topItem) {
+    m_query = std::move(query);
+    m_localOrder = std::move(order);
+    m_servingLocal = true;
+    m_totalItemCount = (int)m_localOrder.size();
+    showLocalWindow(topItem);
+}
+
+void LibrarySectionTab::showLocalWindow(size_t topItem) {
+    const size_t pageSize = libraryPageSize();
+    const size_t start = std::min(windowStartFor(topItem), m_localOrder.size());
+    const size_t end = std::min(m_localOrder.size(),
+                                std::max(start + pageSize, topItem + pageSize / 2));
+    const auto& entries = m_query->index()->entries();
+    m_items.clear();
+    m_items.reserve(end - start);
+    for (size_t i = start; i < end; i++)
+        m_items.push_back(entries[m_localOrder[i]].toMediaItem());
+    m_windowStart = start;
+    m_pageOffset = end;
+
+    if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
+        m_contentGrid->setDataSource(m_items);
+        m_contentGrid->setHasMore(m_pageOffset < m_localOrder.size());
+        m_contentGrid->setHasLess(m_windowStart > 0);
+        if (topItem > start && !m_items.empty()) {
+            size_t top = std::min(topItem - start, m_items.size() - 1);
+            m_contentGrid->scrollToItemIndex(top, false);
+            m_contentGrid->setDefaultFocusIndex(top);
+        }
+    }
+    updatePrefetchLead();
+    updateCountLabel();
+    refreshAzRail();
+}
+
+void LibrarySectionTab::appendLocalItems(size_t end) {
+    end = std::min(end, m_localOrder.size());
+    if (!m_query || m_pageOffset >= end) {
+        m_contentGrid->setHasMore(m_pageOffset < m_localOrder.size());
+        return;
+    }
+
+    const auto& entries = m_query->index()->entries();
+    std::vector<MediaItem> items;
+    items.reserve(end - m_pageOffset);
+    for (size_t i = m_pageOffset; i < end; i++)
+        items.push_back(entries[m_localOrder[i]].toMediaItem());
+
+    m_pageOffset = end;
+    m_items.insert(m_items.end(), items.begin(), items.end());
+    m_contentGrid->appendItems(items);
+    m_contentGrid->setHasMore(m_pageOffset < m_localOrder.size());
+}
+
+void LibrarySectionTab::syncLocalIndex(const std::string& key, int metadataType,
+                                       LibraryIndex::Ptr base, std::weak_ptr<bool> aliveWeak) {
+    // Its own thread: re-listing a large section can take minutes, too long
+    // to hold one of the pool's few workers.
+    asyncRunDedicated([this, key, metadataType, base, aliveWeak]() {
+        LibraryIndex::Ptr synced = LibraryIndex::sync(key, metadataType, base);
+        if (!synced || synced == base) return;   // offline, or nothing changed
+        LibrarySearch::update(synced);
+        if (aliveWeak.expired()) return;         // persisted; nobody left to show it
+
+        LibraryQuery::Ptr query = LibraryQuery::build(synced);
+        brls::Application::post([this, query, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
+
+            m_query = query;
+            // Swap the fresh index in under the user, keeping their place, only
+            // while the grid is already showing local results. A server-paged
+            // grid keeps its pages; the index serves the next re-sort or visit.
+            if (!m_servingLocal || !canServeLocally()) return;
+            size_t top = (m_viewMode == LibraryViewMode::ALL_ITEMS)
+                             ? m_windowStart + m_contentGrid->firstVisibleItemIndex() : 0;
+            showLocalIndex(query, query->run(m_sortParam, m_activeFilters), top);
+        }, brls::Application::TaskPriority::NORMAL);
     });
 }
 
@@ -614,6 +933,7 @@ void LibrarySectionTab::reloadAllItems() {
     if (m_contentGrid) m_contentGrid->setVisibility(brls::Visibility::VISIBLE);
     updateViewModeButtons();
 
+    m_windowStart = 0;
     m_pageOffset = 0;
     m_totalItemCount = 0;
 
@@ -621,31 +941,31 @@ void LibrarySectionTab::reloadAllItems() {
     std::string sectionType = m_sectionType;
     std::string params = buildListParams();
     std::weak_ptr<bool> aliveWeak = m_alive;
+
+    // Indexed section and a sort / filter set the query engine covers:
+    // re-order locally, no request.
+    if (m_query && canServeLocally()) {
+        m_currentAzLetter = 0;
+        showLocalIndex(m_query, m_query->run(m_sortParam, m_activeFilters), 0);
+        return;
+    }
+    m_servingLocal = false;
+    m_localOrder.clear();
+
     asyncRun([this, key, sectionType, params, aliveWeak]() {
         PlexClient& client = PlexClient::getInstance();
         std::vector<MediaItem> items;
         int totalCount = 0;
-        int metadataType = 0;
-        if (sectionType == "movie") metadataType = 1;
-        else if (sectionType == "show") metadataType = 2;
-        else if (sectionType == "artist") metadataType = 8;
 
-        if (client.fetchLibraryContent(key, items, metadataType, libraryPageSize(), 0, &totalCount, params)) {
+        if (client.fetchLibraryContent(key, items, LibraryIndex::metadataTypeFor(sectionType), libraryPageSize(), 0, &totalCount, params)) {
             for (auto& item : items) item.trimForGrid();
-            brls::sync([this, items, totalCount, aliveWeak]() {
+            brls::Application::post([this, items, totalCount, params, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
-                m_items = items;
-                m_pageOffset = items.size();
-                m_totalItemCount = totalCount;
-                if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
-                    m_contentGrid->setDataSource(m_items);
-                    m_contentGrid->setHasMore(m_pageOffset < (size_t)m_totalItemCount);
-                }
+                if (m_servingLocal || params != buildListParams()) return;   // re-sorted meanwhile
                 m_currentAzLetter = 0;   // fresh result set — clear the rail highlight
-                updateCountLabel();
-                refreshAzRail();
-            });
+                showServerWindow(items, 0, totalCount, 0);
+            }, brls::Application::TaskPriority::HIGH);
         }
     });
 }
@@ -947,6 +1267,11 @@ void LibrarySectionTab::showFilterValues(const std::string& field,
 // Push the current filter state into the UI (chip styling, count badge, applied
 // chips) and re-query the grid.
 void LibrarySectionTab::applyFilters() {
+    updateFilterChrome();
+    reloadAllItems();
+}
+
+void LibrarySectionTab::updateFilterChrome() {
     const int n = activeFilterCount();
 
     if (m_filtersBtn) {
@@ -962,7 +1287,6 @@ void LibrarySectionTab::applyFilters() {
     }
 
     rebuildAppliedFilterChips();
-    reloadAllItems();
 }
 
 void LibrarySectionTab::rebuildAppliedFilterChips() {
@@ -1067,22 +1391,90 @@ static char azBucket(const std::string& t) {
     return (c >= 'A' && c <= 'Z') ? c : '#';
 }
 
-void LibrarySectionTab::jumpToLetter(char letter) {
-    if (m_items.empty() || !m_contentGrid) return;
+static int azRank(char bucket) { return bucket == '#' ? 0 : (int)bucket; }   // '#' sorts first
 
-    char target = (char)toupper((unsigned char)letter);
-    auto rank = [](char b) { return b == '#' ? 0 : (int)b; };   // '#' sorts first
+// Listing offset of each rail letter's first title (kAzLetters order) from the
+// /firstCharacter buckets, which come back in title order: the sizes of every
+// bucket before the first one at or past the letter. Buckets that aren't a
+// rail letter (Plex can return accented ones) only add to the sum.
+static std::vector<size_t> azOffsetsFrom(const std::vector<FirstCharacter>& buckets) {
+    std::vector<size_t> offsets;
+    for (const char* c = kAzLetters; *c; ++c) {
+        size_t offset = 0;
+        for (const auto& b : buckets) {
+            const char t = b.title.size() == 1 ? (char)toupper((unsigned char)b.title[0]) : 0;
+            const bool railLetter = t == '#' || (t >= 'A' && t <= 'Z');
+            if (railLetter && azRank(t) >= azRank(*c)) break;
+            offset += (size_t)b.size;
+        }
+        offsets.push_back(offset);
+    }
+    return offsets;
+}
+
+void LibrarySectionTab::jumpToLetter(char letter) {
+    if (!m_contentGrid) return;
+    const char target = (char)toupper((unsigned char)letter);
 
-    // m_items is sorted by titleSort asc → first item whose bucket reaches target.
-    size_t found = m_items.size();
-    for (size_t i = 0; i < m_items.size(); i++) {
-        if (rank(azBucket(m_items[i].title)) >= rank(target)) { found = i; break; }
+    size_t pos = 0;
+    if (m_servingLocal && m_query) {
+        // The local order answers it directly — no request involved.
+        const auto& entries = m_query->index()->entries();
+        pos = m_localOrder.size();
+        for (size_t i = 0; i < m_localOrder.size(); i++) {
+            if (azRank(azBucket(entries[m_localOrder[i]].title)) >= azRank(target)) { pos = i; break; }
+        }
+    } else {
+        if (m_azOffsetsParams != buildListParams()) {
+            m_pendingAzLetter = target;   // jumps once the offsets are in
+            loadAzOffsets();
+            return;
+        }
+        const char* slot = strchr(kAzLetters, target);
+        if (!slot || (size_t)(slot - kAzLetters) >= m_azOffsets.size()) return;
+        pos = m_azOffsets[slot - kAzLetters];
     }
-    if (found >= m_items.size()) found = m_items.size() - 1;   // letter beyond loaded range
+    if (m_totalItemCount <= 0) return;
+    pos = std::min(pos, (size_t)m_totalItemCount - 1);   // letter past the last title
 
-    m_contentGrid->scrollToItemIndex(found, true);
     m_currentAzLetter = target;
     refreshAzRail();
+    if (pos >= m_windowStart && pos < m_pageOffset) {
+        m_contentGrid->scrollToItemIndex(pos - m_windowStart, true);
+        m_contentGrid->setDefaultFocusIndex(pos - m_windowStart);
+        return;
+    }
+    openWindowAt(pos);
+}
+
+void LibrarySectionTab::loadAzOffsets() {
+    if (m_azOffsetsLoading) return;
+    m_azOffsetsLoading = true;
+
+    std::string key = m_sectionKey;
+    std::string sectionType = m_sectionType;
+    std::string params = buildListParams();
+    std::weak_ptr<bool> aliveWeak = m_alive;
+
+    asyncRun([this, key, sectionType, params, aliveWeak]() {
+        std::vector<FirstCharacter> buckets;
+        bool ok = PlexClient::getInstance().fetchFirstCharacters(
+            key, buckets, LibraryIndex::metadataTypeFor(sectionType), params);
+
+        brls::Application::post([this, ok, buckets, params, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
+
+            m_azOffsetsLoading = false;
+            const char pending = m_pendingAzLetter;
+            m_pendingAzLetter = 0;
+            if (!ok || params != buildListParams()) return;   // re-sorted / filtered meanwhile
+
+            m_azOffsets = azOffsetsFrom(buckets);
+            m_azOffsetsParams = params;
+            if (pending) jumpToLetter(pending);
+        }, brls::Application::TaskPriority::HIGH);
+    });
 }
 
 void LibrarySectionTab::refreshAzRail() {
@@ -1092,6 +1484,11 @@ void LibrarySectionTab::refreshAzRail() {
     m_azRail->setVisibility(active ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
     if (!active) return;
 
+    // Fetch the letter offsets for a server-paged listing up front, so the
+    // first jump is a single page request too.
+    if (!m_servingLocal && m_loaded && m_azOffsetsParams != buildListParams())
+        loadAzOffsets();
+
     for (size_t i = 0; i < m_azLetters.size(); i++) {
         if (!m_azLetters[i]) continue;
         bool cur = (kAzLetters[i] == m_currentAzLetter);
@@ -1138,6 +1535,7 @@ void LibrarySectionTab::showAllItems() {
     m_contentGrid->setVisibility(brls::Visibility::VISIBLE);
     m_contentGrid->setDataSource(m_items);
     m_contentGrid->setHasMore(m_pageOffset < (size_t)m_totalItemCount);
+    m_contentGrid->setHasLess(m_windowStart > 0);
     updateViewModeButtons();
 }
 
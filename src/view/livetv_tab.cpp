@@ -17,6 +17,7 @@
 #include "platform/platform.hpp"
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <ctime>
 
 // Forward declarations for the patched nanovg batch text API. The
@@ -32,13 +33,78 @@ extern "C" {
 namespace vitaplex {
 
 // ============================================================================
-// GuideBox
+// GuideRow / GuideCell / GuidePrograms / GuideBox
 // ============================================================================
+// The guide is virtualized (see LiveTVTab::m_guideSlots): rows are pooled
+// and absolutely positioned at channel * rowHeight, and each row's program
+// cells are pooled and absolutely positioned at their start time. Child
+// order therefore says nothing about channel or time order, so the views
+// carry the index they are bound to and navigation goes by that instead.
+class GuideRow : public brls::Box {
+public:
+    int channel = -1;   // index into LiveTVTab::m_channels, -1 = free slot
+};
+
+class GuideCell : public brls::Box {
+public:
+    int model = -1;     // index into the row's GuideRowModel::cells, -1 = unbound
+};
+
+// A row's program track. LEFT/RIGHT step to the bound cell with the
+// adjacent model index; updateGuideWindow() keeps the focused cell's
+// neighbours bound even when a long program pushes them past the window.
+class GuidePrograms : public brls::Box {
+public:
+    brls::View* getNextFocus(brls::FocusDirection direction,
+                             brls::View* currentView) override {
+        if (direction != brls::FocusDirection::LEFT &&
+            direction != brls::FocusDirection::RIGHT)
+            return nullptr;
+        auto* cur = dynamic_cast<GuideCell*>(currentView);
+        if (!cur || cur->model < 0) return nullptr;
+        const bool right = direction == brls::FocusDirection::RIGHT;
+        GuideCell* best = nullptr;
+        for (brls::View* child : getChildren()) {
+            auto* c = dynamic_cast<GuideCell*>(child);
+            if (!isBound(c) || c == cur) continue;
+            if (right ? c->model <= cur->model : c->model >= cur->model) continue;
+            if (!best || (right ? c->model < best->model : c->model > best->model))
+                best = c;
+        }
+        return best;
+    }
+
+    // RIGHT from the channel column: the first cell still (partly) inside
+    // the scroll viewport, not whichever pooled cell happens to be first.
+    brls::View* getDefaultFocus() override {
+        brls::View* viewport = getParent();
+        const float left = viewport ? viewport->getX() : 0.0f;
+        GuideCell* onScreen = nullptr;
+        GuideCell* any = nullptr;
+        for (brls::View* child : getChildren()) {
+            auto* c = dynamic_cast<GuideCell*>(child);
+            if (!isBound(c)) continue;
+            if (!any || c->model < any->model) any = c;
+            if (c->getX() + c->getWidth() > left + 1.0f &&
+                (!onScreen || c->model < onScreen->model))
+                onScreen = c;
+        }
+        return onScreen ? onScreen : any;
+    }
+
+private:
+    static bool isBound(GuideCell* c) {
+        return c && c->model >= 0 && c->isFocusable() &&
+               c->getVisibility() != brls::Visibility::GONE;
+    }
+};
+
 // borealis' default Box::getNextFocus for a COLUMN box just walks to the
 // next sibling and calls getDefaultFocus on it. For our EPG rows that
 // always lands on the row's first focusable view — the channel-logo
 // column — instead of the program cell that aligns with the one the
-// user came from.
+// user came from (and with pooled rows, the next sibling isn't even the
+// next channel).
 //
 // Match by the *start* of the source's box: walk the adjacent row for a
 // focusable view whose horizontal range contains source.getX(). That
@@ -47,8 +113,11 @@ namespace vitaplex {
 // 30-min cell), instead of bouncing onto the second when the source's
 // centre happens to land on the cell boundary. Fall back to matching
 // by the source's *end* X so a source that begins inside a gap still
-// finds a target whose end aligns. Walks further rows on visibility
-// gaps so the navigation doesn't dead-end on culled or empty rows.
+// finds a target whose end aligns. Both probes are clamped to the
+// source row's scroll viewport: a long program can start far off-screen,
+// where the target row has no bound cells. Walks further rows on
+// visibility gaps so the navigation doesn't dead-end on culled or empty
+// rows.
 class GuideBox : public brls::Box {
 public:
     brls::View* getNextFocus(brls::FocusDirection direction,
@@ -57,40 +126,53 @@ public:
             direction == brls::FocusDirection::UP) {
             brls::View* row = currentView;
             while (row && row->getParent() != this) row = row->getParent();
-            if (row) {
-                auto& kids = getChildren();
-                int idx = -1;
-                for (int i = 0; i < (int)kids.size(); i++) {
-                    if (kids[i] == row) { idx = i; break; }
-                }
-                int step = (direction == brls::FocusDirection::DOWN) ? 1 : -1;
-                int targetIdx = idx + step;
+            auto* guideRow = dynamic_cast<GuideRow*>(row);
+            if (guideRow && guideRow->channel >= 0) {
+                const int step = (direction == brls::FocusDirection::DOWN) ? 1 : -1;
                 // `currentView` is whatever bubbled up the focus chain
                 // (a rowBox or programsBox), not the actually-focused
                 // leaf cell. Probe by the real focused view so the X
                 // range matches the cell the user *sees* highlighted.
                 brls::View* focused = brls::Application::getCurrentFocus();
                 if (!focused) focused = currentView;
+                float lo = -1e9f, hi = 1e9f;
+                for (brls::View* v = focused->getParent(); v && v != row; v = v->getParent()) {
+                    if (dynamic_cast<brls::HScrollingFrame*>(v)) {
+                        lo = v->getX();
+                        hi = lo + v->getWidth() - 0.5f;
+                        break;
+                    }
+                }
                 // Use a small epsilon-back from the source's right edge so a
                 // box ending at exactly 440 looks at 439 (which falls inside
                 // a target cell of [320, 440)) instead of 440 (which is the
                 // start of the next cell).
-                const float sourceStart = focused->getX();
-                const float sourceEnd   = sourceStart + focused->getWidth() - 0.5f;
-                while (idx >= 0 && targetIdx >= 0 && targetIdx < (int)kids.size()) {
-                    brls::View* targetRow = kids[targetIdx];
+                const float sourceStart = std::min(std::max(focused->getX(), lo), hi);
+                const float sourceEnd   = std::min(std::max(focused->getX() + focused->getWidth() - 0.5f, lo), hi);
+                for (int target = guideRow->channel + step; ; target += step) {
+                    GuideRow* targetRow = rowForChannel(target);
+                    if (!targetRow) break;  // edge of the guide or of the bound window
                     if (targetRow->getVisibility() == brls::Visibility::VISIBLE) {
                         if (brls::View* hit = findFocusableContainingX(targetRow, sourceStart)) return hit;
                         if (brls::View* hit = findFocusableContainingX(targetRow, sourceEnd))   return hit;
                     }
-                    targetIdx += step;
                 }
+                return nullptr;
             }
         }
         return brls::Box::getNextFocus(direction, currentView);
     }
 
 private:
+    GuideRow* rowForChannel(int channel) {
+        if (channel < 0) return nullptr;
+        for (brls::View* child : getChildren()) {
+            auto* r = dynamic_cast<GuideRow*>(child);
+            if (r && r->channel == channel) return r;
+        }
+        return nullptr;
+    }
+
     // Return the first focusable descendant of `root` whose horizontal
     // range [X, X+W) contains the probe X.
     static brls::View* findFocusableContainingX(brls::View* root, float x) {
@@ -175,22 +257,18 @@ static inline int livetvChannelColWidth() {
 static const int64_t FULL_RELOAD_INTERVAL = 300;   // 5 minutes between full EPG reloads
 static const int64_t REFRESH_INTERVAL = 60;         // 1 minute between "now playing" refreshes
 
-// Progressive guide build (buildEPGGrid / appendGuideRow /
-// scheduleGuideRowChunk): only the first screenful of rows is built
-// synchronously so the guide paints in ~1.5-2s on Vita; the remaining
-// rows append in small brls::sync chunks with a frame rendered between
-// each, instead of one ~6s blocking build of the full ~40-row grid.
-static const int kInitialRows  = 9;   // rows built before first paint (~one Vita screenful)
-// One row per chunk: a row costs ~160ms on Vita, and the first hardware
-// log with 4-row chunks showed ~650ms UI stalls that dropped the guide
-// to ~1.5fps while streaming and starved the logo loader's UI-thread
-// callbacks (logo latency 4.5s vs ~1s). Same total build time either
-// way — smaller chunks just leave a frame's worth of air between rows.
-static const int kRowsPerChunk = 1;   // rows appended per chained brls::sync chunk
-
-// EPG grid render window. Each row's program cells now sit inside an
+// Virtualized guide (buildEPGGrid / updateGuideWindow): rows are bound
+// for the vertical viewport plus kGuideRowMargin channels either side —
+// enough for a dpad step plus the CENTERED scroll animation that follows
+// it. Before the first layout reports the viewport height, kInitialRows
+// (~one Vita screenful) are bound instead. Cells are bound for one track
+// width either side of the visible time range.
+static const int kGuideRowMargin = 2;
+static const int kInitialRows    = 9;
+
+// EPG grid render window. Each row's program cells sit inside an
 // HScrollingFrame, so cells past the visible width are reachable via the
-// dpad (cf. m_rowProgramScrolls). The render path uses whatever window
+// dpad (cf. GuideRowSlot::scroll). The render path uses whatever window
 // LiveTVTab::m_hoursToShow holds — seeded from Application::getSettings()
 // .liveTvGuideHours, which is clamped to 1-48 on load.
 
@@ -220,20 +298,15 @@ static bool                 s_profFirstDrawPending = false;
 static std::atomic<int>     s_profLogoQueued{0};
 static std::atomic<int>     s_profLogoDone{0};
 static std::atomic<int64_t> s_profLogoLatencyUs{0};
-// formatTime() cost (localtime+strftime per call — a suspect for the row
-// build: ~500 cells x 2+ calls). Reset per buildEPGGrid.
+// formatTime() cost (localtime+strftime per call — now paid only for
+// rows as they are first bound). Reset per buildEPGGrid.
 static std::atomic<int64_t> s_profFmtUs{0};
 static std::atomic<int>     s_profFmtCalls{0};
-// Row-build phase accumulators: channel column (incl. logo entry),
-// program cells, per-row attach — plus the cell-body micro-split
-// (box/data/wire/add). File-scope rather than loop-local because the
-// progressive build spreads the row loop across brls::sync chunks:
-// buildEPGGrid() zeroes them, appendGuideRow() accumulates, and the
-// final chunk logs the totals. Only ever touched on the UI thread
-// (buildEPGGrid and the chunks both run there), so no atomics needed.
-static int64_t s_profColUs = 0, s_profCellsUs = 0, s_profAttachUs = 0;
-static int64_t s_profCellBoxUs = 0, s_profCellDataUs = 0;
-static int64_t s_profCellWireUs = 0, s_profCellAddUs = 0;
+// Guide window rebinds: rows / cells rebound and time spent, logged with
+// the periodic perf line. UI thread only.
+static int     s_profRowBinds  = 0;
+static int     s_profCellBinds = 0;
+static int64_t s_profBindUs    = 0;
 
 LiveTVTab::LiveTVTab() {
     const int64_t profCtor0 = brls::getCPUTimeUsec();
@@ -347,6 +420,10 @@ LiveTVTab::LiveTVTab() {
     // hero stays pinned at the top and only the guide scrolls.
     this->addView(m_scrollContent);
 
+    TabSnapshot snapshot;
+    if (s_snapshots.take("livetv", snapshot))
+        m_restoreTopChannel = snapshot.topChannel;
+
     brls::Logger::debug("LiveTVTab: Loading content...");
     brls::Logger::info("LTVPROF LiveTVTab ctor (shell views): {}ms",
                        (brls::getCPUTimeUsec() - profCtor0) / 1000);
@@ -356,9 +433,23 @@ LiveTVTab::LiveTVTab() {
 LiveTVTab::~LiveTVTab() {
     if (m_alive) { *m_alive = false; }
     if (m_heroThumbAlive) { m_heroThumbAlive->store(false); }
+    for (GuideRowSlot& slot : m_guideSlots)
+        if (slot.logoAlive) slot.logoAlive->store(false);
 }
 
+// See TabSnapshot. One Live TV tab, so one key.
+TabStateCache<LiveTVTab::TabSnapshot> LiveTVTab::s_snapshots;
+
 void LiveTVTab::willDisappear(bool resetState) {
+    // Read the guide scroll while the tree is intact; if the guide never got
+    // built this visit, keep whatever position was still pending.
+    TabSnapshot snapshot;
+    if (!m_rowModels.empty() && m_guideScrollV)
+        snapshot.topChannel = (int)(m_guideScrollV->getContentOffsetY() / livetvRowHeight());
+    else if (m_restoreTopChannel > 0)
+        snapshot.topChannel = m_restoreTopChannel;
+    s_snapshots.put("livetv", snapshot);
+
     brls::Box::willDisappear(resetState);
     if (m_alive) *m_alive = false;
     if (m_heroThumbAlive) m_heroThumbAlive->store(false);
@@ -406,16 +497,15 @@ brls::View* LiveTVTab::findLastFocusableInBox(brls::Box* box) {
 
 brls::View* LiveTVTab::getNextFocus(brls::FocusDirection direction, brls::View* currentView) {
     // Section layout (top to bottom):  Hero (m_heroBox) -> Guide (m_guideBox)
-    // Row-to-row movement *inside* the guide is handled by borealis' natural
-    // navigation (m_guideBox is a COLUMN box, so it resolves UP/DOWN between
-    // rows itself). This override only kicks in when that bubbles up to the
-    // tab — i.e. at a section boundary — so all we do is hop to the adjacent
-    // section.
+    // Row-to-row movement *inside* the guide is handled by GuideBox, which
+    // resolves UP/DOWN between channel rows itself. This override only kicks
+    // in when that bubbles up to the tab — i.e. at a section boundary — so
+    // all we do is hop to the adjacent section.
     const bool inHero  = isDescendantOf(currentView, m_heroBox);
     const bool inGuide = isDescendantOf(currentView, m_guideContainer);
 
     if (direction == brls::FocusDirection::DOWN && inHero) {
-        if (brls::View* t = findFirstFocusableInBox(m_guideBox)) return t;
+        if (brls::View* t = firstVisibleGuideFocus()) return t;
     }
     else if (direction == brls::FocusDirection::UP && inGuide) {
         if (brls::View* t = findFirstFocusableInBox(m_heroBox)) return t;
@@ -436,6 +526,9 @@ void LiveTVTab::cullToViewport(brls::Box* content, brls::View* viewport, bool ve
     brls::View* focus = brls::Application::getCurrentFocus();
 
     for (brls::View* child : content->getChildren()) {
+        // Pooled guide views parked GONE are unbound — leave them be.
+        if (child->getVisibility() == brls::Visibility::GONE) continue;
+
         const float cStart = vertical ? child->getY() : child->getX();
         const float cEnd   = cStart + (vertical ? child->getHeight() : child->getWidth());
 
@@ -457,25 +550,23 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
     if (m_perfLastFrameUs > 0) m_perfFrameUs += pf0 - m_perfLastFrameUs;
     m_perfLastFrameUs = pf0;
 
-    // With 100+ channels the EPG grid holds ~100 rows and the favourites /
-    // DVR rows hold ~100 cards each. borealis only culls off-screen *leaf*
-    // views, never nested Boxes, so every off-screen row/card still painted
-    // every frame — pure overdraw. Toggle INVISIBLE on anything scrolled
-    // out of its viewport so frame() early-outs for the entire subtree.
+    // Rebind the row / cell pools to whatever scrolled into range since
+    // last frame (usually a no-op — only discrete scroll steps rebind).
+    updateGuideWindow();
+
+    // The bound window keeps a margin of rows and cells past each edge of
+    // the viewport. borealis only culls off-screen *leaf* views, never
+    // nested Boxes, so those margin rows would still paint every frame —
+    // toggle INVISIBLE on anything scrolled out of its viewport so frame()
+    // early-outs for the entire subtree.
     cullToViewport(m_guideBox, m_guideScrollV, /*vertical=*/true);
 
     // Same idea horizontally, inside the rows that survived the vertical
-    // cull: a row spans the whole guide window (~15-25 cell Boxes) but only
-    // ~5 cells are on screen. The HScrollingFrame scissor only hides the
-    // result — every off-screen cell still recorded its rounded-rect
-    // background each frame.
-    for (size_t i = 0; i < m_rowProgramScrolls.size() && i < m_rowProgramBoxes.size(); i++) {
-        brls::HScrollingFrame* hs = m_rowProgramScrolls[i];
-        brls::Box* content = m_rowProgramBoxes[i];
-        if (!hs || !content) continue;
-        brls::View* row = hs->getParent();
-        if (row && row->getVisibility() != brls::Visibility::VISIBLE) continue;
-        cullToViewport(content, hs, /*vertical=*/false);
+    // cull. The HScrollingFrame scissor only hides the result — every
+    // off-screen cell would still record its rounded-rect background.
+    for (GuideRowSlot& slot : m_guideSlots) {
+        if (!slot.attached || slot.row->getVisibility() != brls::Visibility::VISIBLE) continue;
+        cullToViewport(slot.programs, slot.scroll, /*vertical=*/false);
     }
 
     // The time header rides its own HScrollingFrame with 2-4x more slot
@@ -483,15 +574,20 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
     if (m_timeHeaderBox && m_timeHeaderScroll)
         cullToViewport(m_timeHeaderBox, m_timeHeaderScroll, /*vertical=*/false);
 
-    // Lazy logo loading: request each channel's logo the first time its row
-    // survives the cull above. O(rows) flag checks per frame.
-    for (RowLogo& rl : m_rowLogos) {
-        if (rl.requested || !rl.row || !rl.img) continue;
-        if (rl.row->getVisibility() != brls::Visibility::VISIBLE) continue;
-        rl.requested = true;
+    // Lazy logo loading: request a bound row's channel logo the first time
+    // it survives the cull above, so the build does zero image work and
+    // channels that never scroll into view never fetch at all.
+    for (GuideRowSlot& slot : m_guideSlots) {
+        if (slot.logoRequested || slot.channel < 0 || !slot.attached) continue;
+        if (slot.row->getVisibility() != brls::Visibility::VISIBLE) continue;
+        slot.logoRequested = true;
+        const LiveTVChannel& channel = m_channels[slot.channel];
+        if (channel.thumb.empty()) continue;
+        const std::string url = PlexClient::getInstance().getThumbnailUrl(
+            channel.thumb, gridChannelLogoWidth() * 2, gridChannelLogoHeight() * 2);
         s_profLogoQueued.fetch_add(1);
         const int64_t profQ0 = brls::getCPUTimeUsec();
-        ImageLoader::loadAsync(rl.url, [profQ0](brls::Image* img) {
+        ImageLoader::loadAsync(url, [profQ0](brls::Image* img) {
             if (img) img->setVisibility(brls::Visibility::VISIBLE);
             const int done = s_profLogoDone.fetch_add(1) + 1;
             s_profLogoLatencyUs.fetch_add(brls::getCPUTimeUsec() - profQ0);
@@ -500,7 +596,7 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
                 brls::Logger::info("LTVPROF logos: {}/{} loaded, avg {}ms each",
                                    done, queued,
                                    s_profLogoLatencyUs.load() / done / 1000);
-        }, rl.img, m_logoAlive);
+        }, slot.logo, slot.logoAlive);
     }
 
     const int64_t pf1 = brls::getCPUTimeUsec();
@@ -517,12 +613,12 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
     // focused row's offset so the visible time slice is consistent
     // across the whole guide — and so the time labels above always
     // align with the cells below.
-    if (!m_rowProgramScrolls.empty()) {
+    if (!m_guideSlots.empty()) {
         brls::View* focused = brls::Application::getCurrentFocus();
         brls::HScrollingFrame* anchor = nullptr;
         if (focused) {
-            for (brls::HScrollingFrame* hs : m_rowProgramScrolls) {
-                if (isDescendantOf(focused, hs)) { anchor = hs; break; }
+            for (const GuideRowSlot& slot : m_guideSlots) {
+                if (slot.attached && isDescendantOf(focused, slot.scroll)) { anchor = slot.scroll; break; }
             }
         }
         if (anchor) {
@@ -546,20 +642,16 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
                 // borealis applies scroll offsets internally (see
                 // HScrollingFrame::scrollAnimationTick). The previous
                 // setContentOffsetX path ran invalidate() per row, i.e. a
-                // full-tree Yoga relayout of the ~1500-view grid PER ROW
-                // PER FRAME while the anchor's scroll animated — the
-                // guide's 4 FPS on Vita.
-                for (size_t i = 0; i < m_rowProgramScrolls.size(); i++) {
-                    brls::HScrollingFrame* hs = m_rowProgramScrolls[i];
-                    brls::Box* content = i < m_rowProgramBoxes.size() ? m_rowProgramBoxes[i] : nullptr;
-                    if (!hs || !content || hs == anchor) continue;
-                    // Clamp to this row's own scrollable range, like
-                    // borealis does — rows whose programs end early have
-                    // narrower content than the full guide window.
-                    float limit = content->getWidth() - hs->getWidth();
+                // full-tree Yoga relayout of the whole grid PER ROW PER
+                // FRAME while the anchor's scroll animated — the guide's
+                // 4 FPS on Vita.
+                for (GuideRowSlot& slot : m_guideSlots) {
+                    if (!slot.attached || slot.scroll == anchor) continue;
+                    // Clamp to the row's scrollable range, like borealis does.
+                    float limit = slot.programs->getWidth() - slot.scroll->getWidth();
                     if (limit < 0) limit = 0;
                     float t = target < 0 ? 0 : (target > limit ? limit : target);
-                    content->setTranslationX(-t);
+                    slot.programs->setTranslationX(-t);
                 }
                 if (m_timeHeaderBox && m_timeHeaderScroll) {
                     float limit = m_timeHeaderBox->getWidth() - m_timeHeaderScroll->getWidth();
@@ -589,23 +681,23 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
     // 2 batched ones. No path fills may happen between Begin and End or
     // they'd clobber the batch — only nvgText.
     [&]() {
-        if (m_epgRowRanges.empty() || m_epgCells.empty() || !m_guideScrollV) return;
+        if (m_guideSlots.empty() || !m_guideScrollV) return;
         const float vScrollTop    = m_guideScrollV->getY();
         const float vScrollBottom = vScrollTop + m_guideScrollV->getHeight();
 
         // All HScrollingFrames live in the same column (channel column
-        // is fixed-width on the left), so any cell's scroll frame gives
-        // the program-area X range. Pick the first cell whose scroll
-        // frame is laid out and use it to clip the batch — without the
-        // scissor, cells panning under the channel column would still
-        // paint their text on top of the logo because batched draws
-        // bypass the per-frame scissor that the HScrollingFrame sets.
+        // is fixed-width on the left), so any row's scroll frame gives
+        // the program-area X range. Pick the first one that is laid out
+        // and use it to clip the batch — without the scissor, cells
+        // panning under the channel column would still paint their text
+        // on top of the logo because batched draws bypass the per-frame
+        // scissor that the HScrollingFrame sets.
         float clipX = 0.0f, clipW = 0.0f;
-        for (const EpgCellInfo& info : m_epgCells) {
-            if (!info.scroll) continue;
-            const float w = info.scroll->getWidth();
+        for (const GuideRowSlot& slot : m_guideSlots) {
+            if (!slot.attached) continue;
+            const float w = slot.scroll->getWidth();
             if (w <= 0) continue;
-            clipX = info.scroll->getX();
+            clipX = slot.scroll->getX();
             clipW = w;
             break;
         }
@@ -622,56 +714,55 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
             const std::string* subtitle;
         };
         std::vector<VisibleCell> visible;
-        visible.reserve(m_epgCells.size());
+        visible.reserve(64);
 
         // Subtitles (time ranges) render only for the FOCUSED row: LTVPROF
         // measured the batched text pass at ~15.6ms/frame while navigating,
         // roughly half of it the time-range line under every visible cell.
         // Titles stay on every cell; the hero shows full times for the
         // focused program anyway.
-        brls::Box* focusedRowBox = nullptr;
+        const GuideRowSlot* focusedSlot = nullptr;
         {
             brls::View* fc = brls::Application::getCurrentFocus();
             if (fc) {
-                for (const EpgRowRange& rr : m_epgRowRanges) {
-                    if (rr.row && isDescendantOf(fc, rr.row)) { focusedRowBox = rr.row; break; }
+                for (const GuideRowSlot& slot : m_guideSlots) {
+                    if (slot.attached && isDescendantOf(fc, slot.row)) { focusedSlot = &slot; break; }
                 }
             }
         }
         static const std::string kNoSubtitle;
 
-        for (const EpgRowRange& rr : m_epgRowRanges) {
-            // One visibility check skips a culled row's entire cell range —
-            // previously every cell struct in the grid (channels × programs,
-            // easily >1000 entries) was walked per frame just to find the
-            // on-screen handful.
-            if (rr.row && rr.row->getVisibility() != brls::Visibility::VISIBLE) continue;
-            for (size_t ci = rr.begin; ci < rr.end && ci < m_epgCells.size(); ci++) {
-            const EpgCellInfo& info = m_epgCells[ci];
-            if (!info.cell || !info.scroll) continue;
+        for (const GuideRowSlot& slot : m_guideSlots) {
+            // One visibility check skips a culled row's cells outright.
+            if (!slot.attached || slot.channel < 0) continue;
+            if (slot.row->getVisibility() != brls::Visibility::VISIBLE) continue;
+            const GuideRowModel& rm = m_rowModels[slot.channel];
+            const float hScrollLeft  = slot.scroll->getX();
+            const float hScrollRight = hScrollLeft + slot.scroll->getWidth();
+            for (brls::Box* cellView : slot.cells) {
+            auto* cell = static_cast<GuideCell*>(cellView);
+            if (cell->model < 0 || cell->model >= (int)rm.cells.size()) continue;
             // Horizontally-culled cells are INVISIBLE (cell cull above) —
             // skip before paying the recursive position getters.
-            if (info.cell->getVisibility() != brls::Visibility::VISIBLE) continue;
+            if (cell->getVisibility() != brls::Visibility::VISIBLE) continue;
 
-            const float cx = info.cell->getX();
-            const float cy = info.cell->getY();
-            const float cw = info.cell->getWidth();
-            const float ch = info.cell->getHeight();
+            const float cx = cell->getX();
+            const float cy = cell->getY();
+            const float cw = cell->getWidth();
+            const float ch = cell->getHeight();
             if (cw <= 0 || ch <= 0) continue;
 
-            const float hScrollLeft  = info.scroll->getX();
-            const float hScrollRight = hScrollLeft + info.scroll->getWidth();
             if (cx + cw < hScrollLeft || cx > hScrollRight) continue;
             if (cy + ch < vScrollTop  || cy > vScrollBottom) continue;
 
+            const GuideCellModel& m = rm.cells[cell->model];
             VisibleCell v;
             v.x = cx; v.y = cy; v.w = cw; v.h = ch;
             v.tx = cx + 8.0f;
             v.ty = cy + (ch - 26.0f) * 0.5f;
-            v.onNow    = info.onNow;
-            v.title    = &info.title;
-            v.subtitle = (rr.row && rr.row == focusedRowBox) ? &info.subtitle
-                                                             : &kNoSubtitle;
+            v.onNow    = m.onNow;
+            v.title    = &m.title;
+            v.subtitle = (&slot == focusedSlot) ? &m.subtitle : &kNoSubtitle;
             visible.push_back(v);
             }
         }
@@ -763,13 +854,17 @@ void LiveTVTab::draw(NVGcontext* vg, float x, float y, float width, float height
 
     if (++m_perfFrames >= 300) {
         brls::Logger::info(
-            "LiveTV perf avg us/frame over {} frames: total={} cull={} sync={} boxdraw={} text={}",
+            "LiveTV perf avg us/frame over {} frames: total={} cull={} sync={} boxdraw={} text={} | "
+            "rebinds rows={} cells={} in {}us",
             m_perfFrames,
             m_perfFrameUs / m_perfFrames, m_perfCullUs / m_perfFrames,
             m_perfSyncUs / m_perfFrames, m_perfDrawUs / m_perfFrames,
-            m_perfTextUs / m_perfFrames);
+            m_perfTextUs / m_perfFrames,
+            s_profRowBinds, s_profCellBinds, (int)s_profBindUs);
         m_perfFrameUs = m_perfCullUs = m_perfSyncUs = m_perfDrawUs = m_perfTextUs = 0;
         m_perfFrames  = 0;
+        s_profRowBinds = s_profCellBinds = 0;
+        s_profBindUs   = 0;
     }
 }
 
@@ -1068,7 +1163,11 @@ void LiveTVTab::applyPendingHero() {
     // fetch per dpad press — dpad-repeat across the guide became a
     // relayout + network storm. Deferring to focus-rest keeps navigation
     // at full frame rate; the hero fills in the moment you stop.
-    if (brls::getCPUTimeUsec() - m_lastHoverUs < 180000) return;
+    if (brls::getCPUTimeUsec() - m_lastHoverUs < 180000) {
+        // Polled from draw(): ask for the frame that will apply it.
+        brls::Application::markDirty();
+        return;
+    }
     m_heroUpdatePending = false;
     const int64_t profH0 = brls::getCPUTimeUsec();
     if (m_pendingHeroHasProgram)
@@ -1380,39 +1479,94 @@ void LiveTVTab::updateCurrentTimeLine() {
         m_currentTimeLine->setVisibility(brls::Visibility::VISIBLE);
 }
 
-// Totals for the whole progressive build, logged once the LAST row is in
-// (or straight from buildEPGGrid when everything fit in the initial
-// batch). Same "rows split" / "cells split" / formatTime lines the old
-// monolithic build logged at its end — they only make sense once every
-// row has accumulated into the s_prof*Us counters.
-static void logGuideBuildComplete(size_t rows, size_t cells, int64_t buildStartUs) {
-    brls::Logger::info(
-        "LTVPROF progressive build complete: {} rows total in {}ms ({} cells)",
-        (int)rows, (brls::getCPUTimeUsec() - buildStartUs) / 1000, (int)cells);
-    brls::Logger::info(
-        "LTVPROF buildEPGGrid rows split: channelCol={}ms cells={}ms attach={}ms | "
-        "formatTime={}ms over {} calls",
-        s_profColUs / 1000, s_profCellsUs / 1000, s_profAttachUs / 1000,
-        s_profFmtUs.load() / 1000, s_profFmtCalls.load());
-    brls::Logger::info(
-        "LTVPROF cells split: box={}ms data={}ms wire={}ms add={}ms",
-        s_profCellBoxUs / 1000, s_profCellDataUs / 1000,
-        s_profCellWireUs / 1000, s_profCellAddUs / 1000);
+// Cell models for one channel, built the first time its row is bound. This
+// is all the string work (title truncation, two formatTime calls per cell)
+// the old up-front build paid for every channel before first paint.
+void LiveTVTab::ensureRowModel(int channel) {
+    GuideRowModel& rm = m_rowModels[channel];
+    if (rm.built) return;
+    rm.built = true;
+
+    const LiveTVChannel& ch = m_channels[channel];
+    const float slotW = (float)livetvTimeSlotWidth();
+    const int64_t guideEndTime = m_guideStartTime + (m_hoursToShow * 3600);
+    const int64_t nowSec = (int64_t)time(nullptr);
+
+    auto truncate = [](std::string title, float cellWidth) {
+        int maxChars = (int)cellWidth / 8;
+        if (maxChars < 4) maxChars = 4;
+        if ((int)title.length() > maxChars) title = title.substr(0, maxChars - 2) + "..";
+        return title;
+    };
+
+    if (!ch.programs.empty()) {
+        for (const auto& prog : ch.programs) {
+            if (prog.endTime <= m_guideStartTime || prog.startTime >= guideEndTime) continue;
+
+            int64_t visStart = std::max(prog.startTime, m_guideStartTime);
+            int64_t visEnd = std::min(prog.endTime > 0 ? prog.endTime : visStart + 1800, guideEndTime);
+
+            GuideCellModel m;
+            m.kind  = GuideCellModel::Kind::PROGRAM;
+            m.x     = (float)(visStart - m_guideStartTime) * slotW / 1800.0f;
+            m.w     = std::max(40.0f, (float)(visEnd - visStart) * slotW / 1800.0f);
+            m.onNow = (prog.startTime <= nowSec && prog.endTime > nowSec);
+            m.title = truncate(prog.title, m.w);
+            m.subtitle = formatTime(prog.startTime) + " – " + formatTime(prog.endTime);
+            if (m.onNow) m.subtitle += "  ·  on now";
+            m.program.title       = prog.title;
+            m.program.summary     = prog.summary;
+            m.program.startTime   = prog.startTime;
+            m.program.endTime     = prog.endTime;
+            m.program.ratingKey   = prog.ratingKey;
+            m.program.metadataKey = prog.metadataKey;
+            m.program.thumb       = prog.thumb;
+            rm.cells.push_back(std::move(m));
+        }
+    } else if (!ch.currentProgram.empty() && ch.programStart > 0) {
+        int64_t progStart = std::max(ch.programStart, m_guideStartTime);
+        int64_t progEnd = std::min(ch.programEnd > 0 ? ch.programEnd : progStart + 1800, guideEndTime);
+
+        // We don't have a full program struct here, so synthesize one from
+        // the channel fields for the hero.
+        GuideCellModel m;
+        m.kind  = GuideCellModel::Kind::LEGACY;
+        m.x     = (float)(progStart - m_guideStartTime) * slotW / 1800.0f;
+        m.w     = std::max(40.0f, (float)(progEnd - progStart) * slotW / 1800.0f);
+        m.onNow = true;
+        m.title = truncate(ch.currentProgram, m.w);
+        m.subtitle = formatTime(ch.programStart) + " – " + formatTime(ch.programEnd) + "  ·  on now";
+        m.program.title     = ch.currentProgram;
+        m.program.startTime = ch.programStart;
+        m.program.endTime   = ch.programEnd > 0 ? ch.programEnd : ch.programStart + 1800;
+        rm.cells.push_back(std::move(m));
+    }
+
+    // No programs inside the window: a placeholder that still tunes the
+    // channel, so every row has something to land on.
+    if (rm.cells.empty()) {
+        GuideCellModel m;
+        m.kind  = GuideCellModel::Kind::EMPTY;
+        m.x     = 0;
+        m.w     = slotW * 2;
+        m.title = "No guide data";
+        rm.cells.push_back(std::move(m));
+    }
 }
 
-// One guide row, built fully DETACHED — every child is assembled before
-// the single intoBox->addView(rowBox) at the end, so that attach is the
-// only live-tree work a row costs when the progressive chunks append
-// into the already-live m_guideBox. buildEPGGrid uses it too, with
-// intoBox = the orphan newGuideBox it swaps in afterwards.
-void LiveTVTab::appendGuideRow(const LiveTVChannel& channel, brls::Box* intoBox) {
-    const int gridHours = m_hoursToShow;
-
-    auto* rowBox = new brls::Box();
-    // Cells appended below belong to this row.
-    const size_t rowCellsBegin = m_epgCells.size();
-    const int64_t profRow0 = brls::getCPUTimeUsec();
+// One empty row shell: sticky channel column + HScrollingFrame around a
+// fixed-width program track. Built detached; bindGuideRow fills it in and
+// the caller attaches it. Click / hover handlers resolve the slot's
+// *current* binding when they fire, so rebinding never re-registers them.
+size_t LiveTVTab::createGuideSlot() {
+    const size_t slotIndex = m_guideSlots.size();
+    GuideRowSlot slot;
+
+    auto* rowBox = new GuideRow();
     rowBox->setAxis(brls::Axis::ROW);
+    rowBox->setPositionType(brls::PositionType::ABSOLUTE);
+    rowBox->setPositionLeft(0);
+    rowBox->setWidthPercentage(100.0f);
     rowBox->setHeight(livetvRowHeight());
     rowBox->setJustifyContent(brls::JustifyContent::FLEX_START);
     rowBox->setAlignItems(brls::AlignItems::CENTER);
@@ -1456,22 +1610,7 @@ void LiveTVTab::appendGuideRow(const LiveTVChannel& channel, brls::Box* intoBox)
     logoBox->addView(logo);
     channelCol->addView(logoBox);
 
-    if (!channel.thumb.empty()) {
-        // Deferred to draw(): the fetch fires the first time this row is
-        // visible (see the lazy-logo pass), so the build does zero image
-        // work and off-screen channels never fetch at all.
-        RowLogo rl;
-        rl.row = rowBox;
-        rl.img = logo;
-        rl.url = PlexClient::getInstance().getThumbnailUrl(
-            channel.thumb, logoW * 2, logoH * 2);
-        m_rowLogos.push_back(std::move(rl));
-    }
-
     auto* chNumLabel = new brls::Label();
-    chNumLabel->setText(!channel.channelIdentifier.empty()
-                        ? channel.channelIdentifier
-                        : std::to_string(channel.channelNumber));
     chNumLabel->setFontSize(11);
     // Channel number is body text in a long vertical list — keep
     // it muted so the gold accent stays reserved for fills,
@@ -1481,29 +1620,25 @@ void LiveTVTab::appendGuideRow(const LiveTVChannel& channel, brls::Box* intoBox)
     chNumLabel->setHorizontalAlign(brls::HorizontalAlign::CENTER);
     channelCol->addView(chNumLabel);
 
-    // ONE channel copy per row, shared by every lambda in the row.
-    // Capturing LiveTVChannel by value in each cell's click + hover
-    // lambdas deep-copied the channel AND its ~40-program vector
-    // (hundreds of string allocs) twice per cell — LTVPROF measured
-    // cells=7368ms of the guide-build freeze from exactly this.
-    auto capturedChannel = std::make_shared<const LiveTVChannel>(channel);
     channelCol->setFocusable(true);
-    channelCol->registerClickAction([this, capturedChannel](brls::View*) {
-        onChannelSelected(*capturedChannel);
+    channelCol->registerClickAction([this, slotIndex](brls::View*) {
+        const int ch = m_guideSlots[slotIndex].channel;
+        if (ch >= 0 && ch < (int)m_channels.size()) {
+            LiveTVChannel channel = m_channels[ch];
+            onChannelSelected(channel);
+        }
         return true;
     });
     channelCol->addGestureRecognizer(new brls::TapGestureRecognizer(channelCol));
     // Hover on the channel column shows the channel's current show
     // in the hero — keeps the preview in sync as the user scrolls
     // through the channel list with the dpad.
-    channelCol->getFocusEvent()->subscribe(
-        [this, capturedChannel](brls::View*) {
-            queueHeroForChannel(*capturedChannel);
-        });
-
+    channelCol->getFocusEvent()->subscribe([this, slotIndex](brls::View*) {
+        const int ch = m_guideSlots[slotIndex].channel;
+        if (ch >= 0 && ch < (int)m_channels.size())
+            queueHeroForChannel(m_channels[ch]);
+    });
     rowBox->addView(channelCol);
-    const int64_t profRow1 = brls::getCPUTimeUsec();
-    s_profColUs += profRow1 - profRow0;
 
     // Program cells live inside their own HScrollingFrame so RIGHT
     // arrow can pan past the visible width and bring later shows
@@ -1515,282 +1650,438 @@ void LiveTVTab::appendGuideRow(const LiveTVChannel& channel, brls::Box* intoBox)
     // stretch the scroll frame to fill the row's cross axis, and
     // HScrollingFrame::setContentView wires contentView.height to
     // self.height — without setHeight here the scroll collapses
-    // to ~0 high, the contentView follows, and the cells inside
-    // end up with no layout slot for their labels (text invisible,
-    // cell margins gone, focus highlight floats half a row down).
+    // to ~0 high and the cells inside end up with no layout slot.
     auto* programsScroll = new brls::HScrollingFrame();
     programsScroll->setGrow(1.0f);
     programsScroll->setHeight(livetvRowHeight());
     programsScroll->setScrollingBehavior(brls::ScrollingBehavior::CENTERED);
     programsScroll->setFocusable(false);
 
-    auto* programsBox = new brls::Box();
-    programsBox->setAxis(brls::Axis::ROW);
-    programsBox->setJustifyContent(brls::JustifyContent::FLEX_START);
-    programsBox->setAlignItems(brls::AlignItems::CENTER);
+    // Fixed-width track spanning the whole guide window; cells sit at
+    // their start time, so the track (and the scroll range) is identical
+    // for every row whatever subset of cells is bound.
+    auto* programsBox = new GuidePrograms();
+    programsBox->setWidth((float)(m_hoursToShow * 2 * livetvTimeSlotWidth()));
+    programsScroll->setContentView(programsBox);
+    rowBox->addView(programsScroll);
 
-    if (!channel.programs.empty()) {
-        int64_t guideEndTime = m_guideStartTime + (gridHours * 3600);
-        int64_t lastEndTime = m_guideStartTime;
+    slot.row        = rowBox;
+    slot.channelCol = channelCol;
+    slot.logo       = logo;
+    slot.chNumLabel = chNumLabel;
+    slot.scroll     = programsScroll;
+    slot.programs   = programsBox;
+    m_guideSlots.push_back(std::move(slot));
+    return slotIndex;
+}
 
-        for (size_t pi = 0; pi < channel.programs.size(); pi++) {
-            const auto& prog = channel.programs[pi];
+void LiveTVTab::bindGuideRow(size_t slotIndex, int channel) {
+    GuideRowSlot& slot = m_guideSlots[slotIndex];
+    ensureRowModel(channel);
+    s_profRowBinds++;
+
+    slot.channel = channel;
+    static_cast<GuideRow*>(slot.row)->channel = channel;
+    slot.row->setPositionTop((float)(channel * livetvRowHeight()));
+
+    const LiveTVChannel& ch = m_channels[channel];
+    slot.chNumLabel->setText(!ch.channelIdentifier.empty()
+                             ? ch.channelIdentifier
+                             : std::to_string(ch.channelNumber));
+
+    // New channel, new logo: retire any fetch still in flight for the old
+    // one and let draw() request this channel's when the row is visible.
+    if (slot.logoAlive) slot.logoAlive->store(false);
+    slot.logoAlive = std::make_shared<std::atomic<bool>>(true);
+    slot.logoRequested = false;
+    if (slot.logo->getVisibility() != brls::Visibility::INVISIBLE)
+        slot.logo->setVisibility(brls::Visibility::INVISIBLE);
+
+    // A recycled scroll's internal offset is stale; force the anchor
+    // re-alignment in draw() if focus ever lands in it again.
+    if (m_lastAnchorScroll == slot.scroll) m_lastAnchorScroll = nullptr;
+
+    // Every cell binding belonged to the previous channel's models.
+    for (brls::Box* cell : slot.cells)
+        static_cast<GuideCell*>(cell)->model = -1;
+    bindGuideRowCells(slotIndex);
+}
 
-            if (prog.endTime <= m_guideStartTime || prog.startTime >= guideEndTime) continue;
+// Bind the slot's pooled cells to the programs overlapping the horizontal
+// window (one track width either side of m_boundWindowX), plus the
+// focused cell's neighbours. Cells already showing a wanted program keep
+// their binding — in particular the focused cell never moves — and spare
+// cells are parked GONE. Only new bindings touch Yoga.
+void LiveTVTab::bindGuideRowCells(size_t slotIndex) {
+    GuideRowSlot& slot = m_guideSlots[slotIndex];
+    if (slot.channel < 0) return;
+    const GuideRowModel& rm = m_rowModels[slot.channel];
+
+    const float trackW = guideTrackWidth();
+    const float base   = std::max(0.0f, m_boundWindowX);
+    const float winLo  = base - trackW;
+    const float winHi  = base + 2.0f * trackW;
+
+    // 0 = not wanted, 1 = wanted and unbound, 2 = wanted and already bound
+    std::vector<char> want(rm.cells.size(), 0);
+    for (size_t i = 0; i < rm.cells.size(); i++) {
+        const GuideCellModel& m = rm.cells[i];
+        if (m.x + m.w >= winLo && m.x <= winHi) want[i] = 1;
+    }
+    brls::View* focus = brls::Application::getCurrentFocus();
+    for (brls::Box* cellView : slot.cells) {
+        auto* cell = static_cast<GuideCell*>(cellView);
+        if (cellView != focus || cell->model < 0 || cell->model >= (int)want.size()) continue;
+        want[cell->model] = 1;
+        if (cell->model > 0) want[cell->model - 1] = 1;
+        if (cell->model + 1 < (int)want.size()) want[cell->model + 1] = 1;
+    }
 
-            int64_t visStart = std::max(prog.startTime, m_guideStartTime);
-            int64_t visEnd = std::min(prog.endTime > 0 ? prog.endTime : visStart + 1800, guideEndTime);
+    std::vector<GuideCell*> spare;
+    for (brls::Box* cellView : slot.cells) {
+        auto* cell = static_cast<GuideCell*>(cellView);
+        if (cell->model >= 0 && cell->model < (int)want.size() && want[cell->model])
+            want[cell->model] = 2;
+        else
+            spare.push_back(cell);
+    }
 
-            if (visStart > lastEndTime) {
-                int gapPixels = (int)((visStart - lastEndTime) * livetvTimeSlotWidth() / 1800);
-                if (gapPixels > 0) {
-                    auto* spacer = new brls::Box();
-                    spacer->setWidth(gapPixels);
-                    spacer->setHeight(livetvRowHeight() - 4);
-                    programsBox->addView(spacer);
-                }
-            }
+    size_t nextSpare = 0;
+    for (size_t i = 0; i < want.size(); i++) {
+        if (want[i] != 1) continue;
+        GuideCell* cell;
+        if (nextSpare < spare.size()) {
+            cell = spare[nextSpare++];
+        } else {
+            // Pool is short — grow it. Label-less: title, subtitle and
+            // background are painted batched in draw().
+            cell = new GuideCell();
+            cell->setPositionType(brls::PositionType::ABSOLUTE);
+            cell->setPositionTop(4);
+            cell->setHeight(livetvRowHeight() - 8);
+            cell->setCornerRadius(6);
+            cell->setHideHighlightBackground(true);  // ring comes from the
+                                                     // app highlight pass
+            cell->registerClickAction([this, slotIndex, cell](brls::View*) {
+                onGuideCellClicked(slotIndex, cell->model);
+                return true;
+            });
+            cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
+            // Hover → live-update the hero with this program's details.
+            // Watch live + Record buttons follow because they read from
+            // m_heroChannel / m_heroProgram.
+            cell->getFocusEvent()->subscribe([this, slotIndex, cell](brls::View*) {
+                onGuideCellFocused(slotIndex, cell->model);
+            });
+            slot.programs->addView(cell);
+            slot.cells.push_back(cell);
+        }
+        const GuideCellModel& m = rm.cells[i];
+        cell->model = (int)i;
+        // 2px gutter either side, so cells line up with the time header.
+        cell->setPositionLeft(m.x + 2.0f);
+        cell->setWidth(std::max(4.0f, m.w - 4.0f));
+        cell->setFocusable(true);
+        if (cell->getVisibility() == brls::Visibility::GONE)
+            cell->setVisibility(brls::Visibility::VISIBLE);
+        s_profCellBinds++;
+    }
 
-            int64_t durationSec = visEnd - visStart;
-            int cellWidth = (int)(durationSec * livetvTimeSlotWidth() / 1800);
-            if (cellWidth < 40) cellWidth = 40;
-
-            time_t nowSec = time(nullptr);
-            bool isCurrently = (prog.startTime <= (int64_t)nowSec && prog.endTime > (int64_t)nowSec);
-
-            const int64_t pc0 = brls::getCPUTimeUsec();
-            auto* progCell = new brls::Box();
-            progCell->setWidth(cellWidth);
-            progCell->setHeight(livetvRowHeight() - 8);
-            progCell->setMargins(2, 2, 2, 2);
-            // No per-cell background/border: each one is a separate
-            // stenciled antialiased NanoVG path — with ~50 cells visible
-            // the GPU sat at 100% (CPU half idle). draw() paints all
-            // visible cell rects as a few merged batched paths instead.
-            progCell->setCornerRadius(6);
-            progCell->setFocusable(true);
-            progCell->setHideHighlightBackground(true);  // ring comes from the
-                                                         // app highlight pass
-
-            // Cell is intentionally label-less — the title and
-            // time-range strings are batched in draw() through the
-            // patched nvgTextBatchBegin/End API so all visible cell
-            // text flushes as one render call per style instead of
-            // one per Label.
-            const int64_t pc1 = brls::getCPUTimeUsec();
-            EpgCellInfo info;
-            info.cell = progCell;
-            info.scroll = programsScroll;
-            info.row = rowBox;
-            info.onNow = isCurrently;
-            std::string title = prog.title;
-            int maxChars = cellWidth / 8;
-            if (maxChars < 4) maxChars = 4;
-            if ((int)title.length() > maxChars) title = title.substr(0, maxChars - 2) + "..";
-            info.title = std::move(title);
-            std::string sub = formatTime(prog.startTime) + " – " + formatTime(prog.endTime);
-            if (isCurrently) sub += "  ·  on now";
-            info.subtitle = std::move(sub);
-            m_epgCells.push_back(info);
-
-            // One shared copy of the program per cell — capturing
-            // GuideProgram by value in the click AND hover lambdas
-            // duplicated its strings (summary is a whole paragraph)
-            // twice more per cell.
-            auto gp = std::make_shared<const GuideProgram>();
-            {
-                auto* g = const_cast<GuideProgram*>(gp.get());
-                g->title = prog.title;
-                g->summary = prog.summary;
-                g->startTime = prog.startTime;
-                g->endTime = prog.endTime;
-                g->ratingKey = prog.ratingKey;
-                g->metadataKey = prog.metadataKey;
-                g->thumb = prog.thumb;
+    for (; nextSpare < spare.size(); nextSpare++) {
+        GuideCell* cell = spare[nextSpare];
+        if (cell->model < 0 && cell->getVisibility() == brls::Visibility::GONE) continue;
+        cell->model = -1;
+        cell->setFocusable(false);
+        cell->setVisibility(brls::Visibility::GONE);
+    }
+}
+
+// Time header slots for the same horizontal window as the cells.
+void LiveTVTab::bindTimeHeader() {
+    if (!m_timeHeaderBox) return;
+    const float slotW  = (float)livetvTimeSlotWidth();
+    const int   total  = m_hoursToShow * 2;
+    const float trackW = guideTrackWidth();
+    const float base   = std::max(0.0f, m_boundWindowX);
+    const int lo = std::max(0, (int)std::floor((base - trackW) / slotW));
+    const int hi = std::min(total - 1, (int)std::floor((base + 2.0f * trackW) / slotW));
+
+    std::vector<char> bound(hi >= lo ? hi - lo + 1 : 0, 0);
+    std::vector<size_t> spare;
+    for (size_t i = 0; i < m_timeSlots.size(); i++) {
+        const int idx = m_timeSlots[i].index;
+        if (idx >= lo && idx <= hi) bound[idx - lo] = 1;
+        else spare.push_back(i);
+    }
+
+    size_t nextSpare = 0;
+    for (int idx = lo; idx <= hi; idx++) {
+        if (bound[idx - lo]) continue;
+        size_t si;
+        if (nextSpare < spare.size()) {
+            si = spare[nextSpare++];
+        } else {
+            // Bold muted label, left hairline separating slots. borealis Box
+            // draws a uniform border; we want only a left hairline, so it's
+            // a thin absolute strip instead.
+            TimeSlotView ts;
+            ts.box = new brls::Box();
+            ts.box->setPositionType(brls::PositionType::ABSOLUTE);
+            ts.box->setPositionTop(0);
+            ts.box->setWidth(slotW);
+            ts.box->setHeight(TIME_HEADER_HEIGHT);
+            ts.box->setJustifyContent(brls::JustifyContent::CENTER);
+            ts.box->setAlignItems(brls::AlignItems::CENTER);
+
+            ts.rule = new brls::Box();
+            ts.rule->setPositionType(brls::PositionType::ABSOLUTE);
+            ts.rule->setWidth(1);
+            ts.rule->setHeight(TIME_HEADER_HEIGHT - 12);
+            ts.rule->setPositionLeft(0);
+            ts.rule->setPositionTop(6);
+            ts.rule->setBackgroundColor(tok::hairline());
+            ts.box->addView(ts.rule);
+
+            ts.label = new brls::Label();
+            ts.label->setFontSize(13);
+            ts.label->setTextColor(tok::muted());
+            ts.box->addView(ts.label);
+
+            m_timeHeaderBox->addView(ts.box);
+            si = m_timeSlots.size();
+            m_timeSlots.push_back(ts);
+        }
+        TimeSlotView& ts = m_timeSlots[si];
+        ts.index = idx;
+        ts.box->setPositionLeft(idx * slotW);
+        ts.label->setText(formatTime(m_guideStartTime + (int64_t)idx * 1800));
+        ts.rule->setVisibility(idx > 0 ? brls::Visibility::VISIBLE : brls::Visibility::INVISIBLE);
+        if (ts.box->getVisibility() == brls::Visibility::GONE)
+            ts.box->setVisibility(brls::Visibility::VISIBLE);
+    }
+
+    for (; nextSpare < spare.size(); nextSpare++) {
+        TimeSlotView& ts = m_timeSlots[spare[nextSpare]];
+        if (ts.index < 0) continue;
+        ts.index = -1;
+        ts.box->setVisibility(brls::Visibility::GONE);
+    }
+}
+
+// Rows are rebound while detached: every setter on a parentless row only
+// relayouts the row itself, leaving one full-tree relayout for the
+// re-attach (see buildEPGGrid for why per-setter relayouts on the live
+// tree hurt).
+void LiveTVTab::detachGuideRow(size_t slotIndex) {
+    GuideRowSlot& slot = m_guideSlots[slotIndex];
+    if (!slot.attached) return;
+    m_guideBox->removeView(slot.row, /*free=*/false);
+    slot.attached = false;
+}
+
+void LiveTVTab::attachGuideRow(size_t slotIndex) {
+    GuideRowSlot& slot = m_guideSlots[slotIndex];
+    if (slot.attached || !m_guideBox) return;
+    m_guideBox->addView(slot.row);
+    slot.attached = true;
+    // removeView reset the row's own scroll; put its content back on the
+    // offset every other row is showing.
+    const float target = std::max(0.0f, m_lastSyncedScrollX);
+    float limit = slot.programs->getWidth() - slot.scroll->getWidth();
+    if (limit < 0) limit = 0;
+    slot.programs->setTranslationX(-std::min(target, limit));
+}
+
+float LiveTVTab::guideTrackWidth() {
+    for (const GuideRowSlot& slot : m_guideSlots) {
+        if (slot.attached && slot.scroll->getWidth() > 1) return slot.scroll->getWidth();
+    }
+    if (m_guideScrollV && m_guideScrollV->getWidth() > livetvChannelColWidth())
+        return m_guideScrollV->getWidth() - livetvChannelColWidth();
+    return (float)(livetvTimeSlotWidth() * 6);  // pre-layout guess
+}
+
+void LiveTVTab::updateGuideWindow() {
+    if (!m_guideBox || !m_guideScrollV || m_channels.empty() ||
+        m_rowModels.size() != m_channels.size())
+        return;
+    const int64_t pb0 = brls::getCPUTimeUsec();
+
+    const float rowH = (float)livetvRowHeight();
+    const int n = (int)m_channels.size();
+    int first = 0;
+    int last  = kInitialRows - 1;
+    const float vpH = m_guideScrollV->getHeight();
+    if (vpH > 1) {
+        const float scrolled = m_guideScrollV->getY() - m_guideBox->getY();
+        first = (int)std::floor(scrolled / rowH) - kGuideRowMargin;
+        last  = (int)std::floor((scrolled + vpH) / rowH) + kGuideRowMargin;
+    }
+    first = std::max(0, first);
+    last  = std::min(n - 1, last);
+
+    brls::View* focus = brls::Application::getCurrentFocus();
+    int focusSlot = -1;
+    if (focus) {
+        for (size_t i = 0; i < m_guideSlots.size(); i++) {
+            if (m_guideSlots[i].attached && isDescendantOf(focus, m_guideSlots[i].row)) {
+                focusSlot = (int)i;
+                break;
             }
+        }
+    }
 
-            const int64_t pc2 = brls::getCPUTimeUsec();
-            progCell->registerClickAction([this, gp, capturedChannel](brls::View*) {
-                onProgramSelected(*gp, *capturedChannel);
-                return true;
-            });
-            progCell->addGestureRecognizer(new brls::TapGestureRecognizer(progCell));
-            // Hover → live-update the hero with this program's
-            // details (title, summary, thumb, progress, channel
-            // chrome). Watch live + Record buttons follow because
-            // they read from m_heroChannel / m_heroProgram.
-            progCell->getFocusEvent()->subscribe(
-                [this, gp, capturedChannel](brls::View*) {
-                    queueHeroForProgram(*capturedChannel, *gp);
-                });
-
-            const int64_t pc3 = brls::getCPUTimeUsec();
-            programsBox->addView(progCell);
-            const int64_t pc4 = brls::getCPUTimeUsec();
-            s_profCellBoxUs  += pc1 - pc0;
-            s_profCellDataUs += pc2 - pc1;
-            s_profCellWireUs += pc3 - pc2;
-            s_profCellAddUs  += pc4 - pc3;
-            lastEndTime = visEnd;
+    // Horizontal window: once the shared offset drifts half a track from
+    // where the cells were bound, rebind every row around the new offset.
+    const float trackW = guideTrackWidth();
+    const float offset = std::max(0.0f, m_lastSyncedScrollX);
+    const bool hShift  = m_boundWindowX < 0 || std::abs(offset - m_boundWindowX) > trackW * 0.5f;
+    if (hShift) m_boundWindowX = offset;
+
+    if (first != m_windowFirstRow || last != m_windowLastRow) {
+        m_windowFirstRow = first;
+        m_windowLastRow  = last;
+
+        // Slots already showing a channel in range stay put; the rest (never
+        // the focused row) are recycled onto the channels that lack one.
+        std::vector<char> covered(last - first + 1, 0);
+        std::vector<size_t> spare;
+        for (size_t i = 0; i < m_guideSlots.size(); i++) {
+            const int ch = m_guideSlots[i].channel;
+            if (ch >= first && ch <= last) covered[ch - first] = 1;
+            else if ((int)i != focusSlot) spare.push_back(i);
         }
-    } else if (!channel.currentProgram.empty() && channel.programStart > 0) {
-        int64_t progStart = std::max(channel.programStart, m_guideStartTime);
-        int64_t guideEndTime = m_guideStartTime + (gridHours * 3600);
-        int64_t progEnd = std::min(channel.programEnd > 0 ? channel.programEnd : progStart + 1800, guideEndTime);
-
-        int startOffset = (int)((progStart - m_guideStartTime) * livetvTimeSlotWidth() / 1800);
-        int cellWidth = (int)((progEnd - progStart) * livetvTimeSlotWidth() / 1800);
-        if (cellWidth < 40) cellWidth = 40;
-
-        if (startOffset > 0) {
-            auto* spacer = new brls::Box();
-            spacer->setWidth(startOffset);
-            spacer->setHeight(livetvRowHeight() - 4);
-            programsBox->addView(spacer);
+        size_t nextSpare = 0;
+        for (int ch = first; ch <= last; ch++) {
+            if (covered[ch - first]) continue;
+            size_t si;
+            if (nextSpare < spare.size()) {
+                si = spare[nextSpare++];
+                detachGuideRow(si);
+            } else {
+                si = createGuideSlot();
+            }
+            bindGuideRow(si, ch);
+            attachGuideRow(si);
         }
+    }
 
-        auto* progCell = new brls::Box();
-        progCell->setWidth(cellWidth);
-        progCell->setHeight(livetvRowHeight() - 8);
-        progCell->setMargins(2, 2, 2, 2);
-        // Background/border painted batched in draw() (see main loop).
-        progCell->setCornerRadius(6);
-        progCell->setFocusable(true);
-        progCell->setHideHighlightBackground(true);
-
-        // Label-less cell — text painted in batch by draw() via
-        // nvgTextBatchBegin/End. See the main loop above.
-        EpgCellInfo info;
-        info.cell = progCell;
-        info.scroll = programsScroll;
-        info.row = rowBox;
-        info.onNow = true;
-        std::string title = channel.currentProgram;
-        int maxChars = cellWidth / 8;
-        if (maxChars < 4) maxChars = 4;
-        if ((int)title.length() > maxChars) title = title.substr(0, maxChars - 2) + "..";
-        info.title = std::move(title);
-        info.subtitle = formatTime(channel.programStart) + " – " + formatTime(channel.programEnd) + "  ·  on now";
-        m_epgCells.push_back(info);
-
-        // Hover on the legacy fallback updates the hero with this
-        // channel's "now playing" — we don't have a full program
-        // struct here, so synthesize one from the channel fields.
-        GuideProgram legacyGp;
-        legacyGp.title     = channel.currentProgram;
-        legacyGp.startTime = channel.programStart;
-        legacyGp.endTime   = channel.programEnd > 0
-                              ? channel.programEnd
-                              : channel.programStart + 1800;
-        progCell->getFocusEvent()->subscribe(
-            [this, legacyGp, capturedChannel](brls::View*) {
-                queueHeroForProgram(*capturedChannel, legacyGp);
-            });
+    if (hShift) {
+        for (size_t i = 0; i < m_guideSlots.size(); i++) {
+            if (m_guideSlots[i].channel < 0) continue;
+            // The focused row stays attached — pulling it out of the tree
+            // would reset its scroll mid-animation.
+            const bool live = (int)i == focusSlot || !m_guideSlots[i].attached;
+            if (!live) detachGuideRow(i);
+            bindGuideRowCells(i);
+            if (!live) attachGuideRow(i);
+        }
+        bindTimeHeader();
+        m_boundFocus = focus;
+    } else if (focus != m_boundFocus) {
+        // Focus moved: make sure its neighbours are bound for LEFT/RIGHT.
+        // Usually they already are and this touches no views.
+        m_boundFocus = focus;
+        if (focusSlot >= 0) bindGuideRowCells((size_t)focusSlot);
+    }
 
-        programsBox->addView(progCell);
-    } else {
-        auto* emptyCell = new brls::Box();
-        emptyCell->setWidth(livetvTimeSlotWidth() * 2);
-        emptyCell->setHeight(livetvRowHeight() - 6);
-        emptyCell->setMargins(3, 3, 3, 3);
-        emptyCell->setBackgroundColor(tok::cardRaised());
-        emptyCell->setCornerRadius(7);
-        emptyCell->setFocusable(true);
-        emptyCell->setPadding(8);
-
-        auto* noInfo = new brls::Label();
-        noInfo->setText("No guide data");
-        noInfo->setFontSize(11);
-        noInfo->setTextColor(tok::dim());
-        emptyCell->addView(noInfo);
-
-        emptyCell->registerClickAction([this, capturedChannel](brls::View*) {
-            onChannelSelected(*capturedChannel);
-            return true;
-        });
-        emptyCell->addGestureRecognizer(new brls::TapGestureRecognizer(emptyCell));
-        // Hover on a no-data cell still updates the channel chrome
-        // on the hero so the user knows which channel they'd tune.
-        emptyCell->getFocusEvent()->subscribe(
-            [this, capturedChannel](brls::View*) {
-                queueHeroForChannel(*capturedChannel);
-            });
+    s_profBindUs += brls::getCPUTimeUsec() - pb0;
+}
 
-        programsBox->addView(emptyCell);
+brls::View* LiveTVTab::firstVisibleGuideFocus() {
+    const float vpTop = m_guideScrollV ? m_guideScrollV->getY() : 0.0f;
+    const float rowH  = (float)livetvRowHeight();
+    const GuideRowSlot* best = nullptr;
+    for (const GuideRowSlot& slot : m_guideSlots) {
+        if (!slot.attached || slot.channel < 0) continue;
+        if (slot.row->getVisibility() != brls::Visibility::VISIBLE) continue;
+        if (slot.row->getY() + rowH * 0.5f < vpTop) continue;  // mostly scrolled off
+        if (!best || slot.channel < best->channel) best = &slot;
     }
+    if (best) return findFirstFocusableInBox(best->row);
+    return findFirstFocusableInBox(m_guideBox);
+}
 
-    const int64_t profRow2 = brls::getCPUTimeUsec();
-    s_profCellsUs += profRow2 - profRow1;
-    programsScroll->setContentView(programsBox);
-    rowBox->addView(programsScroll);
-    m_rowProgramScrolls.push_back(programsScroll);
-    m_rowProgramBoxes.push_back(programsBox);
-    if (m_epgCells.size() > rowCellsBegin)
-        m_epgRowRanges.push_back({ rowBox, rowCellsBegin, m_epgCells.size() });
-    intoBox->addView(rowBox);
-    s_profAttachUs += brls::getCPUTimeUsec() - profRow2;
+void LiveTVTab::onGuideCellClicked(size_t slotIndex, int model) {
+    if (slotIndex >= m_guideSlots.size()) return;
+    const int ch = m_guideSlots[slotIndex].channel;
+    if (ch < 0 || ch >= (int)m_channels.size()) return;
+    if (model < 0 || model >= (int)m_rowModels[ch].cells.size()) return;
+
+    // Copies: selecting can kick off a reload that replaces both vectors.
+    const GuideCellModel& m = m_rowModels[ch].cells[model];
+    LiveTVChannel channel = m_channels[ch];
+    switch (m.kind) {
+        case GuideCellModel::Kind::PROGRAM: {
+            GuideProgram program = m.program;
+            onProgramSelected(program, channel);
+            break;
+        }
+        case GuideCellModel::Kind::EMPTY:
+            onChannelSelected(channel);
+            break;
+        case GuideCellModel::Kind::LEGACY:
+            break;  // hover-only, like before: no full program to act on
+    }
+}
+
+void LiveTVTab::onGuideCellFocused(size_t slotIndex, int model) {
+    if (slotIndex >= m_guideSlots.size()) return;
+    const int ch = m_guideSlots[slotIndex].channel;
+    if (ch < 0 || ch >= (int)m_channels.size()) return;
+    if (model < 0 || model >= (int)m_rowModels[ch].cells.size()) return;
+
+    const GuideCellModel& m = m_rowModels[ch].cells[model];
+    // A no-data cell still updates the channel chrome on the hero so the
+    // user knows which channel they'd tune.
+    if (m.kind == GuideCellModel::Kind::EMPTY)
+        queueHeroForChannel(m_channels[ch]);
+    else
+        queueHeroForProgram(m_channels[ch], m.program);
 }
 
 void LiveTVTab::buildEPGGrid() {
     const int64_t profG0 = brls::getCPUTimeUsec();
     int64_t profClear  = profG0;   // after old-view teardown
-    int64_t profHeader = profG0;   // after time-header slot build
-    // Supersede any in-flight progressive build: pending row chunks from
-    // the previous grid captured the old generation and bail on mismatch.
-    m_gridBuildGen++;
+    int64_t profHeader = profG0;   // after time-header slot bind
     s_profLogoQueued.store(0);
     s_profLogoDone.store(0);
     s_profLogoLatencyUs.store(0);
-    // Rotate the logo generation: in-flight loads from the previous grid
-    // captured the old flag and bail instead of touching freed Images.
-    if (m_logoAlive) m_logoAlive->store(false);
-    m_logoAlive = std::make_shared<std::atomic<bool>>(true);
-    m_rowLogos.clear();
     s_profFmtUs.store(0);
     s_profFmtCalls.store(0);
-    // Row-loop phase accumulators: channel column (incl. logo request),
-    // program cells, and the per-row attach (setContentView + addView,
-    // i.e. the yoga work). Whichever dominates is the real freeze cause.
-    // File-scope statics now (see the s_prof*Us block up top) so the
-    // progressive chunks keep accumulating after this function returns;
-    // the last chunk logs the totals via logGuideBuildComplete.
-    s_profColUs = s_profCellsUs = s_profAttachUs = 0;
-    // Cell-body micro-split: both prior theories for the ~3.7s cells cost
-    // (channel copies, program copies) only explained part of it, so
-    // measure the four segments of each cell directly.
-    s_profCellBoxUs = s_profCellDataUs = s_profCellWireUs = s_profCellAddUs = 0;
-
+    s_profRowBinds = s_profCellBinds = 0;
+    s_profBindUs   = 0;
+
+    // Retire the old pool. Its views are owned by the old guide box (the
+    // swap below deletes them); in-flight logo loads captured the slots'
+    // flags and bail instead of touching freed Images.
+    for (GuideRowSlot& slot : m_guideSlots)
+        if (slot.logoAlive) slot.logoAlive->store(false);
+    m_guideSlots.clear();
+    m_rowModels.clear();
     m_timeHeaderBox->clearViews();
+    m_timeSlots.clear();
+    m_lastAnchorScroll = nullptr;
+    m_boundFocus       = nullptr;
+    m_windowFirstRow   = m_windowLastRow = -1;
+    // Reset the per-frame sync / time-line caches — the grid start time
+    // shifts on rebuild and the row scroll frames have been recreated.
+    m_lastSyncedScrollX     = -1;
+    m_lastTimeLineUpdateSec = 0;
+    m_lastTimeLineHeight    = -1;
 
     // Build the new rows into an ORPHAN container and swap it into the
     // scroll frame once at the end. Adding rows to the live guide box
-    // re-ran layout over the whole growing guide subtree on every single
-    // addView (amplified by each row's HScrollingFrame) — LTVPROF measured
-    // a 9.0-SECOND UI freeze for 32 rows / 503 cells. An orphan box has no
-    // attached scroll-frame cascade, so the same build costs milliseconds;
-    // setContentView() then pays ONE full layout and deletes the old tree.
+    // re-ran layout over the whole guide subtree on every single addView
+    // (amplified by each row's HScrollingFrame) — LTVPROF measured a
+    // 9.0-SECOND UI freeze for 32 rows / 503 cells before the guide was
+    // virtualized. setContentView() then pays ONE full layout and deletes
+    // the old tree.
     GuideBox* newGuideBox = new GuideBox();
     newGuideBox->setAxis(brls::Axis::COLUMN);
     newGuideBox->setJustifyContent(brls::JustifyContent::FLEX_START);
     newGuideBox->setAlignItems(brls::AlignItems::STRETCH);
 
-    // Per-row HScrollingFrame pointers are owned by their rowBoxes (which
-    // the swap below deletes with the old guide box), so the pointers in
-    // this vector are about to dangle — purge them before rebuilding.
-    m_rowProgramScrolls.clear();
-    m_rowProgramBoxes.clear();
-    m_lastAnchorScroll = nullptr;
-    // Cell info entries reference Boxes owned by the row hierarchy we
-    // just wiped via m_guideBox->clearViews(); purge before rebuilding
-    // so draw()'s batch pass doesn't dereference freed cells.
-    m_epgCells.clear();
-    m_epgRowRanges.clear();
-    // Reset the per-frame sync / time-line caches — the grid start time
-    // shifts on rebuild and the row scroll frames have been recreated.
-    m_lastSyncedScrollX     = -1;
-    m_lastTimeLineUpdateSec = 0;
-    m_lastTimeLineHeight    = -1;
-
     profClear = brls::getCPUTimeUsec();
 
     if (m_channels.empty()) {
@@ -1809,59 +2100,45 @@ void LiveTVTab::buildEPGGrid() {
     time_t now = time(nullptr);
     m_guideStartTime = now - (now % 1800);
 
-    int gridHours = m_hoursToShow;
-    int totalSlots = gridHours * 2;
-
-    // Time header — each 30-min slot. Bold muted labels, left hairline
-    // separating slots.
-    for (int i = 0; i < totalSlots; i++) {
-        int64_t slotTime = m_guideStartTime + (i * 1800);
-
-        auto* timeSlot = new brls::Box();
-        timeSlot->setWidth(livetvTimeSlotWidth());
-        timeSlot->setHeight(TIME_HEADER_HEIGHT);
-        timeSlot->setJustifyContent(brls::JustifyContent::CENTER);
-        timeSlot->setAlignItems(brls::AlignItems::CENTER);
-        if (i > 0) {
-            timeSlot->setBorderColor(tok::hairline());
-            timeSlot->setBorderThickness(0);  // border drawn via line below
-            // borealis Box draws a uniform border; we want only a left
-            // hairline. Skip the border and draw a thin vertical strip
-            // instead so the visual stays clean.
-            auto* leftRule = new brls::Box();
-            leftRule->setPositionType(brls::PositionType::ABSOLUTE);
-            leftRule->setWidth(1);
-            leftRule->setHeight(TIME_HEADER_HEIGHT - 12);
-            leftRule->setPositionLeft(0);
-            leftRule->setPositionTop(6);
-            leftRule->setBackgroundColor(tok::hairline());
-            timeSlot->addView(leftRule);
-        }
-
-        auto* timeLabel = new brls::Label();
-        timeLabel->setText(formatTime(slotTime));
-        timeLabel->setFontSize(13);
-        timeLabel->setTextColor(tok::muted());
-        timeSlot->addView(timeLabel);
+    // Rows are absolutely positioned by channel index, so the guide box
+    // carries the full scroll height itself; the time header likewise
+    // spans the full window.
+    const int rowH = livetvRowHeight();
+    newGuideBox->setHeight((float)(m_channels.size() * rowH));
+    m_timeHeaderBox->setWidth((float)(m_hoursToShow * 2 * livetvTimeSlotWidth()));
+    m_rowModels.resize(m_channels.size());
+    m_boundWindowX = 0;
+    bindTimeHeader();
+    profHeader = brls::getCPUTimeUsec();
 
-        m_timeHeaderBox->addView(timeSlot);
+    // Bind the first screenful (plus margin) into the orphan box; draw()
+    // takes over from here, rebinding as the guide scrolls.
+    const float vpH = m_guideScrollV->getHeight();
+    int last = vpH > 1 ? (int)std::floor(vpH / rowH) + kGuideRowMargin : kInitialRows - 1;
+    last = std::min((int)m_channels.size() - 1, last);
+    for (int ch = 0; ch <= last; ch++) {
+        const size_t si = createGuideSlot();
+        bindGuideRow(si, ch);
+        newGuideBox->addView(m_guideSlots[si].row);
+        m_guideSlots[si].attached = true;
     }
-    profHeader = brls::getCPUTimeUsec();
+    m_windowFirstRow = 0;
+    m_windowLastRow  = last;
 
-    // Build channel rows — but only the first screenful synchronously.
-    // The full ~40-row build blocked the UI for ~6.3s on Vita; the first
-    // kInitialRows are enough to paint and navigate, and the remaining
-    // rows stream into the live guide box between frames via
-    // scheduleGuideRowChunk (kicked off after the swap below).
-    const size_t initialRows = std::min(m_channels.size(), (size_t)kInitialRows);
-    for (size_t i = 0; i < initialRows; i++)
-        appendGuideRow(m_channels[i], newGuideBox);
-
-    // Attach the first screenful of rows — one relayout, old tree freed.
-    // The guide is visible and navigable from here on.
+    // Attach — one relayout, old tree freed. The guide is visible and
+    // navigable from here on.
     const int64_t profSwap0 = brls::getCPUTimeUsec();
     swapInGuideBox(newGuideBox);
 
+    // First build after returning to the tab: put the guide back on the
+    // channel the user left it at. draw() rebinds the window from there.
+    if (m_restoreTopChannel > 0 && vpH > 1) {
+        const float maxOff = std::max(0.0f, (float)(m_channels.size() * rowH) - vpH);
+        m_guideScrollV->setContentOffsetY(
+            std::min(maxOff, (float)(m_restoreTopChannel * rowH)), false);
+    }
+    m_restoreTopChannel = -1;
+
     // Update the cyan time-line position now that the grid exists; the
     // draw() override keeps it tracking the wall clock thereafter.
     updateCurrentTimeLine();
@@ -1870,62 +2147,14 @@ void LiveTVTab::buildEPGGrid() {
     const int64_t profVisible = brls::getCPUTimeUsec();
     brls::Logger::info(
         "LTVPROF buildEPGGrid: total={}ms (teardown={}ms header={}ms rows={}ms swap={}ms) "
-        "rows={} cells={} logosQueued={}",
+        "channels={} rowsBound={} cellsBound={} formatTime={}ms over {} calls",
         (profVisible - profG0) / 1000,
         (profClear - profG0) / 1000,
         (profHeader - profClear) / 1000,
         (profSwap0 - profHeader) / 1000,
         (profVisible - profSwap0) / 1000,
-        (int)m_rowProgramScrolls.size(), (int)m_epgCells.size(),
-        s_profLogoQueued.load());
-    brls::Logger::info("LTVPROF guide visible: {} rows in {}ms",
-                       (int)m_rowProgramScrolls.size(),
-                       (profVisible - profG0) / 1000);
-
-    // Stream in the remaining rows, kRowsPerChunk per brls::sync tick —
-    // or, if the whole grid fit in the initial batch, the build is
-    // already complete: log the totals right away.
-    if (initialRows < m_channels.size())
-        scheduleGuideRowChunk(initialRows, m_gridBuildGen, profG0);
-    else
-        logGuideBuildComplete(m_rowProgramScrolls.size(), m_epgCells.size(), profG0);
-}
-
-// Append the next kRowsPerChunk rows into the LIVE guide box, then chain
-// the next chunk with another brls::sync so at least one frame renders
-// between chunks (performSyncTasks snapshots its queue before running, so
-// a callback queued from inside a callback waits for the next main-loop
-// iteration). Chunks run on the UI thread — no locking needed against
-// draw(), and the m_epgCells / EpgRowRange bookkeeping stays consistent
-// because appendGuideRow pushes strictly in order.
-void LiveTVTab::scheduleGuideRowChunk(size_t nextRow, int gen, int64_t buildStartUs) {
-    brls::sync([this, nextRow, gen, buildStartUs,
-                aliveWeak = std::weak_ptr<bool>(m_alive)]() {
-        auto alive = aliveWeak.lock();
-        if (!alive || !*alive) {
-            // Tab destroyed or hidden mid-build. If the object still
-            // exists (merely hidden) and no newer build superseded this
-            // one, the grid is left partial — drop m_loaded so the next
-            // focus does a full reload instead of showing a half guide.
-            if (alive && gen == m_gridBuildGen) m_loaded = false;
-            return;
-        }
-        // A reload rebuilt the grid while this chunk was queued: the new
-        // build owns m_guideBox (and schedules its own chunks) — bail.
-        if (gen != m_gridBuildGen || !m_guideBox) return;
-
-        const size_t endRow = std::min(nextRow + (size_t)kRowsPerChunk, m_channels.size());
-        for (size_t i = nextRow; i < endRow; i++)
-            appendGuideRow(m_channels[i], m_guideBox);
-        // No per-chunk log line: with 1-row chunks that would be ~23
-        // synchronous file writes on Vita — the "progressive build
-        // complete" line already reports the totals.
-
-        if (endRow < m_channels.size())
-            scheduleGuideRowChunk(endRow, gen, buildStartUs);
-        else
-            logGuideBuildComplete(m_rowProgramScrolls.size(), m_epgCells.size(), buildStartUs);
-    });
+        (int)m_channels.size(), s_profRowBinds, s_profCellBinds,
+        s_profFmtUs.load() / 1000, s_profFmtCalls.load());
 }
 
 void LiveTVTab::swapInGuideBox(brls::Box* newGuideBox) {
@@ -16,6 +16,7 @@
 #include "utils/async.hpp"
 #include "platform/platform.hpp"
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
 
@@ -39,6 +40,12 @@ MediaDetailView::MediaDetailView(const MediaItem& item)
         return true;
     }, false, false, brls::Sound::SOUND_BACK);
 
+    // Full details are often already cached (DetailPrefetcher fetches them
+    // while the cell has focus): build the page from them, so the title,
+    // summary and buttons are complete on the first frame. loadDetails()
+    // still runs and hits the same cache.
+    PlexClient::getInstance().cachedMediaDetails(m_item.ratingKey, m_item);
+
     // Movies / standalone items use the Direction-B (poster-left) two-column
     // layout, built and wired entirely in buildMovieLayout(). Everything below
     // is the layout for shows / seasons / music / etc.
@@ -415,19 +422,58 @@ std::vector<MediaItem> gatherArtistAlbums(PlexClient& client, const MediaItem& a
     return albums;
 }
 
+// The slow path for gatherArtistTracks: /children of every album
+// gatherArtistAlbums finds, one request per album.
+std::vector<MediaItem> gatherArtistTracksByAlbum(PlexClient& client, const MediaItem& artist) {
+    std::vector<MediaItem> allTracks;
+    for (const auto& album : gatherArtistAlbums(client, artist)) {
+        std::vector<MediaItem> tracks;
+        if (client.fetchChildren(album.ratingKey, tracks))
+            allTracks.insert(allTracks.end(), tracks.begin(), tracks.end());
+    }
+    return allTracks;
+}
+
+// Every track of an artist, album by album. One paged allLeaves query walks
+// the whole hierarchy (typed releases included, since they still sit under
+// the artist); the per-album walk is kept for servers that answer it with
+// nothing. Runs on a background thread (blocking HTTP).
+std::vector<MediaItem> gatherArtistTracks(PlexClient& client, const MediaItem& artist) {
+    std::vector<MediaItem> tracks;
+    if (client.fetchAllLeaves(artist.ratingKey, tracks) && !tracks.empty()) return tracks;
+    return gatherArtistTracksByAlbum(client, artist);
+}
+
 // Collect every track across an artist's albums and start playback. Shared by
 // the artist detail Play / Shuffle buttons and the artist context menu. Runs on
 // a background thread; captures only a copy of the artist (never `this`).
 void playAllArtistTracks(const MediaItem& artist, bool shuffle) {
     asyncRun([artist, shuffle]() {
         PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> albums = gatherArtistAlbums(client, artist);
-        std::vector<MediaItem> allTracks;
-        for (const auto& album : albums) {
-            std::vector<MediaItem> tracks;
-            if (client.fetchChildren(album.ratingKey, tracks))
-                allTracks.insert(allTracks.end(), tracks.begin(), tracks.end());
+        if (!shuffle) {
+            // In order: start the player on the first page of leaves and
+            // append the rest as it arrives.
+            bool started = false;
+            client.fetchAllLeaves(artist.ratingKey, [&started](std::vector<MediaItem>& page) {
+                if (!started) {
+                    brls::sync([page]() {
+                        brls::Application::pushActivity(PlayerActivity::createWithQueue(page, 0));
+                    });
+                    started = true;
+                } else {
+                    brls::sync([page]() {
+                        // Player already closed (queue cleared): drop the rest.
+                        MusicQueue& queue = MusicQueue::getInstance();
+                        if (!queue.isEmpty()) queue.addTracks(page);
+                    });
+                }
+                return true;
+            });
+            if (started) return;
         }
+
+        std::vector<MediaItem> allTracks = shuffle ? gatherArtistTracks(client, artist)
+                                                   : gatherArtistTracksByAlbum(client, artist);
         if (allTracks.empty()) {
             brls::sync([]() { brls::Application::notify("No tracks found"); });
             return;
@@ -443,31 +489,52 @@ void playAllArtistTracks(const MediaItem& artist, bool shuffle) {
     });
 }
 
+// Full details (partPath for the download URL) of every item in `items`
+// that isn't already downloaded or queued, keyed by ratingKey. Items from
+// fetchAllLeaves already carry their part and are used as they are; the
+// rest take one batched fetch instead of a request per item, which is what
+// made queueing a whole show or discography take minutes on Vita. Items
+// without a part are left out; `skipped` counts the ones already on the
+// device or in the queue.
+std::unordered_map<std::string, MediaItem> fetchDownloadDetails(
+        const std::vector<MediaItem>& items, int& skipped) {
+    auto& mgr = DownloadsManager::getInstance();
+    std::unordered_map<std::string, MediaItem> details;
+    std::vector<std::string> keys;
+    for (const auto& item : items) {
+        if (mgr.isDownloaded(item.ratingKey) ||
+            mgr.getDownload(item.ratingKey) != nullptr) { skipped++; continue; }
+        if (!item.partPath.empty()) details.emplace(item.ratingKey, item);
+        else keys.push_back(item.ratingKey);
+    }
+
+    std::vector<MediaItem> full;
+    if (!keys.empty() && PlexClient::getInstance().fetchMediaDetailsBatch(keys, full)) {
+        for (auto& item : full)
+            if (!item.partPath.empty()) details.emplace(item.ratingKey, std::move(item));
+    }
+    return details;
+}
+
 // Queue every track of every album for offline download (grouped under the
 // artist). Shared by the artist detail Download button and the context menu.
 void downloadArtistTracks(const MediaItem& artist) {
     asyncRun([artist]() {
         PlexClient& client = PlexClient::getInstance();
         auto& mgr = DownloadsManager::getInstance();
-        std::vector<MediaItem> albums = gatherArtistAlbums(client, artist);
+        std::vector<MediaItem> tracks = gatherArtistTracks(client, artist);
         int queued = 0, skipped = 0;
-        for (const auto& album : albums) {
-            std::vector<MediaItem> tracks;
-            if (client.fetchChildren(album.ratingKey, tracks)) {
-                for (const auto& track : tracks) {
-                    if (mgr.isDownloaded(track.ratingKey) ||
-                        mgr.getDownload(track.ratingKey) != nullptr) { skipped++; continue; }
-                    MediaItem full;
-                    if (client.fetchMediaDetails(track.ratingKey, full) && !full.partPath.empty()) {
-                        if (mgr.queueDownload(
-                                full.ratingKey, full.title, full.partPath,
-                                full.duration, "track", artist.title, 0, full.index,
-                                full.thumb, DownloadGroupType::ARTIST, artist.ratingKey,
-                                artist.title, artist.thumb, album.title))
-                            queued++;
-                    }
-                }
-            }
+        auto details = fetchDownloadDetails(tracks, skipped);
+        for (const auto& track : tracks) {
+            auto it = details.find(track.ratingKey);
+            if (it == details.end()) continue;
+            const MediaItem& full = it->second;
+            if (mgr.queueDownload(
+                    full.ratingKey, full.title, full.partPath,
+                    full.duration, "track", artist.title, 0, full.index,
+                    full.thumb, DownloadGroupType::ARTIST, artist.ratingKey,
+                    artist.title, artist.thumb, full.parentTitle))
+                queued++;
         }
         mgr.startDownloads();
         brls::sync([queued, skipped]() {
@@ -483,13 +550,7 @@ void downloadArtistTracks(const MediaItem& artist) {
 void enqueueArtistTracks(const MediaItem& artist) {
     asyncRun([artist]() {
         PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> albums = gatherArtistAlbums(client, artist);
-        std::vector<MediaItem> allTracks;
-        for (const auto& album : albums) {
-            std::vector<MediaItem> tracks;
-            if (client.fetchChildren(album.ratingKey, tracks))
-                allTracks.insert(allTracks.end(), tracks.begin(), tracks.end());
-        }
+        std::vector<MediaItem> allTracks = gatherArtistTracks(client, artist);
         if (allTracks.empty()) {
             brls::sync([]() { brls::Application::notify("No tracks found"); });
             return;
@@ -1158,89 +1219,43 @@ brls::View* MediaDetailView::create() {
     return nullptr; // Factory not used
 }
 
-void MediaDetailView::loadDetails() {
-    std::string ratingKey = m_item.ratingKey;
-    std::string thumbPath = m_item.thumb;
-    MediaType mediaType = m_item.mediaType;
-
-    // Load full details asynchronously to avoid blocking the UI thread
-    asyncRun([this, ratingKey, thumbPath, mediaType]() {
-        PlexClient& client = PlexClient::getInstance();
-
-        // Fetch full details on background thread
-        MediaItem fullItem;
-        bool detailsLoaded = client.fetchMediaDetails(ratingKey, fullItem);
-
-        // Update UI on main thread
-        brls::sync([this, detailsLoaded, fullItem, thumbPath, mediaType]() {
-            if (detailsLoaded) {
-                m_item = fullItem;
-
-                // Update UI with full details
-                if (m_titleLabel && !m_item.title.empty()) {
-                    m_titleLabel->setText(m_item.title);
-                }
-
-                if (m_summaryLabel && !m_item.summary.empty()) {
-                    m_fullDescription = m_item.summary;
-                    m_summaryLabel->setText(m_truncateSummary ? clampText(m_fullDescription, kBioPreviewChars)
-                                                              : m_fullDescription);
-                    if (m_summaryScroll) {
-                        m_summaryScroll->setVisibility(brls::Visibility::VISIBLE);
-                    }
-                }
-
-                // Update download button state now that we have the part path
-                if (m_downloadButton && !m_item.partPath.empty()) {
-                    DownloadItem dlCheck;
-                    if (DownloadsManager::getInstance().getDownloadCopy(m_item.ratingKey, dlCheck)) {
-                        switch (dlCheck.state) {
-                            case DownloadState::COMPLETED:
-                                m_downloadButton->setText("Downloaded");
-                                break;
-                            case DownloadState::DOWNLOADING:
-                                m_downloadButton->setText("Downloading...");
-                                break;
-                            case DownloadState::QUEUED:
-                                m_downloadButton->setText("Queued");
-                                break;
-                            case DownloadState::PAUSED:
-                                m_downloadButton->setText("Paused");
-                                break;
-                            case DownloadState::FAILED:
-                                m_downloadButton->setText("Retry Download");
-                                break;
-                            default:
-                                m_downloadButton->setText("Download");
-                                break;
-                        }
-                    } else {
-                        m_downloadButton->setText("Download");
-                    }
-                    brls::Logger::debug("loadDetails: partPath available, download enabled");
-                }
-            }
+std::string MediaDetailView::posterUrl(const MediaItem& item) {
+    if (item.thumb.empty()) return "";
+    bool isMusic = (item.mediaType == MediaType::MUSIC_ARTIST ||
+                    item.mediaType == MediaType::MUSIC_ALBUM ||
+                    item.mediaType == MediaType::MUSIC_TRACK);
 
-            // Load thumbnail with appropriate aspect ratio
-            std::string thumb = detailsLoaded ? m_item.thumb : thumbPath;
-            if (m_posterImage && !thumb.empty()) {
-                bool isMusic = (m_item.mediaType == MediaType::MUSIC_ARTIST ||
-                                m_item.mediaType == MediaType::MUSIC_ALBUM ||
-                                m_item.mediaType == MediaType::MUSIC_TRACK);
+    const auto& reqIc = platform::getImageConstraints();
+    int width = isMusic ? reqIc.squareRequestSize : reqIc.detailPosterRequestWidth;
+    int height = isMusic ? reqIc.squareRequestSize : reqIc.detailPosterRequestHeight;
+    return PlexClient::getInstance().getThumbnailUrl(item.thumb, width, height);
+}
 
-                const auto& reqIc = platform::getImageConstraints();
-                int width = isMusic ? reqIc.squareRequestSize : reqIc.detailPosterRequestWidth;
-                int height = isMusic ? reqIc.squareRequestSize : reqIc.detailPosterRequestHeight;
+void MediaDetailView::loadDetails() {
+    std::string ratingKey = m_item.ratingKey;
 
-                PlexClient& client = PlexClient::getInstance();
-                std::string url = client.getThumbnailUrl(thumb, width, height);
-                ImageLoader::loadAsync(url, [](brls::Image* image) {
-                    image->setVisibility(brls::Visibility::VISIBLE);
-                }, m_posterImage, m_alive);
+    // Full details first; every other row on the page fans out from them.
+    // Bound to m_tasks, so backing out of the page cancels the fetch and the
+    // UI callback can never run against a destroyed view.
+    struct Details {
+        bool loaded = false;
+        MediaItem item;
+    };
+    m_tasks.run([ratingKey]() {
+        Details d;
+        d.loaded = PlexClient::getInstance().fetchMediaDetails(ratingKey, d.item);
+        return d;
+    }).onUI([this](const Details& details) {
+        const bool detailsLoaded = details.loaded;
+        if (detailsLoaded) {
+            m_item = details.item;
+
+            // Update UI with full details
+            if (m_titleLabel && !m_item.title.empty()) {
+                m_titleLabel->setText(m_item.title);
             }
 
-            // Update description if full details loaded
-            if (!m_item.summary.empty() && m_summaryLabel) {
+            if (m_summaryLabel && !m_item.summary.empty()) {
                 m_fullDescription = m_item.summary;
                 m_summaryLabel->setText(m_truncateSummary ? clampText(m_fullDescription, kBioPreviewChars)
                                                           : m_fullDescription);
@@ -1249,99 +1264,127 @@ void MediaDetailView::loadDetails() {
                 }
             }
 
-            // Load children if applicable
-            if (m_item.mediaType == MediaType::MUSIC_ARTIST) {
-                refreshArtistMeta();   // genres now available from full details
-                loadMusicCategories();
-            } else if (m_item.mediaType == MediaType::MUSIC_ALBUM) {
-                loadTrackList();
-            } else {
-                loadChildren();
-                // Load extras (trailers, featurettes) for movies and shows
-                if (m_item.mediaType == MediaType::MOVIE ||
-                    m_item.mediaType == MediaType::SHOW) {
-                    loadExtras();
-                }
-                // Movies and shows also get cast & crew + recommended rows.
-                if (m_item.mediaType == MediaType::MOVIE ||
-                    m_item.mediaType == MediaType::SHOW) {
-                    loadPeople();
-                    loadRecommendations();
+            // Update download button state now that we have the part path
+            if (m_downloadButton && !m_item.partPath.empty()) {
+                DownloadItem dlCheck;
+                if (DownloadsManager::getInstance().getDownloadCopy(m_item.ratingKey, dlCheck)) {
+                    switch (dlCheck.state) {
+                        case DownloadState::COMPLETED:
+                            m_downloadButton->setText("Downloaded");
+                            break;
+                        case DownloadState::DOWNLOADING:
+                            m_downloadButton->setText("Downloading...");
+                            break;
+                        case DownloadState::QUEUED:
+                            m_downloadButton->setText("Queued");
+                            break;
+                        case DownloadState::PAUSED:
+                            m_downloadButton->setText("Paused");
+                            break;
+                        case DownloadState::FAILED:
+                            m_downloadButton->setText("Retry Download");
+                            break;
+                        default:
+                            m_downloadButton->setText("Download");
+                            break;
+                    }
+                } else {
+                    m_downloadButton->setText("Download");
                 }
+                brls::Logger::debug("loadDetails: partPath available, download enabled");
             }
+        }
 
-            // Movies: pull the audio + subtitle stream list so the
-            // AUDIO / SUBTITLES rows can populate themselves and so
-            // Play uses whichever tracks the user picks here.
-            if (m_item.mediaType == MediaType::MOVIE) {
-                loadStreams();
+        // Load thumbnail with appropriate aspect ratio
+        std::string url = posterUrl(m_item);
+        if (m_posterImage && !url.empty()) {
+            ImageLoader::loadAsync(url, [](brls::Image* image) {
+                image->setVisibility(brls::Visibility::VISIBLE);
+            }, m_posterImage, m_alive);
+        }
+
+        // Update description if full details loaded
+        if (!m_item.summary.empty() && m_summaryLabel) {
+            m_fullDescription = m_item.summary;
+            m_summaryLabel->setText(m_truncateSummary ? clampText(m_fullDescription, kBioPreviewChars)
+                                                      : m_fullDescription);
+            if (m_summaryScroll) {
+                m_summaryScroll->setVisibility(brls::Visibility::VISIBLE);
             }
-        });
-    });
+        }
+
+        // Load children if applicable. The row loaders below each start
+        // their own task on m_tasks: the fetches run in parallel and every
+        // row renders the moment its own result lands.
+        if (m_item.mediaType == MediaType::MUSIC_ARTIST) {
+            refreshArtistMeta();   // genres now available from full details
+            loadMusicCategories();
+        } else if (m_item.mediaType == MediaType::MUSIC_ALBUM) {
+            loadTrackList();
+        } else {
+            loadChildren();
+            // Load extras (trailers, featurettes) for movies and shows
+            if (m_item.mediaType == MediaType::MOVIE ||
+                m_item.mediaType == MediaType::SHOW) {
+                loadExtras();
+            }
+            // Movies and shows also get cast & crew + recommended rows.
+            if (m_item.mediaType == MediaType::MOVIE ||
+                m_item.mediaType == MediaType::SHOW) {
+                loadPeople();
+                loadRecommendations();
+            }
+        }
+
+        // Movies: pull the audio + subtitle stream list so the
+        // AUDIO / SUBTITLES rows can populate themselves and so
+        // Play uses whichever tracks the user picks here.
+        if (m_item.mediaType == MediaType::MOVIE) {
+            loadStreams();
+        }
+    }, brls::Application::TaskPriority::HIGH);
 }
 
 void MediaDetailView::loadChildren() {
     if (!m_childrenBox) return;
 
-    PlexClient& client = PlexClient::getInstance();
-
-    if (client.fetchChildren(m_item.ratingKey, m_children)) {
-        // Skip single season: if show has exactly one season and setting is enabled,
-        // fetch episodes directly and display them instead of the season
-        AppSettings& settings = Application::getInstance().getSettings();
-        if (m_item.mediaType == MediaType::SHOW &&
-            settings.skipSingleSeason &&
-            m_children.size() == 1 &&
-            m_children[0].mediaType == MediaType::SEASON) {
-
-            MediaItem singleSeason = m_children[0];
-            std::vector<MediaItem> episodes;
-            if (client.fetchChildren(singleSeason.ratingKey, episodes) && !episodes.empty()) {
-                m_children = episodes;
-
-                // Update label and scroll height for episodes (landscape cells)
-                if (m_childrenLabel) m_childrenLabel->setText("Episodes");
-                if (m_childrenScroll) {
-                    m_childrenScroll->setHeight(
-                        platform::getImageConstraints().landscapeRowHeight);
-                }
-
-                m_childrenBox->clearViews();
-                for (const auto& child : m_children) {
-                    auto* cell = new MediaItemCell();
-                    cell->setItem(child);
-                    cell->setMarginRight(10);
-
-                    cell->registerClickAction([child](brls::View* view) {
-                        Application::getInstance().pushPlayerActivity(child.ratingKey);
-                        return true;
-                    });
-                    cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
-                                // Register START button context menu for child items
-                    MediaItem capturedChild = child;
-                    if (child.mediaType == MediaType::EPISODE) {
-                        cell->registerAction("Options", brls::ControllerButton::BUTTON_START,
-                            
-                            [capturedChild](brls::View* view) {
-                                brls::Application::notify("START pressed");
-                                showEpisodeContextMenu(capturedChild);
-                                return true;
-                            });
-                    }
-                    cell->addGestureRecognizer(new LongPressGestureRecognizer(
-                        cell, [capturedChild](LongPressGestureStatus status) {
-                            if (status.state == brls::GestureState::START &&
-                                capturedChild.mediaType == MediaType::EPISODE) {
-                                showEpisodeContextMenu(capturedChild);
-                            }
-                            
-                        }));
-                    m_childrenBox->addView(cell);
-                }
-
-                // Set up focus transfer: UP from children goes to description or first child
-                setupChildrenFocusTransfer();
-                return;
+    std::string ratingKey = m_item.ratingKey;
+    // Skip single season: if show has exactly one season and setting is enabled,
+    // fetch episodes directly and display them instead of the season
+    const bool skipSingleSeason = m_item.mediaType == MediaType::SHOW &&
+                                  Application::getInstance().getSettings().skipSingleSeason;
+
+    struct Children {
+        bool ok = false;
+        bool flattened = false;   // a lone season replaced by its episodes
+        std::vector<MediaItem> items;
+    };
+    m_tasks.run([ratingKey]() {
+        Children c;
+        c.ok = PlexClient::getInstance().fetchChildren(ratingKey, c.items);
+        return c;
+    }).then([skipSingleSeason](const Children& c) {
+        if (!skipSingleSeason || !c.ok || c.items.size() != 1 ||
+            c.items[0].mediaType != MediaType::SEASON)
+            return c;
+        Children episodes;
+        if (PlexClient::getInstance().fetchChildren(c.items[0].ratingKey, episodes.items) &&
+            !episodes.items.empty()) {
+            episodes.ok = true;
+            episodes.flattened = true;
+            return episodes;
+        }
+        return c;
+    }).onUI([this](const Children& c) {
+        if (!c.ok) return;
+        m_children = c.items;
+
+        if (c.flattened) {
+            // Update label and scroll height for episodes (landscape cells)
+            if (m_childrenLabel) m_childrenLabel->setText("Episodes");
+            if (m_childrenScroll) {
+                m_childrenScroll->setHeight(
+                    platform::getImageConstraints().landscapeRowHeight);
             }
         }
 
@@ -1395,7 +1438,7 @@ void MediaDetailView::loadChildren() {
 
         // Set up focus transfer: UP from children goes to description or first child
         setupChildrenFocusTransfer();
-    }
+    });
 }
 
 void MediaDetailView::loadExtras() {
@@ -1403,47 +1446,43 @@ void MediaDetailView::loadExtras() {
 
     std::string ratingKey = m_item.ratingKey;
 
-    asyncRun([this, ratingKey]() {
-        PlexClient& client = PlexClient::getInstance();
-
+    m_tasks.run([ratingKey]() {
         std::vector<MediaItem> extras;
-        bool ok = client.fetchExtras(ratingKey, extras);
-
-        brls::sync([this, ok, extras]() {
-            if (!m_alive || !m_alive->load()) return;
-            if (!ok || extras.empty()) return;
+        if (!PlexClient::getInstance().fetchExtras(ratingKey, extras)) extras.clear();
+        return extras;
+    }).onUI([this](const std::vector<MediaItem>& extras) {
+        if (extras.empty()) return;
 
-            m_extrasBox->clearViews();
+        m_extrasBox->clearViews();
 
-            // Show the pre-created label and scroll frame
-            if (m_extrasLabel) {
-                m_extrasLabel->setText("Extras (" + std::to_string(extras.size()) + ")");
-                m_extrasLabel->setVisibility(brls::Visibility::VISIBLE);
-            }
-            if (m_extrasScroll) {
-                m_extrasScroll->setVisibility(brls::Visibility::VISIBLE);
-            }
+        // Show the pre-created label and scroll frame
+        if (m_extrasLabel) {
+            m_extrasLabel->setText("Extras (" + std::to_string(extras.size()) + ")");
+            m_extrasLabel->setVisibility(brls::Visibility::VISIBLE);
+        }
+        if (m_extrasScroll) {
+            m_extrasScroll->setVisibility(brls::Visibility::VISIBLE);
+        }
 
-            for (const auto& extra : extras) {
-                auto* cell = new MediaItemCell();
-                cell->setItem(extra);
-                cell->setMarginRight(10);
+        for (const auto& extra : extras) {
+            auto* cell = new MediaItemCell();
+            cell->setItem(extra);
+            cell->setMarginRight(10);
 
-                cell->registerClickAction([extra](brls::View* view) {
-                    // Play the extra directly
-                    Application::getInstance().pushPlayerActivity(extra.ratingKey);
-                    return true;
-                });
-                cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
+            cell->registerClickAction([extra](brls::View* view) {
+                // Play the extra directly
+                Application::getInstance().pushPlayerActivity(extra.ratingKey);
+                return true;
+            });
+            cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
 
-                m_extrasBox->addView(cell);
-            }
+            m_extrasBox->addView(cell);
+        }
 
-            brls::Logger::info("Loaded {} extras into UI", extras.size());
+        brls::Logger::info("Loaded {} extras into UI", extras.size());
 
-            // Re-run focus setup so extras get proper UP/DOWN navigation
-            setupChildrenFocusTransfer();
-        });
+        // Re-run focus setup so extras get proper UP/DOWN navigation
+        setupChildrenFocusTransfer();
     });
 }
 
@@ -1493,7 +1532,7 @@ void MediaDetailView::buildPeopleAndRecommendedRows(brls::Box* parent) {
 void MediaDetailView::loadPeople() {
     // Cast & crew come straight off the already-fetched detail metadata
     // (m_item.cast was populated by fetchMediaDetails), so just build the row.
-    if (!m_peopleBox || !m_alive || !m_alive->load()) return;
+    if (!m_peopleBox) return;
 
     const std::vector<MediaItem::Person>& cast = m_item.cast;
     if (cast.empty()) return;
@@ -1576,41 +1615,37 @@ void MediaDetailView::loadRecommendations() {
 
     std::string ratingKey = m_item.ratingKey;
 
-    asyncRun([this, ratingKey]() {
-        PlexClient& client = PlexClient::getInstance();
-
+    m_tasks.run([ratingKey]() {
         std::vector<MediaItem> related;
-        bool ok = client.fetchRelated(ratingKey, related);
-
-        brls::sync([this, ok, related]() {
-            if (!m_alive || !m_alive->load()) return;
-            if (!ok || related.empty()) return;
-
-            m_recommendationsBox->clearViews();
-            if (m_recommendationsLabel) {
-                m_recommendationsLabel->setText("Recommended");
-                m_recommendationsLabel->setVisibility(brls::Visibility::VISIBLE);
-            }
-            if (m_recommendationsScroll)
-                m_recommendationsScroll->setVisibility(brls::Visibility::VISIBLE);
+        if (!PlexClient::getInstance().fetchRelated(ratingKey, related)) related.clear();
+        return related;
+    }).onUI([this](const std::vector<MediaItem>& related) {
+        if (related.empty()) return;
+
+        m_recommendationsBox->clearViews();
+        if (m_recommendationsLabel) {
+            m_recommendationsLabel->setText("Recommended");
+            m_recommendationsLabel->setVisibility(brls::Visibility::VISIBLE);
+        }
+        if (m_recommendationsScroll)
+            m_recommendationsScroll->setVisibility(brls::Visibility::VISIBLE);
 
-            for (const auto& rec : related) {
-                auto* cell = new MediaItemCell();
-                cell->setItem(rec);
-                cell->setMarginRight(10);
-                // Tapping a recommendation opens its own detail page.
-                cell->registerClickAction([rec](brls::View* view) {
-                    auto* detailView = new MediaDetailView(rec);
-                    brls::Application::pushActivity(new brls::Activity(detailView));
-                    return true;
-                });
-                cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
-                m_recommendationsBox->addView(cell);
-            }
+        for (const auto& rec : related) {
+            auto* cell = new MediaItemCell();
+            cell->setItem(rec);
+            cell->setMarginRight(10);
+            // Tapping a recommendation opens its own detail page.
+            cell->registerClickAction([rec](brls::View* view) {
+                auto* detailView = new MediaDetailView(rec);
+                brls::Application::pushActivity(new brls::Activity(detailView));
+                return true;
+            });
+            cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
+            m_recommendationsBox->addView(cell);
+        }
 
-            brls::Logger::info("Loaded {} recommendations into UI", related.size());
-            setupChildrenFocusTransfer();
-        });
+        brls::Logger::info("Loaded {} recommendations into UI", related.size());
+        setupChildrenFocusTransfer();
     });
 }
 
@@ -1997,15 +2032,58 @@ void MediaDetailView::showPersonResults(const std::string& personName,
 void MediaDetailView::loadMusicCategories() {
     if (!m_musicCategoriesBox) return;
 
-    asyncRun([this]() {
-        PlexClient& client = PlexClient::getInstance();
+    // The typed-release queries need the artist's library section id.
+    // Usually already on the item; fall back to the artist metadata if not.
+    if (!m_item.librarySectionKey.empty()) {
+        loadArtistReleases(m_item.librarySectionKey);
+        return;
+    }
+    const std::string ratingKey = m_item.ratingKey;
+    m_tasks.run([ratingKey]() {
+        MediaItem full;
+        if (!PlexClient::getInstance().fetchMediaDetails(ratingKey, full)) return std::string();
+        return full.librarySectionKey;
+    }).onUI([this](const std::string& sectionKey) {
+        loadArtistReleases(sectionKey);
+    });
+}
+
+// One task per rail (music videos, the base albums, each typed category),
+// joined with whenAll so the rails go up together in a fixed order. All of
+// them are on m_tasks: leaving the page cancels every request still running.
+void MediaDetailView::loadArtistReleases(const std::string& sectionKey) {
+    // Typed releases, the way the official client splits them. Plex follows
+    // MusicBrainz: Single / EP are primary types (album.format); everything
+    // else is a secondary type (album.subformat). One query per value —
+    // Plex's comma/IN form is unreliable. Empty categories hide themselves.
+    struct AlbumCat {
+        const char* label;
+        std::vector<std::string> filters;   // OR'd together (e.g. Single + EP)
+    };
+    static const std::vector<AlbumCat> kCats = {
+        {"Singles & EPs", {"album.format=Single", "album.format=EP"}},
+        {"Compilations",  {"album.subformat=Compilation"}},
+        {"Soundtracks",   {"album.subformat=Soundtrack"}},
+        {"Live",          {"album.subformat=Live"}},
+        {"Remixes",       {"album.subformat=Remix"}},
+        {"Demos",         {"album.subformat=Demo"}},
+        {"DJ Mixes",      {"album.subformat=DJ-mix"}},
+        {"Mixtapes",      {"album.subformat=Mixtape/Street"}},
+        {"Spoken Word",   {"album.subformat=Spokenword"}},
+        {"Interviews",    {"album.subformat=Interview"}},
+        {"Audiobooks",    {"album.subformat=Audiobook"}},
+    };
+    enum : size_t { kVideos = 0, kChildren = 1, kFirstCat = 2 };
 
-        // Fetch music videos (extras) for this artist
+    const std::string ratingKey = m_item.ratingKey;
+    std::vector<Task<std::vector<MediaItem>>> fetches;
+
+    // Music videos: the artist's extras that are clips or subtype musicVideo.
+    fetches.push_back(m_tasks.run([ratingKey]() {
         std::vector<MediaItem> musicVideos;
         std::vector<MediaItem> allExtras;
-        if (client.fetchExtras(m_item.ratingKey, allExtras)) {
+        if (PlexClient::getInstance().fetchExtras(ratingKey, allExtras)) {
             for (const auto& extra : allExtras) {
-                // Music videos are clips with subtype "musicVideo" or just clips from artists
                 std::string subtype = extra.subtype;
                 for (char& c : subtype) c = tolower(c);
                 if (extra.mediaType == MediaType::CLIP || subtype == "musicvideo") {
@@ -2014,158 +2092,136 @@ void MediaDetailView::loadMusicCategories() {
             }
             brls::Logger::info("Artist: Found {} music videos from {} extras", musicVideos.size(), allExtras.size());
         }
-
-        // Resolve the artist's library section id — needed for the album.subformat
-        // queries below. Usually already on the item; fall back to the artist
-        // metadata if not.
-        std::string sectionKey = m_item.librarySectionKey;
-        if (sectionKey.empty()) {
-            MediaItem full;
-            if (client.fetchMediaDetails(m_item.ratingKey, full))
-                sectionKey = full.librarySectionKey;
-        }
-
-        // Albums come straight from the artist's /children (the base releases) —
-        // the same endpoint the rest of the music uses. Singles & EPs and
-        // Compilations aren't in /children; they're pulled by album.subformat,
-        // the field the official Plex client uses to split releases (Plex does
-        // not return it inline, only as a queryable filter).
+        return musicVideos;
+    }));
+
+    // Albums come straight from the artist's /children (the base releases) —
+    // the same endpoint the rest of the music uses. Singles & EPs and
+    // Compilations aren't in /children; they're pulled by album.subformat,
+    // the field the official Plex client uses to split releases (Plex does
+    // not return it inline, only as a queryable filter).
+    fetches.push_back(m_tasks.run([ratingKey]() {
         std::vector<MediaItem> children;
-        client.fetchChildren(m_item.ratingKey, children);
-
-        // Typed releases, the way the official client splits them. Plex follows
-        // MusicBrainz: Single / EP are primary types (album.format); everything
-        // else is a secondary type (album.subformat). One query per value —
-        // Plex's comma/IN form is unreliable. Empty categories hide themselves.
-        struct AlbumCat {
-            std::string label;
-            std::vector<std::string> filters;   // OR'd together (e.g. Single + EP)
+        PlexClient::getInstance().fetchChildren(ratingKey, children);
+        return children;
+    }));
+
+    for (const auto& cat : kCats) {
+        const std::vector<std::string> filters = cat.filters;
+        fetches.push_back(m_tasks.run([sectionKey, ratingKey, filters]() {
             std::vector<MediaItem> items;
-        };
-        std::vector<AlbumCat> cats = {
-            {"Singles & EPs", {"album.format=Single", "album.format=EP"}, {}},
-            {"Compilations",  {"album.subformat=Compilation"},            {}},
-            {"Soundtracks",   {"album.subformat=Soundtrack"},             {}},
-            {"Live",          {"album.subformat=Live"},                   {}},
-            {"Remixes",       {"album.subformat=Remix"},                  {}},
-            {"Demos",         {"album.subformat=Demo"},                   {}},
-            {"DJ Mixes",      {"album.subformat=DJ-mix"},                 {}},
-            {"Mixtapes",      {"album.subformat=Mixtape/Street"},         {}},
-            {"Spoken Word",   {"album.subformat=Spokenword"},             {}},
-            {"Interviews",    {"album.subformat=Interview"},              {}},
-            {"Audiobooks",    {"album.subformat=Audiobook"},              {}},
-        };
-        if (!sectionKey.empty()) {
-            for (auto& c : cats) {
-                for (const auto& f : c.filters) {
-                    std::vector<MediaItem> part;
-                    client.fetchArtistAlbumsByFilter(sectionKey, m_item.ratingKey, f, part);
-                    c.items.insert(c.items.end(), part.begin(), part.end());
-                }
+            if (sectionKey.empty()) return items;
+            for (const auto& f : filters) {
+                std::vector<MediaItem> part;
+                PlexClient::getInstance().fetchArtistAlbumsByFilter(sectionKey, ratingKey, f, part);
+                items.insert(items.end(), part.begin(), part.end());
             }
-        }
+            return items;
+        }));
+    }
+
+    whenAll(m_tasks, fetches).onUI([this](const std::vector<std::vector<MediaItem>>& rails) {
+        const std::vector<MediaItem>& musicVideos = rails[kVideos];
 
         // /children can also include the typed releases, so drop anything already
         // shown in a typed row to avoid duplicates in Albums.
         std::unordered_set<std::string> typed;
-        for (const auto& c : cats)
-            for (const auto& a : c.items) typed.insert(a.ratingKey);
+        for (size_t i = kFirstCat; i < rails.size(); i++)
+            for (const auto& a : rails[i]) typed.insert(a.ratingKey);
         std::vector<MediaItem> albums;
-        for (const auto& a : children)
+        for (const auto& a : rails[kChildren])
             if (a.mediaType == MediaType::MUSIC_ALBUM && !typed.count(a.ratingKey))
                 albums.push_back(a);
 
-        brls::sync([this, albums, cats, musicVideos]() {
-            m_musicCategoriesBox->clearViews();
-
-            // Refresh the header meta now that release data is in: album count is
-            // the main Albums rail; track count prefers the artist's own leafCount
-            // and falls back to summing every release's track count.
-            m_artistAlbumCount = (int)albums.size();
-            int trackSum = 0;
-            for (const auto& a : albums) trackSum += a.leafCount;
-            for (const auto& c : cats)
-                for (const auto& a : c.items) trackSum += a.leafCount;
-            m_artistTrackCount = (m_item.leafCount > 0) ? m_item.leafCount : trackSum;
-            refreshArtistMeta();
-
-            // First rail's cells get an explicit UP route to Play (below): the
-            // rails live in a separate CENTERED scroll region, and when that
-            // region is scrolled the frame would otherwise swallow UP to scroll
-            // itself instead of handing focus back to the action row.
-            brls::Box* firstRailContent = nullptr;
-
-            auto addCategory = [this, &firstRailContent](const std::string& title,
-                                                         const std::vector<MediaItem>& items) {
-                if (items.empty()) return;
-
-                brls::Box* content = nullptr;
-                createMediaRow(title, (int)items.size(), &content);
-                if (!firstRailContent) firstRailContent = content;
-
-                for (const auto& item : items) {
-                    auto* cell = new MediaItemCell();
-                    cell->setItem(item);
-                    cell->setMarginRight(10);
-
-                    MediaItem capturedItem = item;
-                    cell->registerClickAction([this, capturedItem](brls::View* view) {
-                        auto* detailView = new MediaDetailView(capturedItem);
-                        brls::Application::pushActivity(new brls::Activity(detailView));
-                        return true;
-                    });
-                    cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
+        m_musicCategoriesBox->clearViews();
+
+        // Refresh the header meta now that release data is in: album count is
+        // the main Albums rail; track count prefers the artist's own leafCount
+        // and falls back to summing every release's track count.
+        m_artistAlbumCount = (int)albums.size();
+        int trackSum = 0;
+        for (const auto& a : albums) trackSum += a.leafCount;
+        for (size_t i = kFirstCat; i < rails.size(); i++)
+            for (const auto& a : rails[i]) trackSum += a.leafCount;
+        m_artistTrackCount = (m_item.leafCount > 0) ? m_item.leafCount : trackSum;
+        refreshArtistMeta();
+
+        // First rail's cells get an explicit UP route to Play (below): the
+        // rails live in a separate CENTERED scroll region, and when that
+        // region is scrolled the frame would otherwise swallow UP to scroll
+        // itself instead of handing focus back to the action row.
+        brls::Box* firstRailContent = nullptr;
+
+        auto addCategory = [this, &firstRailContent](const std::string& title,
+                                                     const std::vector<MediaItem>& items) {
+            if (items.empty()) return;
+
+            brls::Box* content = nullptr;
+            createMediaRow(title, (int)items.size(), &content);
+            if (!firstRailContent) firstRailContent = content;
+
+            for (const auto& item : items) {
+                auto* cell = new MediaItemCell();
+                cell->setItem(item);
+                cell->setMarginRight(10);
 
-                    cell->registerAction("Options", brls::ControllerButton::BUTTON_START, [this, capturedItem](brls::View* view) {
-                        showAlbumContextMenu(capturedItem);
-                        return true;
-                    });
-                    cell->addGestureRecognizer(new LongPressGestureRecognizer(
-                        cell, [this, capturedItem](LongPressGestureStatus status) {
-                            if (status.state == brls::GestureState::START) {
-                                showAlbumContextMenu(capturedItem);
-                            }
-                        }));
+                MediaItem capturedItem = item;
+                cell->registerClickAction([this, capturedItem](brls::View* view) {
+                    auto* detailView = new MediaDetailView(capturedItem);
+                    brls::Application::pushActivity(new brls::Activity(detailView));
+                    return true;
+                });
+                cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
 
-                    content->addView(cell);
-                }
-            };
+                cell->registerAction("Options", brls::ControllerButton::BUTTON_START, [this, capturedItem](brls::View* view) {
+                    showAlbumContextMenu(capturedItem);
+                    return true;
+                });
+                cell->addGestureRecognizer(new LongPressGestureRecognizer(
+                    cell, [this, capturedItem](LongPressGestureStatus status) {
+                        if (status.state == brls::GestureState::START) {
+                            showAlbumContextMenu(capturedItem);
+                        }
+                    }));
 
-            // Albums first, then every non-empty typed category in order.
-            addCategory("Albums", albums);
-            for (const auto& c : cats)
-                addCategory(c.label, c.items);
+                content->addView(cell);
+            }
+        };
 
-            // Add music videos row
-            if (!musicVideos.empty()) {
-                brls::Box* mvContent = nullptr;
-                createMediaRow("Music Videos", (int)musicVideos.size(), &mvContent);
+        // Albums first, then every non-empty typed category in order.
+        addCategory("Albums", albums);
+        for (size_t i = 0; i < kCats.size(); i++)
+            addCategory(kCats[i].label, rails[kFirstCat + i]);
 
-                for (const auto& mv : musicVideos) {
-                    auto* cell = new MediaItemCell();
-                    cell->setItem(mv);
-                    cell->setMarginRight(10);
+        // Add music videos row
+        if (!musicVideos.empty()) {
+            brls::Box* mvContent = nullptr;
+            createMediaRow("Music Videos", (int)musicVideos.size(), &mvContent);
 
-                    MediaItem capturedMv = mv;
-                    cell->registerClickAction([capturedMv](brls::View* view) {
-                        Application::getInstance().pushPlayerActivity(capturedMv.ratingKey);
-                        return true;
-                    });
-                    cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
+            for (const auto& mv : musicVideos) {
+                auto* cell = new MediaItemCell();
+                cell->setItem(mv);
+                cell->setMarginRight(10);
 
-                    mvContent->addView(cell);
-                }
-                if (!firstRailContent) firstRailContent = mvContent;
-            }
+                MediaItem capturedMv = mv;
+                cell->registerClickAction([capturedMv](brls::View* view) {
+                    Application::getInstance().pushPlayerActivity(capturedMv.ratingKey);
+                    return true;
+                });
+                cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
 
-            // Wire UP from every cell of the first rail straight to Play so focus
-            // can always return to the action row. Focus itself stays on Play
-            // (the first focusable view) when the screen opens.
-            if (m_playButton && firstRailContent) {
-                for (auto* cell : firstRailContent->getChildren())
-                    cell->setCustomNavigationRoute(brls::FocusDirection::UP, m_playButton);
+                mvContent->addView(cell);
             }
-        });
+            if (!firstRailContent) firstRailContent = mvContent;
+        }
+
+        // Wire UP from every cell of the first rail straight to Play so focus
+        // can always return to the action row. Focus itself stays on Play
+        // (the first focusable view) when the screen opens.
+        if (m_playButton && firstRailContent) {
+            for (auto* cell : firstRailContent->getChildren())
+                cell->setCustomNavigationRoute(brls::FocusDirection::UP, m_playButton);
+        }
     });
 }
 
@@ -2395,37 +2451,16 @@ void MediaDetailView::downloadAll() {
         int queued = 0;
         int skipped = 0;
 
-        if (mediaType == MediaType::SHOW) {
-            // Get all seasons first, then all episodes
-            std::vector<MediaItem> seasons;
-            if (client.fetchChildren(ratingKey, seasons)) {
-                for (const auto& season : seasons) {
-                    std::vector<MediaItem> episodes;
-                    if (client.fetchChildren(season.ratingKey, episodes)) {
-                        for (auto& ep : episodes) {
-                            items.push_back(ep);
-                        }
-                    }
-                }
-            }
-        } else if (mediaType == MediaType::SEASON || mediaType == MediaType::MUSIC_ALBUM) {
-            // Get direct children (episodes or tracks)
-            client.fetchChildren(ratingKey, items);
+        if (mediaType == MediaType::SHOW || mediaType == MediaType::SEASON ||
+            mediaType == MediaType::MUSIC_ALBUM) {
+            // Every episode / track in one paged query, parts included
+            client.fetchAllLeaves(ratingKey, items);
         } else if (mediaType == MediaType::MUSIC_ARTIST) {
-            // Get all albums — including compilations/soundtracks/singles Plex
-            // keeps out of /children — then all tracks. Pass just the ratingKey;
-            // gatherArtistAlbums resolves the library section itself.
+            // Pass just the ratingKey; the album-walk fallback resolves the
+            // library section itself.
             MediaItem artistItem;
             artistItem.ratingKey = ratingKey;
-            std::vector<MediaItem> albums = gatherArtistAlbums(client, artistItem);
-            for (const auto& album : albums) {
-                std::vector<MediaItem> tracks;
-                if (client.fetchChildren(album.ratingKey, tracks)) {
-                    for (auto& track : tracks) {
-                        items.push_back(track);
-                    }
-                }
-            }
+            items = gatherArtistTracks(client, artistItem);
         }
 
         size_t itemCount = items.size();
@@ -2454,26 +2489,18 @@ void MediaDetailView::downloadAll() {
 
         // Queue each item for download
         auto& mgr = DownloadsManager::getInstance();
+        // Part paths for everything not on the device yet, batched.
+        brls::sync([progressDialog]() {
+            progressDialog->setStatus("Fetching download info...");
+        });
+        auto details = fetchDownloadDetails(items, skipped);
         for (size_t i = 0; i < items.size(); i++) {
             const auto& item = items[i];
 
-            // Skip items already downloaded or in queue
-            if (mgr.isDownloaded(item.ratingKey) ||
-                mgr.getDownload(item.ratingKey) != nullptr) {
-                skipped++;
-                size_t currentIndex = i;
-                brls::sync([progressDialog, currentIndex, itemCount, queued, skipped]() {
-                    progressDialog->setStatus("Queued " + std::to_string(queued) + " of " +
-                                             std::to_string(itemCount) +
-                                             (skipped > 0 ? " (" + std::to_string(skipped) + " skipped)" : ""));
-                    progressDialog->setProgress(0.1f + 0.9f * static_cast<float>(currentIndex + 1) / itemCount);
-                });
-                continue;
-            }
-
-            // Get full details to get the part path
-            MediaItem fullItem;
-            if (client.fetchMediaDetails(item.ratingKey, fullItem) && !fullItem.partPath.empty()) {
+            // Already downloaded / queued, or no part to download
+            auto it = details.find(item.ratingKey);
+            if (it != details.end()) {
+                const MediaItem& fullItem = it->second;
                 std::string itemMediaType = "episode";
                 if (fullItem.mediaType == MediaType::MOVIE) itemMediaType = "movie";
                 else if (fullItem.mediaType == MediaType::MUSIC_TRACK) itemMediaType = "track";
@@ -2543,40 +2570,19 @@ void MediaDetailView::downloadUnwatched(int maxCount) {
         int queued = 0;
         int skipped = 0;
 
-        if (mediaType == MediaType::SHOW) {
-            // Get all seasons first, then unwatched episodes
-            std::vector<MediaItem> seasons;
-            if (client.fetchChildren(ratingKey, seasons)) {
-                for (const auto& season : seasons) {
-                    std::vector<MediaItem> episodes;
-                    if (client.fetchChildren(season.ratingKey, episodes)) {
-                        for (auto& ep : episodes) {
-                            if (!ep.watched && ep.viewOffset == 0) {
-                                unwatchedItems.push_back(ep);
-                                if (maxCount > 0 && (int)unwatchedItems.size() >= maxCount) {
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    if (maxCount > 0 && (int)unwatchedItems.size() >= maxCount) {
-                        break;
-                    }
-                }
-            }
-        } else if (mediaType == MediaType::SEASON) {
-            // Get unwatched episodes in this season
-            std::vector<MediaItem> episodes;
-            if (client.fetchChildren(ratingKey, episodes)) {
+        if (mediaType == MediaType::SHOW || mediaType == MediaType::SEASON) {
+            // Unwatched episodes in airing order, stopping at maxCount
+            client.fetchAllLeaves(ratingKey, [&](std::vector<MediaItem>& episodes) {
                 for (auto& ep : episodes) {
                     if (!ep.watched && ep.viewOffset == 0) {
-                        unwatchedItems.push_back(ep);
+                        unwatchedItems.push_back(std::move(ep));
                         if (maxCount > 0 && (int)unwatchedItems.size() >= maxCount) {
-                            break;
+                            return false;
                         }
                     }
                 }
-            }
+                return true;
+            });
         }
 
         size_t itemCount = unwatchedItems.size();
@@ -2601,26 +2607,18 @@ void MediaDetailView::downloadUnwatched(int maxCount) {
 
         // Queue each unwatched item for download
         auto& mgr = DownloadsManager::getInstance();
+        // Part paths for everything not on the device yet, batched.
+        brls::sync([progressDialog]() {
+            progressDialog->setStatus("Fetching download info...");
+        });
+        auto details = fetchDownloadDetails(unwatchedItems, skipped);
         for (size_t i = 0; i < unwatchedItems.size(); i++) {
             const auto& item = unwatchedItems[i];
 
-            // Skip items already downloaded or in queue
-            if (mgr.isDownloaded(item.ratingKey) ||
-                mgr.getDownload(item.ratingKey) != nullptr) {
-                skipped++;
-                size_t currentIndex = i;
-                brls::sync([progressDialog, currentIndex, itemCount, queued, skipped]() {
-                    progressDialog->setStatus("Queued " + std::to_string(queued) + " of " +
-                                             std::to_string(itemCount) +
-                                             (skipped > 0 ? " (" + std::to_string(skipped) + " skipped)" : ""));
-                    progressDialog->setProgress(0.1f + 0.9f * static_cast<float>(currentIndex + 1) / itemCount);
-                });
-                continue;
-            }
-
-            // Get full details to get the part path
-            MediaItem fullItem;
-            if (client.fetchMediaDetails(item.ratingKey, fullItem) && !fullItem.partPath.empty()) {
+            // Already downloaded / queued, or no part to download
+            auto it = details.find(item.ratingKey);
+            if (it != details.end()) {
+                const MediaItem& fullItem = it->second;
                 std::string itemMediaType = "episode";
 
                 if (mgr.queueDownload(
@@ -2670,219 +2668,220 @@ void MediaDetailView::downloadUnwatched(int maxCount) {
 void MediaDetailView::loadTrackList() {
     if (!m_trackListBox) return;
 
-    asyncRun([this]() {
-        PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> tracks;
+    std::string ratingKey = m_item.ratingKey;
 
-        if (!client.fetchChildren(m_item.ratingKey, tracks)) {
+    struct Tracks {
+        bool ok = false;
+        std::vector<MediaItem> items;
+    };
+    m_tasks.run([ratingKey]() {
+        Tracks t;
+        t.ok = PlexClient::getInstance().fetchChildren(ratingKey, t.items);
+        return t;
+    }).onUI([this](const Tracks& t) {
+        if (!t.ok) {
             brls::Logger::error("Failed to fetch tracks for album");
             return;
         }
+        const std::vector<MediaItem>& tracks = t.items;
+
+        m_trackListBox->clearViews();
+        m_children = tracks;
+
+        for (size_t i = 0; i < tracks.size(); i++) {
+            const auto& track = tracks[i];
+
+            // Create a row for each track (like Suwayomi ChapterCell)
+            auto* row = new brls::Box();
+            row->setAxis(brls::Axis::ROW);
+            row->setJustifyContent(brls::JustifyContent::SPACE_BETWEEN);
+            row->setAlignItems(brls::AlignItems::CENTER);
+            row->setHeight(56);
+            row->setPadding(10, 16, 10, 16);
+            row->setMarginBottom(4);
+            row->setCornerRadius(8);
+            row->setBackgroundColor(nvgRGBA(50, 50, 60, 200));
+            row->setFocusable(true);
+
+            // Left side: track number + title
+            auto* leftBox = new brls::Box();
+            leftBox->setAxis(brls::Axis::ROW);
+            leftBox->setAlignItems(brls::AlignItems::CENTER);
+            leftBox->setGrow(1.0f);
+
+            auto* trackNum = new brls::Label();
+            trackNum->setFontSize(14);
+            trackNum->setMarginRight(12);
+            trackNum->setTextColor(nvgRGBA(150, 150, 150, 255));
+            if (track.index > 0) {
+                trackNum->setText(std::to_string(track.index));
+            } else {
+                trackNum->setText(std::to_string(i + 1));
+            }
+            leftBox->addView(trackNum);
 
-        std::weak_ptr<std::atomic<bool>> aliveWeak = m_alive;
-
-        brls::sync([this, tracks, aliveWeak]() {
-            auto alive = aliveWeak.lock();
-            if (!alive || !alive->load()) return;
-
-            m_trackListBox->clearViews();
-            m_children = tracks;
-
-            for (size_t i = 0; i < tracks.size(); i++) {
-                const auto& track = tracks[i];
-
-                // Create a row for each track (like Suwayomi ChapterCell)
-                auto* row = new brls::Box();
-                row->setAxis(brls::Axis::ROW);
-                row->setJustifyContent(brls::JustifyContent::SPACE_BETWEEN);
-                row->setAlignItems(brls::AlignItems::CENTER);
-                row->setHeight(56);
-                row->setPadding(10, 16, 10, 16);
-                row->setMarginBottom(4);
-                row->setCornerRadius(8);
-                row->setBackgroundColor(nvgRGBA(50, 50, 60, 200));
-                row->setFocusable(true);
-
-                // Left side: track number + title
-                auto* leftBox = new brls::Box();
-                leftBox->setAxis(brls::Axis::ROW);
-                leftBox->setAlignItems(brls::AlignItems::CENTER);
-                leftBox->setGrow(1.0f);
-
-                auto* trackNum = new brls::Label();
-                trackNum->setFontSize(14);
-                trackNum->setMarginRight(12);
-                trackNum->setTextColor(nvgRGBA(150, 150, 150, 255));
-                if (track.index > 0) {
-                    trackNum->setText(std::to_string(track.index));
-                } else {
-                    trackNum->setText(std::to_string(i + 1));
-                }
-                leftBox->addView(trackNum);
-
-                auto* titleLabel = new brls::Label();
-                titleLabel->setFontSize(14);
-                titleLabel->setText(track.title);
-                leftBox->addView(titleLabel);
+            auto* titleLabel = new brls::Label();
+            titleLabel->setFontSize(14);
+            titleLabel->setText(track.title);
+            leftBox->addView(titleLabel);
 
-                row->addView(leftBox);
+            row->addView(leftBox);
 
-                // Right side: button hint + duration
-                auto* rightSide = new brls::Box();
-                rightSide->setAxis(brls::Axis::ROW);
-                rightSide->setAlignItems(brls::AlignItems::CENTER);
+            // Right side: button hint + duration
+            auto* rightSide = new brls::Box();
+            rightSide->setAxis(brls::Axis::ROW);
+            rightSide->setAlignItems(brls::AlignItems::CENTER);
 
-                auto* hintIcon = new brls::Image();
-                std::string hintPath = HintIcons::getResPath(brls::BUTTON_X);
-                if (!hintPath.empty()) {
-                    hintIcon->setImageFromRes(hintPath);
+            auto* hintIcon = new brls::Image();
+            std::string hintPath = HintIcons::getResPath(brls::BUTTON_X);
+            if (!hintPath.empty()) {
+                hintIcon->setImageFromRes(hintPath);
+            }
+            hintIcon->setWidth(16);
+            hintIcon->setHeight(16);
+            hintIcon->setMarginRight(2);
+            hintIcon->setVisibility(brls::Visibility::INVISIBLE);
+            // Refresh the icon if the input source flips (desktop / android).
+            // Guard with m_alive so a flip after this view is destroyed
+            // doesn't dereference the freed brls::Image.
+            std::weak_ptr<std::atomic<bool>> aliveWeak = m_alive;
+            HintIcons::onSourceChanged([aliveWeak, hintIcon]() {
+                auto a = aliveWeak.lock();
+                if (!a || !a->load()) return;
+                std::string p = HintIcons::getResPath(brls::BUTTON_X);
+                if (!p.empty()) hintIcon->setImageFromRes(p);
+            });
+            rightSide->addView(hintIcon);
+
+            auto* hintLabel = new brls::Label();
+            hintLabel->setFontSize(10);
+            hintLabel->setTextColor(nvgRGBA(150, 150, 180, 180));
+            hintLabel->setText("DL");
+            hintLabel->setMarginRight(10);
+            hintLabel->setVisibility(brls::Visibility::INVISIBLE);
+            rightSide->addView(hintLabel);
+
+            // Show hint on focus, hide previous (like Suwayomi chapter icon pattern)
+            brls::Image* capturedHintIcon = hintIcon;
+            brls::Label* capturedHintLabel = hintLabel;
+            row->getFocusEvent()->subscribe([this, capturedHintIcon, capturedHintLabel](brls::View*) {
+                // Hide previously focused hint
+                if (m_currentFocusedHint && m_currentFocusedHint != capturedHintIcon) {
+                    m_currentFocusedHint->setVisibility(brls::Visibility::INVISIBLE);
                 }
-                hintIcon->setWidth(16);
-                hintIcon->setHeight(16);
-                hintIcon->setMarginRight(2);
-                hintIcon->setVisibility(brls::Visibility::INVISIBLE);
-                // Refresh the icon if the input source flips (desktop / android).
-                // Guard with m_alive so a flip after this view is destroyed
-                // doesn't dereference the freed brls::Image.
-                std::weak_ptr<std::atomic<bool>> aliveWeak = m_alive;
-                HintIcons::onSourceChanged([aliveWeak, hintIcon]() {
-                    auto a = aliveWeak.lock();
-                    if (!a || !a->load()) return;
-                    std::string p = HintIcons::getResPath(brls::BUTTON_X);
-                    if (!p.empty()) hintIcon->setImageFromRes(p);
-                });
-                rightSide->addView(hintIcon);
-
-                auto* hintLabel = new brls::Label();
-                hintLabel->setFontSize(10);
-                hintLabel->setTextColor(nvgRGBA(150, 150, 180, 180));
-                hintLabel->setText("DL");
-                hintLabel->setMarginRight(10);
-                hintLabel->setVisibility(brls::Visibility::INVISIBLE);
-                rightSide->addView(hintLabel);
-
-                // Show hint on focus, hide previous (like Suwayomi chapter icon pattern)
-                brls::Image* capturedHintIcon = hintIcon;
-                brls::Label* capturedHintLabel = hintLabel;
-                row->getFocusEvent()->subscribe([this, capturedHintIcon, capturedHintLabel](brls::View*) {
-                    // Hide previously focused hint
-                    if (m_currentFocusedHint && m_currentFocusedHint != capturedHintIcon) {
-                        m_currentFocusedHint->setVisibility(brls::Visibility::INVISIBLE);
-                    }
-                    if (m_currentFocusedHintLabel && m_currentFocusedHintLabel != capturedHintLabel) {
-                        m_currentFocusedHintLabel->setVisibility(brls::Visibility::INVISIBLE);
-                    }
-                    // Show current hint
-                    capturedHintIcon->setVisibility(brls::Visibility::VISIBLE);
-                    capturedHintLabel->setVisibility(brls::Visibility::VISIBLE);
-                    m_currentFocusedHint = capturedHintIcon;
-                    m_currentFocusedHintLabel = capturedHintLabel;
-                });
-
-                if (track.duration > 0) {
-                    auto* durLabel = new brls::Label();
-                    durLabel->setFontSize(12);
-                    durLabel->setTextColor(nvgRGBA(150, 150, 150, 255));
-                    int totalSec = track.duration / 1000;
-                    int min = totalSec / 60;
-                    int sec = totalSec % 60;
-                    char durStr[16];
-                    snprintf(durStr, sizeof(durStr), "%d:%02d", min, sec);
-                    durLabel->setText(durStr);
-                    rightSide->addView(durLabel);
+                if (m_currentFocusedHintLabel && m_currentFocusedHintLabel != capturedHintLabel) {
+                    m_currentFocusedHintLabel->setVisibility(brls::Visibility::INVISIBLE);
                 }
+                // Show current hint
+                capturedHintIcon->setVisibility(brls::Visibility::VISIBLE);
+                capturedHintLabel->setVisibility(brls::Visibility::VISIBLE);
+                m_currentFocusedHint = capturedHintIcon;
+                m_currentFocusedHintLabel = capturedHintLabel;
+            });
 
-                row->addView(rightSide);
+            if (track.duration > 0) {
+                auto* durLabel = new brls::Label();
+                durLabel->setFontSize(12);
+                durLabel->setTextColor(nvgRGBA(150, 150, 150, 255));
+                int totalSec = track.duration / 1000;
+                int min = totalSec / 60;
+                int sec = totalSec % 60;
+                char durStr[16];
+                snprintf(durStr, sizeof(durStr), "%d:%02d", min, sec);
+                durLabel->setText(durStr);
+                rightSide->addView(durLabel);
+            }
 
-                // Click to perform default track action
-                MediaItem capturedTrack = track;
-                row->registerClickAction([this, capturedTrack, i](brls::View* view) {
-                    performTrackAction(capturedTrack, i);
-                    return true;
-                });
-                row->addGestureRecognizer(new brls::TapGestureRecognizer(row));
+            row->addView(rightSide);
 
-                // START button always shows track action dialog
-                row->registerAction("Options", brls::ControllerButton::BUTTON_START, [this, capturedTrack, i](brls::View* view) {
-                    showTrackActionDialog(capturedTrack, i);
-                    return true;
-                });
-                row->addGestureRecognizer(new LongPressGestureRecognizer(
-                    row, [this, capturedTrack, i](LongPressGestureStatus status) {
-                        if (status.state == brls::GestureState::START) {
-                            showTrackActionDialog(capturedTrack, i);
-                        }
-                    }));
+            // Click to perform default track action
+            MediaItem capturedTrack = track;
+            row->registerClickAction([this, capturedTrack, i](brls::View* view) {
+                performTrackAction(capturedTrack, i);
+                return true;
+            });
+            row->addGestureRecognizer(new brls::TapGestureRecognizer(row));
 
-                // Square button (X on PS Vita) adds to download queue
-                row->registerAction("Download", brls::ControllerButton::BUTTON_X, [this, capturedTrack](brls::View* view) {
-                    // Create a temporary copy to download
-                    MediaItem dlItem = capturedTrack;
-                    if (DownloadsManager::getInstance().isDownloaded(dlItem.ratingKey)) {
-                        brls::Application::notify("Already downloaded");
-                    } else {
-                        // Fetch full details for partPath
-                        asyncRun([this, dlItem]() {
-                            PlexClient& client = PlexClient::getInstance();
-                            MediaItem fullItem;
-                            if (client.fetchMediaDetails(dlItem.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                                bool queued = DownloadsManager::getInstance().queueDownload(
-                                    fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                                    fullItem.duration, "track",
-                                    fullItem.grandparentTitle, 0, fullItem.index,
-                                    fullItem.thumb);
-                                brls::sync([queued, fullItem]() {
-                                    if (queued) {
-                                        DownloadsManager::getInstance().startDownloads();
-                                        brls::Application::notify("Downloading: " + fullItem.title);
-                                    } else {
-                                        brls::Application::notify("Failed to queue download");
-                                    }
-                                });
-                            } else {
-                                brls::sync([]() {
-                                    brls::Application::notify("Could not get download info");
-                                });
-                            }
-                        });
+            // START button always shows track action dialog
+            row->registerAction("Options", brls::ControllerButton::BUTTON_START, [this, capturedTrack, i](brls::View* view) {
+                showTrackActionDialog(capturedTrack, i);
+                return true;
+            });
+            row->addGestureRecognizer(new LongPressGestureRecognizer(
+                row, [this, capturedTrack, i](LongPressGestureStatus status) {
+                    if (status.state == brls::GestureState::START) {
+                        showTrackActionDialog(capturedTrack, i);
                     }
-                    return true;
-                });
-
-                m_trackListBox->addView(row);
-            }
+                }));
 
-            // Set up focus transfer for album track list. Only the
-            // FIRST track gets a custom UP route — every other track
-            // keeps default vertical nav (UP -> previous track), so
-            // pressing UP from track 5 actually goes to track 4
-            // instead of jumping to the description (the Android TV
-            // bug: the for-loop below used to override UP on EVERY
-            // child, breaking track-to-track navigation entirely).
-            if (!m_trackListBox->getChildren().empty()) {
-                brls::View* firstTrack = m_trackListBox->getChildren().front();
-
-                if (m_summaryLabel && m_summaryLabel->isFocusable() && !m_fullDescription.empty()) {
-                    // Description exists: DOWN from description goes to first track
-                    m_summaryLabel->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
-                    // UP from the first track goes to description; tracks
-                    // 2..N keep default behaviour (UP -> previous track).
-                    firstTrack->setCustomNavigationRoute(brls::FocusDirection::UP, m_summaryLabel);
+            // Square button (X on PS Vita) adds to download queue
+            row->registerAction("Download", brls::ControllerButton::BUTTON_X, [this, capturedTrack](brls::View* view) {
+                // Create a temporary copy to download
+                MediaItem dlItem = capturedTrack;
+                if (DownloadsManager::getInstance().isDownloaded(dlItem.ratingKey)) {
+                    brls::Application::notify("Already downloaded");
                 } else {
-                    // No description: transfer focus to first track to avoid focus errors
-                    brls::Application::giveFocus(firstTrack);
+                    // Fetch full details for partPath
+                    asyncRun([this, dlItem]() {
+                        PlexClient& client = PlexClient::getInstance();
+                        MediaItem fullItem;
+                        if (client.fetchMediaDetails(dlItem.ratingKey, fullItem) && !fullItem.partPath.empty()) {
+                            bool queued = DownloadsManager::getInstance().queueDownload(
+                                fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                                fullItem.duration, "track",
+                                fullItem.grandparentTitle, 0, fullItem.index,
+                                fullItem.thumb);
+                            brls::sync([queued, fullItem]() {
+                                if (queued) {
+                                    DownloadsManager::getInstance().startDownloads();
+                                    brls::Application::notify("Downloading: " + fullItem.title);
+                                } else {
+                                    brls::Application::notify("Failed to queue download");
+                                }
+                            });
+                        } else {
+                            brls::sync([]() {
+                                brls::Application::notify("Could not get download info");
+                            });
+                        }
+                    });
+                }
+                return true;
+            });
 
-                    // UP from the first track goes to play button if it exists
-                    if (m_playButton) {
-                        firstTrack->setCustomNavigationRoute(brls::FocusDirection::UP, m_playButton);
-                        m_playButton->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
-                    }
-                    if (m_downloadButton) {
-                        m_downloadButton->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
-                    }
+            m_trackListBox->addView(row);
+        }
+
+        // Set up focus transfer for album track list. Only the
+        // FIRST track gets a custom UP route — every other track
+        // keeps default vertical nav (UP -> previous track), so
+        // pressing UP from track 5 actually goes to track 4
+        // instead of jumping to the description (the Android TV
+        // bug: the for-loop below used to override UP on EVERY
+        // child, breaking track-to-track navigation entirely).
+        if (!m_trackListBox->getChildren().empty()) {
+            brls::View* firstTrack = m_trackListBox->getChildren().front();
+
+            if (m_summaryLabel && m_summaryLabel->isFocusable() && !m_fullDescription.empty()) {
+                // Description exists: DOWN from description goes to first track
+                m_summaryLabel->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
+                // UP from the first track goes to description; tracks
+                // 2..N keep default behaviour (UP -> previous track).
+                firstTrack->setCustomNavigationRoute(brls::FocusDirection::UP, m_summaryLabel);
+            } else {
+                // No description: transfer focus to first track to avoid focus errors
+                brls::Application::giveFocus(firstTrack);
+
+                // UP from the first track goes to play button if it exists
+                if (m_playButton) {
+                    firstTrack->setCustomNavigationRoute(brls::FocusDirection::UP, m_playButton);
+                    m_playButton->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
+                }
+                if (m_downloadButton) {
+                    m_downloadButton->setCustomNavigationRoute(brls::FocusDirection::DOWN, firstTrack);
                 }
             }
-        });
+        }
     });
 }
 
@@ -3856,52 +3855,46 @@ void MediaDetailView::showShowContextMenuStatic(const MediaItem& show) {
             [capturedShow](brls::View*) {
             asyncRun([capturedShow]() {
                 PlexClient& client = PlexClient::getInstance();
-                std::vector<MediaItem> seasons;
-                if (!client.fetchChildren(capturedShow.ratingKey, seasons) || seasons.empty()) return;
+                std::vector<MediaItem> episodes;
+                if (!client.fetchAllLeaves(capturedShow.ratingKey, episodes) || episodes.empty()) return;
 
                 // Find the first in-progress or unwatched episode
-                for (const auto& season : seasons) {
-                    std::vector<MediaItem> episodes;
-                    if (!client.fetchChildren(season.ratingKey, episodes)) continue;
-                    for (const auto& ep : episodes) {
-                        // Episode with viewOffset = in-progress, play it
-                        if (ep.viewOffset > 0) {
-                            int totalSec = ep.viewOffset / 1000;
-                            int minLeft = ((ep.duration - ep.viewOffset) / 1000) / 60;
-                            char info[64];
-                            snprintf(info, sizeof(info), "S%02dE%02d - %dm left",
-                                     ep.parentIndex, ep.index, minLeft);
-                            std::string infoStr = info;
-                            brls::sync([ep, infoStr]() {
-                                brls::Application::notify("Resuming " + infoStr);
-                                Application::getInstance().pushPlayerActivity(ep.ratingKey);
-                            });
-                            return;
-                        }
-                        // First unwatched episode
-                        if (!ep.watched) {
-                            char info[64];
-                            snprintf(info, sizeof(info), "S%02dE%02d",
-                                     ep.parentIndex, ep.index);
-                            std::string infoStr = info;
-                            brls::sync([ep, infoStr]() {
-                                brls::Application::notify("Playing " + infoStr);
-                                Application::getInstance().pushPlayerActivity(ep.ratingKey);
-                            });
-                            return;
-                        }
+                for (const auto& ep : episodes) {
+                    // Episode with viewOffset = in-progress, play it
+                    if (ep.viewOffset > 0) {
+                        int totalSec = ep.viewOffset / 1000;
+                        int minLeft = ((ep.duration - ep.viewOffset) / 1000) / 60;
+                        char info[64];
+                        snprintf(info, sizeof(info), "S%02dE%02d - %dm left",
+                                 ep.parentIndex, ep.index, minLeft);
+                        std::string infoStr = info;
+                        brls::sync([ep, infoStr]() {
+                            brls::Application::notify("Resuming " + infoStr);
+                            Application::getInstance().pushPlayerActivity(ep.ratingKey);
+                        });
+                        return;
+                    }
+                    // First unwatched episode
+                    if (!ep.watched) {
+                        char info[64];
+                        snprintf(info, sizeof(info), "S%02dE%02d",
+                                 ep.parentIndex, ep.index);
+                        std::string infoStr = info;
+                        brls::sync([ep, infoStr]() {
+                            brls::Application::notify("Playing " + infoStr);
+                            Application::getInstance().pushPlayerActivity(ep.ratingKey);
+                        });
+                        return;
                     }
                 }
                 // All watched - play first episode
                 brls::sync([]() {
                     brls::Application::notify("All episodes watched, restarting");
                 });
-                std::vector<MediaItem> firstEps;
-                if (client.fetchChildren(seasons[0].ratingKey, firstEps) && !firstEps.empty()) {
-                    brls::sync([firstEps]() {
-                        Application::getInstance().pushPlayerActivity(firstEps[0].ratingKey);
-                    });
-                }
+                std::string firstKey = episodes[0].ratingKey;
+                brls::sync([firstKey]() {
+                    Application::getInstance().pushPlayerActivity(firstKey);
+                });
             });
             return true;
         }});
@@ -3914,33 +3907,23 @@ void MediaDetailView::showShowContextMenuStatic(const MediaItem& show) {
         asyncRun([capturedShow]() {
             PlexClient& client = PlexClient::getInstance();
             auto& mgr = DownloadsManager::getInstance();
-            std::vector<MediaItem> seasons;
+            std::vector<MediaItem> episodes;
             int queued = 0;
             int skipped = 0;
-            if (client.fetchChildren(capturedShow.ratingKey, seasons)) {
-                for (const auto& season : seasons) {
-                    std::vector<MediaItem> episodes;
-                    if (client.fetchChildren(season.ratingKey, episodes)) {
-                        for (const auto& ep : episodes) {
-                            if (mgr.isDownloaded(ep.ratingKey) ||
-                                mgr.getDownload(ep.ratingKey) != nullptr) {
-                                skipped++;
-                                continue;
-                            }
-                            MediaItem fullItem;
-                            if (client.fetchMediaDetails(ep.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                                if (mgr.queueDownload(
-                                    fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                                    fullItem.duration, "episode", capturedShow.title,
-                                    fullItem.parentIndex, fullItem.index,
-                                    fullItem.grandparentThumb.empty() ? capturedShow.thumb : fullItem.grandparentThumb,
-                                    DownloadGroupType::SHOW, capturedShow.ratingKey,
-                                    capturedShow.title, capturedShow.thumb)) {
-                                    queued++;
-                                }
-                            }
-                        }
-                    }
+            client.fetchAllLeaves(capturedShow.ratingKey, episodes);
+            auto details = fetchDownloadDetails(episodes, skipped);
+            for (const auto& ep : episodes) {
+                auto it = details.find(ep.ratingKey);
+                if (it == details.end()) continue;
+                const MediaItem& fullItem = it->second;
+                if (mgr.queueDownload(
+                    fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                    fullItem.duration, "episode", capturedShow.title,
+                    fullItem.parentIndex, fullItem.index,
+                    fullItem.grandparentThumb.empty() ? capturedShow.thumb : fullItem.grandparentThumb,
+                    DownloadGroupType::SHOW, capturedShow.ratingKey,
+                    capturedShow.title, capturedShow.thumb)) {
+                    queued++;
                 }
             }
             mgr.startDownloads();
@@ -3958,35 +3941,27 @@ void MediaDetailView::showShowContextMenuStatic(const MediaItem& show) {
         asyncRun([capturedShow]() {
             PlexClient& client = PlexClient::getInstance();
             auto& mgr = DownloadsManager::getInstance();
-            std::vector<MediaItem> seasons;
+            std::vector<MediaItem> episodes;
             int queued = 0;
             int skipped = 0;
-            if (client.fetchChildren(capturedShow.ratingKey, seasons)) {
-                for (const auto& season : seasons) {
-                    std::vector<MediaItem> episodes;
-                    if (client.fetchChildren(season.ratingKey, episodes)) {
-                        for (const auto& ep : episodes) {
-                            if (!ep.watched && ep.viewOffset == 0) {
-                                if (mgr.isDownloaded(ep.ratingKey) ||
-                                    mgr.getDownload(ep.ratingKey) != nullptr) {
-                                    skipped++;
-                                    continue;
-                                }
-                                MediaItem fullItem;
-                                if (client.fetchMediaDetails(ep.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                                    if (mgr.queueDownload(
-                                        fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                                        fullItem.duration, "episode", capturedShow.title,
-                                        fullItem.parentIndex, fullItem.index,
-                                        fullItem.grandparentThumb.empty() ? capturedShow.thumb : fullItem.grandparentThumb,
-                                        DownloadGroupType::SHOW, capturedShow.ratingKey,
-                                        capturedShow.title, capturedShow.thumb)) {
-                                        queued++;
-                                    }
-                                }
-                            }
-                        }
-                    }
+            if (client.fetchAllLeaves(capturedShow.ratingKey, episodes)) {
+                episodes.erase(std::remove_if(episodes.begin(), episodes.end(),
+                    [](const MediaItem& ep) { return ep.watched || ep.viewOffset != 0; }),
+                    episodes.end());
+            }
+            auto details = fetchDownloadDetails(episodes, skipped);
+            for (const auto& ep : episodes) {
+                auto it = details.find(ep.ratingKey);
+                if (it == details.end()) continue;
+                const MediaItem& fullItem = it->second;
+                if (mgr.queueDownload(
+                    fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                    fullItem.duration, "episode", capturedShow.title,
+                    fullItem.parentIndex, fullItem.index,
+                    fullItem.grandparentThumb.empty() ? capturedShow.thumb : fullItem.grandparentThumb,
+                    DownloadGroupType::SHOW, capturedShow.ratingKey,
+                    capturedShow.title, capturedShow.thumb)) {
+                    queued++;
                 }
             }
             mgr.startDownloads();
@@ -4029,24 +4004,20 @@ void MediaDetailView::showShowContextMenuStatic(const MediaItem& show) {
                             std::vector<MediaItem> episodes;
                             int queued = 0;
                             int skipped = 0;
-                            if (client.fetchChildren(capturedSeason.ratingKey, episodes)) {
+                            if (client.fetchAllLeaves(capturedSeason.ratingKey, episodes)) {
+                                auto details = fetchDownloadDetails(episodes, skipped);
                                 for (const auto& ep : episodes) {
-                                    if (mgr.isDownloaded(ep.ratingKey) ||
-                                        mgr.getDownload(ep.ratingKey) != nullptr) {
-                                        skipped++;
-                                        continue;
-                                    }
-                                    MediaItem fullItem;
-                                    if (client.fetchMediaDetails(ep.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                                        if (mgr.queueDownload(
-                                            fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                                            fullItem.duration, "episode", showTitle,
-                                            fullItem.parentIndex, fullItem.index,
-                                            fullItem.grandparentThumb.empty() ? showThumb : fullItem.grandparentThumb,
-                                            DownloadGroupType::SHOW, showKey,
-                                            showTitle, showThumb)) {
-                                            queued++;
-                                        }
+                                    auto it = details.find(ep.ratingKey);
+                                    if (it == details.end()) continue;
+                                    const MediaItem& fullItem = it->second;
+                                    if (mgr.queueDownload(
+                                        fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                                        fullItem.duration, "episode", showTitle,
+                                        fullItem.parentIndex, fullItem.index,
+                                        fullItem.grandparentThumb.empty() ? showThumb : fullItem.grandparentThumb,
+                                        DownloadGroupType::SHOW, showKey,
+                                        showTitle, showThumb)) {
+                                        queued++;
                                     }
                                 }
                             }
@@ -4170,24 +4141,20 @@ void MediaDetailView::showSeasonContextMenuStatic(const MediaItem& season) {
             int queued = 0;
             int skipped = 0;
             std::string showTitle = capturedSeason.parentTitle.empty() ? capturedSeason.title : capturedSeason.parentTitle;
-            if (client.fetchChildren(capturedSeason.ratingKey, episodes)) {
+            if (client.fetchAllLeaves(capturedSeason.ratingKey, episodes)) {
+                auto details = fetchDownloadDetails(episodes, skipped);
                 for (const auto& ep : episodes) {
-                    if (mgr.isDownloaded(ep.ratingKey) ||
-                        mgr.getDownload(ep.ratingKey) != nullptr) {
-                        skipped++;
-                        continue;
-                    }
-                    MediaItem fullItem;
-                    if (client.fetchMediaDetails(ep.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                        if (mgr.queueDownload(
-                            fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                            fullItem.duration, "episode", showTitle,
-                            fullItem.parentIndex, fullItem.index,
-                            fullItem.grandparentThumb.empty() ? capturedSeason.thumb : fullItem.grandparentThumb,
-                            DownloadGroupType::SHOW, capturedSeason.parentRatingKey.empty() ? capturedSeason.ratingKey : capturedSeason.parentRatingKey,
-                            showTitle, capturedSeason.parentThumb.empty() ? capturedSeason.thumb : capturedSeason.parentThumb)) {
-                            queued++;
-                        }
+                    auto it = details.find(ep.ratingKey);
+                    if (it == details.end()) continue;
+                    const MediaItem& fullItem = it->second;
+                    if (mgr.queueDownload(
+                        fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                        fullItem.duration, "episode", showTitle,
+                        fullItem.parentIndex, fullItem.index,
+                        fullItem.grandparentThumb.empty() ? capturedSeason.thumb : fullItem.grandparentThumb,
+                        DownloadGroupType::SHOW, capturedSeason.parentRatingKey.empty() ? capturedSeason.ratingKey : capturedSeason.parentRatingKey,
+                        showTitle, capturedSeason.parentThumb.empty() ? capturedSeason.thumb : capturedSeason.parentThumb)) {
+                        queued++;
                     }
                 }
             }
@@ -4211,26 +4178,23 @@ void MediaDetailView::showSeasonContextMenuStatic(const MediaItem& season) {
             int queued = 0;
             int skipped = 0;
             std::string showTitle = capturedSeason.parentTitle.empty() ? capturedSeason.title : capturedSeason.parentTitle;
-            if (client.fetchChildren(capturedSeason.ratingKey, episodes)) {
+            if (client.fetchAllLeaves(capturedSeason.ratingKey, episodes)) {
+                episodes.erase(std::remove_if(episodes.begin(), episodes.end(),
+                    [](const MediaItem& ep) { return ep.watched || ep.viewOffset != 0; }),
+                    episodes.end());
+                auto details = fetchDownloadDetails(episodes, skipped);
                 for (const auto& ep : episodes) {
-                    if (!ep.watched && ep.viewOffset == 0) {
-                        if (mgr.isDownloaded(ep.ratingKey) ||
-                            mgr.getDownload(ep.ratingKey) != nullptr) {
-                            skipped++;
-                            continue;
-                        }
-                        MediaItem fullItem;
-                        if (client.fetchMediaDetails(ep.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                            if (mgr.queueDownload(
-                                fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                                fullItem.duration, "episode", showTitle,
-                                fullItem.parentIndex, fullItem.index,
-                                fullItem.grandparentThumb.empty() ? capturedSeason.thumb : fullItem.grandparentThumb,
-                                DownloadGroupType::SHOW, capturedSeason.parentRatingKey.empty() ? capturedSeason.ratingKey : capturedSeason.parentRatingKey,
-                                showTitle, capturedSeason.parentThumb.empty() ? capturedSeason.thumb : capturedSeason.parentThumb)) {
-                                queued++;
-                            }
-                        }
+                    auto it = details.find(ep.ratingKey);
+                    if (it == details.end()) continue;
+                    const MediaItem& fullItem = it->second;
+                    if (mgr.queueDownload(
+                        fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                        fullItem.duration, "episode", showTitle,
+                        fullItem.parentIndex, fullItem.index,
+                        fullItem.grandparentThumb.empty() ? capturedSeason.thumb : fullItem.grandparentThumb,
+                        DownloadGroupType::SHOW, capturedSeason.parentRatingKey.empty() ? capturedSeason.ratingKey : capturedSeason.parentRatingKey,
+                        showTitle, capturedSeason.parentThumb.empty() ? capturedSeason.thumb : capturedSeason.parentThumb)) {
+                        queued++;
                     }
                 }
             }
@@ -4385,25 +4349,21 @@ void MediaDetailView::showAlbumContextMenuStatic(const MediaItem& album) {
             int queued = 0;
             int skipped = 0;
 
-            if (client.fetchChildren(capturedAlbum.ratingKey, tracks)) {
+            if (client.fetchAllLeaves(capturedAlbum.ratingKey, tracks)) {
+                auto details = fetchDownloadDetails(tracks, skipped);
                 for (const auto& track : tracks) {
-                    if (mgr.isDownloaded(track.ratingKey) ||
-                        mgr.getDownload(track.ratingKey) != nullptr) {
-                        skipped++;
-                        continue;
-                    }
-                    MediaItem fullItem;
-                    if (client.fetchMediaDetails(track.ratingKey, fullItem) && !fullItem.partPath.empty()) {
-                        if (mgr.queueDownload(
-                            fullItem.ratingKey, fullItem.title, fullItem.partPath,
-                            fullItem.duration, "track",
-                            capturedAlbum.title, fullItem.parentIndex, fullItem.index,
-                            fullItem.thumb,
-                            DownloadGroupType::ALBUM, capturedAlbum.ratingKey,
-                            capturedAlbum.title, capturedAlbum.thumb,
-                            fullItem.parentTitle)) {
-                            queued++;
-                        }
+                    auto it = details.find(track.ratingKey);
+                    if (it == details.end()) continue;
+                    const MediaItem& fullItem = it->second;
+                    if (mgr.queueDownload(
+                        fullItem.ratingKey, fullItem.title, fullItem.partPath,
+                        fullItem.duration, "track",
+                        capturedAlbum.title, fullItem.parentIndex, fullItem.index,
+                        fullItem.thumb,
+                        DownloadGroupType::ALBUM, capturedAlbum.ratingKey,
+                        capturedAlbum.title, capturedAlbum.thumb,
+                        fullItem.parentTitle)) {
+                        queued++;
                     }
                 }
             }
@@ -4793,19 +4753,20 @@ void MediaDetailView::loadStreams() {
     if (!m_audioRow && !m_subtitleRow) return;  // movie-only, see ctor
 
     std::string ratingKey = m_item.ratingKey;
-    auto alive = m_alive;
-    asyncRun([this, alive, ratingKey]() {
-        std::vector<PlexStream> streams;
+    struct Streams {
+        bool ok = false;
         int partId = 0;
-        PlexClient& client = PlexClient::getInstance();
-        if (!client.fetchStreams(ratingKey, streams, partId)) return;
-
-        brls::sync([this, alive, streams, partId]() {
-            if (!alive->load()) return;
-            m_streams = streams;
-            m_partId  = partId;
-            updateStreamRowLabels();
-        });
+        std::vector<PlexStream> streams;
+    };
+    m_tasks.run([ratingKey]() {
+        Streams r;
+        r.ok = PlexClient::getInstance().fetchStreams(ratingKey, r.streams, r.partId);
+        return r;
+    }).onUI([this](const Streams& r) {
+        if (!r.ok) return;
+        m_streams = r.streams;
+        m_partId  = r.partId;
+        updateStreamRowLabels();
     });
 }
 
@@ -3,6 +3,7 @@
  */
 
 #include "view/media_item_cell.hpp"
+#include "view/detail_prefetcher.hpp"
 #include "app/plex_client.hpp"
 #include "app/application.hpp"
 #include "app/plex_palette.hpp"
@@ -521,6 +522,7 @@ void MediaItemCell::onFocusGained() {
     this->setBorderColor(vitaplex::palette::focusHalo);
     this->setBorderThickness(2.0f);
     updateFocusInfo(true);
+    DetailPrefetcher::onFocus(m_item);
 }
 
 void MediaItemCell::onFocusLost() {
@@ -535,6 +537,7 @@ void MediaItemCell::onFocusLost() {
     this->setBorderThickness(0.0f);
     m_pressed = false;
     updateFocusInfo(false);
+    DetailPrefetcher::onBlur();
 }
 
 void MediaItemCell::updateFocusInfo(bool focused) {
@@ -1,7 +1,9 @@
 /**
  * VitaPlex - Recycling Grid implementation
- * Infinite scroll: automatically fetches next page when user navigates
- * to the last row. Server-side pagination keeps memory low.
+ * Infinite scroll: asks for the next page while the rows below the viewport
+ * still outlast its expected arrival at the current scroll speed, or at the
+ * latest when the user navigates off the last row. Server-side pagination
+ * keeps memory low.
  */
 
 #include "view/recycling_grid.hpp"
@@ -10,6 +12,8 @@
 #include "view/long_press_gesture.hpp"
 #include "platform/platform.hpp"
 
+#include <algorithm>
+
 namespace vitaplex {
 
 namespace {
@@ -77,7 +81,13 @@ RecyclingGrid::~RecyclingGrid() {
 
 void RecyclingGrid::setDataSource(const std::vector<MediaItem>& items) {
     m_items = items;
+    m_serialBase = 0;
     m_loading = false;
+    m_loadingPrevious = false;
+    m_lastPageItems = 0;
+    m_defaultFocusIndex = SIZE_MAX;
+    m_scrollSpeed = 0.0f;
+    m_lastSampleUsec = 0;
     rebuildGrid();
 }
 
@@ -87,28 +97,73 @@ void RecyclingGrid::appendItems(const std::vector<MediaItem>& newItems) {
         return;
     }
 
-    size_t oldSize = m_items.size();
+    size_t next = m_items.size();
     m_items.insert(m_items.end(), newItems.begin(), newItems.end());
-
-    // Render the new items continuing from where we left off
-    brls::Box* currentRow = nullptr;
-    int itemsInRow = (int)(oldSize % m_columns);
-    if (itemsInRow > 0 && m_contentBox->getChildren().size() > 0) {
-        auto& children = m_contentBox->getChildren();
-        currentRow = dynamic_cast<brls::Box*>(children.back());
-        if (!currentRow) itemsInRow = 0;
-    } else {
-        itemsInRow = 0;
+    m_lastPageItems = newItems.size();
+
+    // Top up the trailing partial row in place. At most m_columns - 1
+    // cells, and the relayout each one triggers only re-measures the last
+    // page (earlier pages are clean Yoga subtrees), so this stays cheap.
+    if (!m_rows.empty() && !m_pages.empty()) {
+        brls::Box* lastRow = m_rows.back();
+        while (next < m_items.size() &&
+               lastRow->getChildren().size() < (size_t)m_columns) {
+            addCellToRow(lastRow, next++);
+        }
     }
 
-    for (size_t i = oldSize; i < m_items.size(); i++) {
-        addCellForItem(currentRow, itemsInRow, i);
+    // Everything else goes into a fresh page built off-tree and attached
+    // with one addView(). Existing rows/cells are not touched, so the
+    // focused cell and the scroll offset stay exactly where they were.
+    if (next < m_items.size()) {
+        brls::Box* page = buildPage(next, m_items.size());
+        m_contentBox->addView(page);
+        m_pages.push_back(page);
     }
 
     m_renderedCount = m_items.size();
     m_loading = false;
 }
 
+void RecyclingGrid::prependItems(const std::vector<MediaItem>& newItems) {
+    m_loadingPrevious = false;
+    if (newItems.empty()) return;
+
+    const size_t cols = m_columns > 0 ? (size_t)m_columns : 1;
+    m_items.insert(m_items.begin(), newItems.begin(), newItems.end());
+    m_serialBase -= (long long)newItems.size();
+
+    // A partial row would shift every cell below it; only a rebuild fixes
+    // that. Happens after a column-count change mid-window, nothing else.
+    if (m_rows.empty() || newItems.size() % cols != 0) {
+        rebuildGrid();
+        return;
+    }
+
+    // Read the pitch before the insert; every row is the same height.
+    const float pitch = m_rows[0]->getHeight() +
+                        (float)platform::getImageConstraints().gridCellSpacing;
+
+    // buildPage() appends to m_rows / m_cells; set the existing ones aside
+    // so the new rows land in front of them.
+    std::vector<brls::Box*> rows = std::move(m_rows);
+    std::vector<MediaItemCell*> cells = std::move(m_cells);
+    m_rows.clear();
+    m_cells.clear();
+    brls::Box* page = buildPage(0, newItems.size());
+    m_rows.insert(m_rows.end(), rows.begin(), rows.end());
+    m_cells.insert(m_cells.end(), cells.begin(), cells.end());
+
+    m_contentBox->addView(page, 0);
+    m_pages.insert(m_pages.begin(), page);
+    m_renderedCount = m_items.size();
+    m_lastSampleUsec = 0;   // the offset jump below isn't scrolling
+
+    // The new rows push everything down; scroll by as much so the rows on
+    // screen (and the focused cell) stay put.
+    setContentOffsetY(getContentOffsetY() + pitch * (float)(newItems.size() / cols), false);
+}
+
 void RecyclingGrid::setOnItemSelected(std::function<void(const MediaItem&)> callback) {
     m_onItemSelected = callback;
 }
@@ -126,6 +181,15 @@ void RecyclingGrid::setHasMore(bool hasMore) {
     m_loading = false;
 }
 
+void RecyclingGrid::setOnLoadPrevious(std::function<void()> callback) {
+    m_onLoadPrevious = callback;
+}
+
+void RecyclingGrid::setHasLess(bool hasLess) {
+    m_hasLess = hasLess;
+    m_loadingPrevious = false;
+}
+
 void RecyclingGrid::scrollToItemIndex(size_t index, bool animated) {
     if (m_columns <= 0 || m_rows.empty()) return;
 
@@ -147,6 +211,29 @@ void RecyclingGrid::scrollToItemIndex(size_t index, bool animated) {
     setContentOffsetY(target, animated);
 }
 
+size_t RecyclingGrid::firstVisibleItemIndex() {
+    if (m_columns <= 0) return 0;
+    // Rows report on-screen Y (scroll already applied), so the first row
+    // whose bottom edge clears the frame's top is the topmost visible one.
+    const float top = this->getY();
+    for (size_t r = 0; r < m_rows.size(); r++) {
+        brls::Box* row = m_rows[r];
+        if (row && row->getY() + row->getHeight() > top)
+            return r * (size_t)m_columns;
+    }
+    return 0;
+}
+
+brls::View* RecyclingGrid::getDefaultFocus() {
+    if (m_defaultFocusIndex < m_cells.size()) {
+        brls::View* cell = m_cells[m_defaultFocusIndex];
+        m_defaultFocusIndex = SIZE_MAX;
+        return cell;
+    }
+    m_defaultFocusIndex = SIZE_MAX;
+    return brls::ScrollingFrame::getDefaultFocus();
+}
+
 brls::View* RecyclingGrid::getNextFocus(brls::FocusDirection direction, brls::View* currentView) {
     brls::View* next = brls::ScrollingFrame::getNextFocus(direction, currentView);
 
@@ -170,28 +257,59 @@ brls::View* RecyclingGrid::getNextFocus(brls::FocusDirection direction, brls::Vi
         });
     }
 
+    // Same at the top of a window that doesn't start at the first item.
+    // Focus holds on the current cell rather than escaping to the toolbar
+    // above, so the next UP walks into the rows being fetched.
+    if (direction == brls::FocusDirection::UP && next == nullptr && m_hasLess) {
+        if (!m_loadingPrevious && m_onLoadPrevious) {
+            m_loadingPrevious = true;
+            brls::sync([this]() {
+                if (m_onLoadPrevious) m_onLoadPrevious();
+            });
+        }
+        return brls::Application::getCurrentFocus();
+    }
+
     return next;
 }
 
-void RecyclingGrid::addCellForItem(brls::Box*& currentRow, int& itemsInRow, size_t index) {
-    const int spacing = platform::getImageConstraints().gridCellSpacing;
-    if (itemsInRow == 0) {
-        currentRow = new brls::Box();
-        currentRow->setAxis(brls::Axis::ROW);
-        currentRow->setJustifyContent(brls::JustifyContent::FLEX_START);
-        currentRow->setMarginBottom(spacing);
-        m_contentBox->addView(currentRow);
-        m_rows.push_back(currentRow);
+brls::Box* RecyclingGrid::buildPage(size_t begin, size_t end) {
+    auto* page = new brls::Box();
+    page->setAxis(brls::Axis::COLUMN);
+
+    // Fill each row before it joins the page, and the page before it joins
+    // the tree: an addView() into a parentless box only lays out that box,
+    // so building bottom-up never touches the live view tree.
+    const size_t cols = m_columns > 0 ? (size_t)m_columns : 1;
+    size_t i = begin;
+    while (i < end) {
+        brls::Box* row = createRow();
+        size_t rowEnd = std::min(end, i + cols);
+        for (; i < rowEnd; i++) addCellToRow(row, i);
+        page->addView(row);
+        m_rows.push_back(row);
     }
+    return page;
+}
+
+brls::Box* RecyclingGrid::createRow() {
+    auto* row = new brls::Box();
+    row->setAxis(brls::Axis::ROW);
+    row->setJustifyContent(brls::JustifyContent::FLEX_START);
+    row->setMarginBottom(platform::getImageConstraints().gridCellSpacing);
+    return row;
+}
 
+void RecyclingGrid::addCellToRow(brls::Box* row, size_t index) {
+    const int spacing = platform::getImageConstraints().gridCellSpacing;
     auto* cell = new MediaItemCell();
     cell->setItem(m_items[index]);
     cell->setMarginRight(spacing);
     m_cells.push_back(cell);
 
-    int idx = (int)index;
-    cell->registerClickAction([this, idx](brls::View* view) {
-        onItemClicked(idx);
+    const long long serial = m_serialBase + (long long)index;
+    cell->registerClickAction([this, serial](brls::View* view) {
+        onItemClicked(serial);
         return true;
     });
     cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
@@ -295,12 +413,7 @@ void RecyclingGrid::addCellForItem(brls::Box*& currentRow, int& itemsInRow, size
             }
         }));
 
-    currentRow->addView(cell);
-
-    itemsInRow++;
-    if (itemsInRow >= m_columns) {
-        itemsInRow = 0;
-    }
+    row->addView(cell);
 }
 
 void RecyclingGrid::rebuildGrid() {
@@ -321,11 +434,12 @@ void RecyclingGrid::rebuildGrid() {
     // window because we never run a layout pass between the add and
     // the remove.
 
-    // Step 1: snapshot the old cells/rows. m_rows and m_cells are then
-    // emptied so addCellForItem() can append the new entries without
+    // Step 1: snapshot the old pages/cells. m_pages, m_rows and m_cells
+    // are then emptied so buildPage() can append the new entries without
     // having to walk past stale pointers.
-    std::vector<brls::Box*> oldRows = m_rows;
+    std::vector<brls::Box*> oldPages = m_pages;
     std::vector<MediaItemCell*> oldCells = m_cells;
+    m_pages.clear();
     m_rows.clear();
     m_cells.clear();
     m_renderedCount = 0;
@@ -344,12 +458,12 @@ void RecyclingGrid::rebuildGrid() {
         }
     }
 
-    // Step 3: build the new rows/cells. addCellForItem() addView()s into
-    // m_contentBox, so the old rows are still in the tree above them.
-    brls::Box* currentRow = nullptr;
-    int itemsInRow = 0;
-    for (size_t i = 0; i < m_items.size(); i++) {
-        addCellForItem(currentRow, itemsInRow, i);
+    // Step 3: build the new rows/cells into one detached page and attach
+    // it after the old pages, which are still in the tree above it.
+    if (!m_items.empty()) {
+        brls::Box* page = buildPage(0, m_items.size());
+        m_contentBox->addView(page);
+        m_pages.push_back(page);
     }
     m_renderedCount = m_items.size();
 
@@ -367,28 +481,29 @@ void RecyclingGrid::rebuildGrid() {
         }
     }
 
-    // Step 5: now safe — the only refs to the old cells are in oldRows
+    // Step 5: now safe — the only refs to the old cells are in oldPages
     // and the focus stack no longer points at any of them.
     //
     // Reset m_contentBox's lastFocusedView cache before deleting any
     // row that it might point at. Box::onChildFocusGained sets this
-    // pointer to whichever row last contained the focused view; it's
+    // pointer to whichever page last contained the focused view; it's
     // only cleared by Box::clearViews(), NOT by removeView(). Without
     // this reset, Box::getDefaultFocus() — which the next
     // giveFocus(m_contentGrid) walk lands in — dereferences the
-    // dangling row pointer and either returns nullptr (so focus stays
+    // dangling page pointer and either returns nullptr (so focus stays
     // wherever it was, the "stays on Back" symptom when leaving a
     // playlist) or returns a stale pointer that crashes on the next
     // input.
     m_contentBox->setLastFocusedView(nullptr);
-    for (auto* row : oldRows) {
-        if (row) m_contentBox->removeView(row, true);
+    for (auto* page : oldPages) {
+        if (page) m_contentBox->removeView(page, true);
     }
 }
 
-void RecyclingGrid::onItemClicked(int index) {
-    if (index >= 0 && index < (int)m_items.size() && m_onItemSelected) {
-        m_onItemSelected(m_items[index]);
+void RecyclingGrid::onItemClicked(long long serial) {
+    const long long index = serial - m_serialBase;
+    if (index >= 0 && index < (long long)m_items.size() && m_onItemSelected) {
+        m_onItemSelected(m_items[(size_t)index]);
     }
 }
 
@@ -437,9 +552,55 @@ void RecyclingGrid::draw(NVGcontext* vg, float x, float y, float width, float he
         }
     }
 
+    prefetchIfNeeded();
+
     brls::ScrollingFrame::draw(vg, x, y, width, height, style, ctx);
 }
 
+void RecyclingGrid::prefetchIfNeeded() {
+    // Smooth the downward speed over ~250 ms. Under redraw-on-demand there
+    // are no frames while the grid is idle, so the first frame after a
+    // pause sees a long dt and the speed drops straight back to its sample.
+    const int64_t now = brls::getCPUTimeUsec();
+    const float offset = getContentOffsetY();
+    if (m_lastSampleUsec > 0 && now > m_lastSampleUsec) {
+        const float dt = (float)(now - m_lastSampleUsec) / 1000000.0f;
+        const float speed = std::max(0.0f, offset - m_lastOffsetY) / std::max(dt, 0.001f);
+        m_scrollSpeed += (speed - m_scrollSpeed) * std::min(1.0f, dt / 0.25f);
+    }
+    m_lastOffsetY = offset;
+    m_lastSampleUsec = now;
+
+    if (!m_hasMore || m_loading || !m_onLoadMore || m_rows.empty() || m_pages.empty()) return;
+    // Nothing is measured before the first layout pass.
+    if (m_rows.front()->getHeight() <= 0.0f) return;
+
+    const float viewport = getScrollingAreaHeight();
+    const float below = getContentHeight() - (offset + viewport);
+    // A page is what the owner appends: the last batch, or the platform page
+    // size until one arrives (the first batch may be a widened restore page).
+    const int libraryPage = platform::getImageConstraints().libraryPageSize;
+    const size_t pageItems = m_lastPageItems > 0 ? m_lastPageItems
+                                                 : (size_t)std::max(libraryPage, 1);
+    const size_t cols = m_columns > 0 ? (size_t)m_columns : 1;
+    const float pitch = m_rows.front()->getHeight() +
+                        (float)platform::getImageConstraints().gridCellSpacing;
+    const float pageHeight = (float)((pageItems + cols - 1) / cols) * pitch;
+    const float lead = std::min(m_scrollSpeed * (float)m_prefetchLeadUsec / 1000000.0f + viewport,
+                                2.0f * pageHeight);
+    if (below > lead) return;
+
+    // Deferred like the DOWN trigger: the owner appends cells, which must
+    // not happen in the middle of drawing them.
+    m_loading = true;
+    std::weak_ptr<std::atomic<bool>> aliveWeak = m_alive;
+    brls::sync([this, aliveWeak]() {
+        auto alive = aliveWeak.lock();
+        if (!alive || !alive->load()) return;
+        if (m_onLoadMore) m_onLoadMore();
+    });
+}
+
 brls::View* RecyclingGrid::create() {
     return new RecyclingGrid();
 }
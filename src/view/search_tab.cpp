@@ -8,10 +8,12 @@
 #include "view/horizontal_scroll_row.hpp"
 #include "view/long_press_gesture.hpp"
 #include "app/application.hpp"
+#include "app/library_search.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/async.hpp"
 #include "platform/platform.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cctype>
 
@@ -78,16 +80,30 @@ size_t mapCol(size_t c, size_t fromN, size_t toN) {
     return tc >= toN ? toN - 1 : tc;
 }
 
+std::string lowerCase(std::string s) {
+    for (char& ch : s) ch = (char)tolower((unsigned char)ch);
+    return s;
+}
+
 // Case-insensitive substring test.
 bool icontains(const std::string& hay, const std::string& needle) {
     if (needle.empty()) return true;
-    auto lower = [](std::string s) {
-        for (char& ch : s) ch = (char)tolower((unsigned char)ch);
-        return s;
-    };
-    return lower(hay).find(lower(needle)) != std::string::npos;
+    return lowerCase(hay).find(lowerCase(needle)) != std::string::npos;
+}
+
+// Whether a cached result for a shorter query still answers `q`: the same
+// fields Plex matches a search on, narrowed to the longer text.
+bool matchesQuery(const MediaItem& it, const std::string& q) {
+    return icontains(it.title, q) || icontains(it.parentTitle, q) ||
+           icontains(it.grandparentTitle, q);
 }
 
+// One /hubs/search round trip, as handed from the worker to the UI thread.
+struct ServerResults {
+    bool ok = false;
+    std::vector<MediaItem> items;
+};
+
 std::string cardTitle(const MediaItem& it) {
     if (it.mediaType == MediaType::EPISODE && !it.grandparentTitle.empty())
         return it.grandparentTitle;       // show name (episode title goes in the sub)
@@ -196,6 +212,12 @@ SearchTab::SearchTab() {
     m_resultsScroll->setContentView(m_resultsContent);
     this->addView(m_resultsScroll);
 
+    // Server search fires once typing pauses; stop() (query cleared, tab
+    // hidden) ends the timer unfinished and sends nothing.
+    m_serverSearchTimer.setEndCallback([this](bool finished) {
+        if (finished) startServerSearch();
+    });
+
     // ---------------- Physical keyboard typing ----------------
     // The raw key event fires app-wide, so only act while focus is inside this
     // tab. A-Z / 0-9 / space / backspace aren't mapped to controller buttons,
@@ -314,50 +336,122 @@ void SearchTab::clearQuery()                     { m_query.clear(); updateField(
 void SearchTab::updateField()                    { if (m_queryLabel) m_queryLabel->setText(m_query); }
 
 void SearchTab::performSearch() {
+    const std::vector<std::string> shown = resultKeys();
+    m_movies.clear(); m_episodes.clear(); m_shows.clear();
+    m_artists.clear(); m_albums.clear(); m_tracks.clear();
+
+    // The query changed: a request still in flight (or about to go out) is
+    // for text that's no longer there. Abort it rather than ignore it.
+    m_serverSearch.cancelAll();
+    m_serverSearchTimer.stop();
     if (m_query.empty()) {
-        m_movies.clear(); m_episodes.clear(); m_shows.clear();
-        m_artists.clear(); m_albums.clear(); m_tracks.clear();
         rebuildResults();
         return;
     }
 
-    int gen = ++m_loadGeneration;
-    std::string q = m_query;
-    asyncRun([this, q, gen, aliveWeak = std::weak_ptr<bool>(m_alive)]() {
-        PlexClient& client = PlexClient::getInstance();
-        std::vector<MediaItem> results;
-        bool ok = client.search(q, results);
-
-        brls::sync([this, q, ok, results, gen, aliveWeak]() {
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) return;
-            if (gen != m_loadGeneration) return;   // stale
-
-            m_movies.clear(); m_episodes.clear(); m_shows.clear();
-            m_artists.clear(); m_albums.clear(); m_tracks.clear();
-            if (ok) {
-                for (const auto& it : results) {
-                    switch (it.mediaType) {
-                        case MediaType::MOVIE:        m_movies.push_back(it);   break;
-                        case MediaType::EPISODE:
-                            // Plex returns every episode of a show whose NAME
-                            // matches (all of "One Piece" for "one"); keep only
-                            // episodes whose own title contains the query — the
-                            // show itself is already in the TV Shows row.
-                            if (icontains(it.title, q)) m_episodes.push_back(it);
-                            break;
-                        case MediaType::SHOW:
-                        case MediaType::SEASON:       m_shows.push_back(it);    break;
-                        case MediaType::MUSIC_ARTIST: m_artists.push_back(it);  break;
-                        case MediaType::MUSIC_ALBUM:  m_albums.push_back(it);   break;
-                        case MediaType::MUSIC_TRACK:  m_tracks.push_back(it);   break;
-                        default: break;
-                    }
-                }
-            }
-            rebuildResults();
-        });
-    });
+    // Movies, shows and artists come straight from the local index, so
+    // every keystroke shows ranked results without waiting on the server.
+    LibrarySearch::Ptr local = LibrarySearch::current();
+    if (local) {
+        for (const auto& it : local->search(m_query, kLocalResultsPerType)) addResult(it);
+    }
+
+    // The server search covers what the index doesn't hold: episodes,
+    // albums, tracks and sections it hasn't synced yet. A query searched
+    // before is answered from the cache; otherwise the longest cached
+    // prefix, narrowed to the new text ("sta" -> "star"), stands in until
+    // the debounced request for the full query comes back.
+    bool exact = false;
+    if (const auto* cached = cachedServerResults(lowerCase(m_query), &exact)) {
+        for (const auto& it : *cached) {
+            if (local && local->contains(it.ratingKey)) continue;   // ranked locally
+            if (exact || matchesQuery(it, m_query)) addResult(it);
+        }
+    }
+
+    // Same cards as already on screen (a refinement that changed nothing)
+    // skips the rebuild and its image reloads; an empty set still rebuilds
+    // so the placeholder names the current query.
+    const std::vector<std::string> keys = resultKeys();
+    if (keys != shown || keys.empty()) rebuildResults();
+
+    if (!exact) m_serverSearchTimer.start(kServerSearchDebounceMs);
+}
+
+void SearchTab::startServerSearch() {
+    if (m_query.empty()) return;
+    const std::string q = m_query;
+    m_serverSearch.run([q]() {
+        ServerResults r;
+        r.ok = PlexClient::getInstance().search(q, r.items);
+        for (auto& it : r.items) it.trimForGrid();   // cached; keep it small
+        return r;
+    }).onUI([this, q](const ServerResults& r) {
+        if (!r.ok || q != m_query) return;
+        rememberServerResults(lowerCase(q), r.items);
+        performSearch();   // an exact cache hit now: merges, no new request
+    }, brls::Application::TaskPriority::HIGH);
+}
+
+const std::vector<MediaItem>* SearchTab::cachedServerResults(const std::string& key,
+                                                             bool* exact) {
+    auto best = m_serverCache.end();
+    size_t bestLen = 0;
+    *exact = false;
+    for (auto it = m_serverCache.begin(); it != m_serverCache.end(); ++it) {
+        if (it->first == key) {
+            *exact = true;
+            best = it;
+            break;
+        }
+        if (it->first.size() > bestLen && key.compare(0, it->first.size(), it->first) == 0) {
+            best = it;
+            bestLen = it->first.size();
+        }
+    }
+    if (best == m_serverCache.end()) return nullptr;
+
+    // A hit is a use: move it to the most recently used end.
+    std::rotate(best, best + 1, m_serverCache.end());
+    return &m_serverCache.back().second;
+}
+
+void SearchTab::rememberServerResults(const std::string& key, std::vector<MediaItem> items) {
+    auto it = std::find_if(m_serverCache.begin(), m_serverCache.end(),
+                           [&](const auto& entry) { return entry.first == key; });
+    if (it != m_serverCache.end()) m_serverCache.erase(it);
+    if (m_serverCache.size() >= kServerCacheEntries) m_serverCache.erase(m_serverCache.begin());
+    m_serverCache.emplace_back(key, std::move(items));
+}
+
+std::vector<std::string> SearchTab::resultKeys() const {
+    std::vector<std::string> keys;
+    for (const auto* row : {&m_movies, &m_episodes, &m_shows, &m_artists, &m_albums, &m_tracks}) {
+        for (const auto& it : *row) keys.push_back(it.ratingKey);
+        keys.emplace_back();   // row separator
+    }
+    while (!keys.empty() && keys.back().empty()) keys.pop_back();
+    return keys;
+}
+
+bool SearchTab::addResult(const MediaItem& it) {
+    switch (it.mediaType) {
+        case MediaType::MOVIE:        m_movies.push_back(it);   return true;
+        case MediaType::EPISODE:
+            // Plex returns every episode of a show whose NAME
+            // matches (all of "One Piece" for "one"); keep only
+            // episodes whose own title contains the query — the
+            // show itself is already in the TV Shows row.
+            if (!icontains(it.title, m_query)) return false;
+            m_episodes.push_back(it);
+            return true;
+        case MediaType::SHOW:
+        case MediaType::SEASON:       m_shows.push_back(it);    return true;
+        case MediaType::MUSIC_ARTIST: m_artists.push_back(it);  return true;
+        case MediaType::MUSIC_ALBUM:  m_albums.push_back(it);   return true;
+        case MediaType::MUSIC_TRACK:  m_tracks.push_back(it);   return true;
+        default: return false;
+    }
 }
 
 void SearchTab::rebuildResults() {
@@ -555,7 +649,8 @@ void SearchTab::willDisappear(bool resetState) {
     brls::Box::willDisappear(resetState);
     if (m_alive) *m_alive = false;
     if (m_imgAlive) *m_imgAlive = false;
-    m_loadGeneration++;
+    m_serverSearch.cancelAll();
+    m_serverSearchTimer.stop();
     ImageLoader::cancelAll();
     ImageLoader::clearCache();
 }
@@ -563,6 +658,21 @@ void SearchTab::willDisappear(bool resetState) {
 void SearchTab::onFocusGained() {
     brls::Box::onFocusGained();
     m_alive = std::make_shared<bool>(true);
+
+    // Bring the local search index up to date in the background (the first
+    // visit builds it); whatever is typed by then re-runs against it. Its
+    // own thread: listing a never-synced section can take minutes.
+    if (LibrarySearch::needsRefresh()) {
+        asyncRunDedicated([this, aliveWeak = std::weak_ptr<bool>(m_alive)]() {
+            if (!LibrarySearch::refresh()) return;
+            brls::Application::post([this, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (!m_query.empty()) performSearch();
+            }, brls::Application::TaskPriority::NORMAL);
+        });
+    }
+
     // Land on the keyboard so the user can start typing immediately.
     if (m_keyboardFirstKey) brls::Application::giveFocus(m_keyboardFirstKey);
 }
@@ -15,6 +15,11 @@
 #include "app/plex_client.hpp"
 #include "app/plex_palette.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/library_index.hpp"
+#include "app/library_search.hpp"
+#include "app/home_snapshot.hpp"
+#include "app/metadata_cache.hpp"
+#include "app/music_prefetch.hpp"
 #include "app/synclounge_session.hpp"
 #include "view/media_detail_view.hpp"
 #include "activity/player_activity.hpp"
@@ -653,6 +658,35 @@ brls::Box* SettingsTab::createUISection() {
     });
     box->addView(mpvStatsToggle);
 
+    // Frame profiler: per-phase bar graph of the last ~2s of main-loop
+    // iterations, plus a CSV export of the last 10s for offline digging.
+    auto* profilerToggle = new brls::BooleanCell();
+    profilerToggle->init("Frame Profiler Overlay", settings.showFrameProfiler,
+                         [&settings](bool value) {
+        settings.showFrameProfiler = value;
+        brls::Application::setFrameProfiler(value);
+        brls::Application::setFrameProfilerOverlay(value);
+        Application::getInstance().saveSettings();
+    });
+    box->addView(profilerToggle);
+
+    auto* traceCell = new brls::DetailCell();
+    traceCell->setText("Export Frame Trace");
+    traceCell->setDetailText("frame_trace.csv");
+    traceCell->registerClickAction([](brls::View*) {
+        if (!brls::Application::isFrameProfilerEnabled()) {
+            brls::Application::notify("Enable the frame profiler first");
+            return true;
+        }
+        std::string path = platformPath("frame_trace.csv");
+        if (brls::Application::exportFrameProfiles(path))
+            brls::Application::notify("Frame trace saved to " + path);
+        else
+            brls::Application::notify("Could not write frame trace");
+        return true;
+    });
+    box->addView(traceCell);
+
     // Manage hidden libraries (+ Live TV / Downloads). Hidden items are kept out
     // of the sidebar and the sidebar reorder editor; this is the one place to
     // toggle them.
@@ -1114,6 +1148,11 @@ brls::Box* SettingsTab::createNetworkSection() {
     }
     m_clearCacheCell->registerClickAction([this](brls::View*) {
         HttpCache::clear();
+        LibraryIndex::clear();
+        LibrarySearch::clear();
+        HomeSnapshot::clear();
+        MetadataCache::clear();
+        MusicPrefetch::getInstance().clear();
         if (m_clearCacheCell) m_clearCacheCell->setDetailText("Empty");
         brls::Application::notify("Cache cleared");
         return true;
@@ -1328,8 +1367,14 @@ void SettingsTab::onLogout() {
         // the current-user pointer so the next login starts clean.
         // Also wipe the HTTP cache — the cached bodies came back with
         // the soon-to-be-revoked token in their URLs and would just be
-        // dead weight for the next sign-in.
+        // dead weight for the next sign-in. Same for the library indexes,
+        // which the next account may not be allowed to see.
         HttpCache::clear();
+        LibraryIndex::clear();
+        LibrarySearch::clear();
+        HomeSnapshot::clear();
+        MetadataCache::clear();
+        MusicPrefetch::getInstance().clear();
         PlexClient::getInstance().logout();
         Application::getInstance().setAuthToken("");
         Application::getInstance().setMasterAuthToken("");